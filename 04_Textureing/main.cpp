@@ -62,9 +62,9 @@ public:
   virtual void init() override {
     setupTextures();
     setupGeometry();
-    GL(glDisable(GL_CULL_FACE));
-    GL(glEnable(GL_DEPTH_TEST));
-    GL(glDepthFunc(GL_LESS));
+    GLState::current().disable(GL_CULL_FACE);
+    GLState::current().enable(GL_DEPTH_TEST);
+    GLState::current().depthFunc(GL_LESS);
     GL(glClearColor(0.0f, 0.0f, 0.0f, 1.0f));
     setAnimation(false);
   }
@@ -123,7 +123,7 @@ public:
   virtual void resize(int width, int height) override {
     const float ratio = static_cast<float>(width) / static_cast<float>(height);
     projectionMatrix = Mat4::perspective(60.0f, ratio, 0.1f, 10000.0f);
-    GL(glViewport(0, 0, width, height));
+    GLState::current().viewport(0, 0, width, height);
   }
 
   void setupGeometry() {
@@ -11,10 +11,6 @@ public:
 
   inline static const float normals[] = { -0.96674194128896f, -0.25575200653312f, 0.0f, -0.89301404614656f, -0.25634499723264f, -0.36988199632896f, -0.89343699976192f, 0.25599699582976f, -0.36910198161408f, -0.9668239818752f, 0.25544301215744f, 0.0f, -0.0838799982592f, 0.99584302907392f, -0.03550700109824f, -0.09205400469504f, 0.99575402594304f, 0.0f, 0.62972198125568f, 0.731862007808f, 0.26043798781952f, 0.6820489854976f, 0.73130701750272f, 0.0f, 0.80372503150592f, 0.49336901697536f, 0.33258400120832f, 0.87030096723968f, 0.49252000595968f, 0.0f, -0.68340701724672f, -0.25673099902976f, -0.68340701724672f, -0.68353100087296f, 0.25606798442496f, -0.68353100087296f, -0.06492599615488f, 0.995776004096f, -0.06492500000768f, 0.48139700535296f, 0.7324710207488f, 0.48139700535296f, 0.6148040163328f, 0.49399698817024f, 0.6148040163328f, -0.36988199632896f, -0.25634499723264f, -0.89301404614656f, -0.36910198161408f, 0.2559959891968f, -0.89343699976192f, -0.03550700109824f, 0.99584302907392f, -0.083879002112f, 0.260439015424f, 0.73186100117504f, 0.62972302983168f, 0.33258400120832f, 0.49336901697536f, 0.80372503150592f, -0.00284799991808f, -0.2578629787648f, -0.96617696854016f, -0.00192199999488f, 0.25473599930368f, -0.96700903456768f, -0.00026500001792f, 0.99573397716992f, -0.09227200364544f, 0.000023f, 0.73129602842624f, 0.68206001651712f, 0.0f, 0.49252000595968f, 0.87030096723968f, -0.00284799991808f, -0.2578629787648f, -0.96617696854016f, 0.37905800101888f, -0.35929997705216f, -0.85277095755776f, 0.37710999846912f, 0.14908500475904f, -0.91409101094912f, -0.00192199999488f, 0.25473599930368f, -0.96700903456768f, 0.02750300028928f, 0.99208099004416f, -0.12255500435456f, -0.00026500001792f, 0.99573397716992f, -0.09227200364544f, -0.26100900036608f, 0.7267629924352f, 0.63536499785728f, 0.000023f, 0.73129602842624f, 0.68206001651712f, -0.3324849946624f, 0.49254601064448f, 0.80427096211456f, 0.0f, 0.49252000595968f, 0.87030096723968f, 0.66354698780672f, -0.41079197925376f, -0.6252639813632f, 0.71266400731136f, 0.07372399968256f, -0.6976209682432f, 0.09972700151808f, 0.987509030912f, -0.1219829956608f, -0.4873189851136f, 0.72375601201152f, 0.4885670002688f, -0.61524198555648f, 0.49260099796992f, 0.61548399689728f, 0.88002797764608f, -0.33290698358784f, -0.33870900625408f, 0.91727700426752f, 0.16711199752192f, -0.3614930108416f, 0.1135869952f, 0.99236502831104f, -0.04807000064f, -0.63414902718464f, 0.72750899134464f, 0.26188800065536f, -0.80412600696832f, 0.4926340071424f, 0.3327049859072f, 0.96669001580544f, -0.25573799755776f, 0.01045399994368f, 0.96744197062656f, 0.25296199745536f, 0.00810300014592f, 0.09343899533312f, 0.99562400251904f, 0.00128f, -0.68216596463616f, 0.73119695896576f, -0.00034300000256f, -0.87032202264576f, 0.49248297025536f, -0.000054f, 0.96669001580544f, -0.25573799755776f, 0.01045399994368f, 0.89301404614656f, -0.25634499723264f, 0.36988199632896f, 0.89343699976192f, 0.25599699582976f, 0.36910198161408f, 0.96744197062656f, 0.25296199745536f, 0.00810300014592f, 0.0838799982592f, 0.99584302907392f, 0.03550700109824f, 0.09343899533312f, 0.99562400251904f, 0.00128f, -0.62972198125568f, 0.731862007808f, -0.26043798781952f, -0.68216596463616f, 0.73119695896576f, -0.00034300000256f, -0.80372503150592f, 0.49336901697536f, -0.33258400120832f, -0.87032202264576f, 0.49248297025536f, -0.000054f, 0.68340701724672f, -0.25673099902976f, 0.68340701724672f, 0.68353100087296f, 0.25606798442496f, 0.68353100087296f, 0.06492599615488f, 0.995776004096f, 0.06492500000768f, -0.48139700535296f, 0.7324710207488f, -0.48139700535296f, -0.6148040163328f, 0.49399698817024f, -0.6148040163328f, 0.36988199632896f, -0.25634499723264f, 0.89301404614656f, 0.36910198161408f, 0.2559959891968f, 0.89343699976192f, 0.03550700109824f, 0.99584302907392f, 0.083879002112f, -0.260439015424f, 0.73186100117504f, -0.62972302983168f, -0.33258400120832f, 0.49336901697536f, -0.80372503150592f, 0.0f, -0.25575200653312f, 0.96674194128896f, 0.0f, 0.25544301215744f, 0.9668239818752f, 0.0f, 0.99575402594304f, 0.09205400469504f, 0.0f, 0.73130701750272f, -0.6820489854976f, 0.0f, 0.49252000595968f, -0.87030096723968f, 0.0f, -0.25575200653312f, 0.96674194128896f, -0.36988199632896f, -0.25634499723264f, 0.89301404614656f, -0.36910198161408f, 0.25599699582976f, 0.89343699976192f, 0.0f, 0.25544301215744f, 0.9668239818752f, -0.03550700109824f, 0.99584302907392f, 0.0838799982592f, 0.0f, 0.99575402594304f, 0.09205400469504f, 0.26043798781952f, 0.731862007808f, -0.62972198125568f, 0.0f, 0.73130701750272f, -0.6820489854976f, 0.33258400120832f, 0.49336901697536f, -0.80372503150592f, 0.0f, 0.49252000595968f, -0.87030096723968f, -0.68340701724672f, -0.25673099902976f, 0.68340701724672f, -0.68353100087296f, 0.25606798442496f, 0.68353100087296f, -0.06492500000768f, 0.995776004096f, 0.06492599615488f, 0.48139700535296f, 0.7324710207488f, -0.48139700535296f, 0.6148040163328f, 0.49399698817024f, -0.6148040163328f, -0.89301404614656f, -0.25634499723264f, 0.36988199632896f, -0.89343699976192f, 0.2559959891968f, 0.36910198161408f, -0.083879002112f, 0.99584302907392f, 0.03550700109824f, 0.62972302983168f, 0.73186100117504f, -0.260439015424f, 0.80372503150592f, 0.49336901697536f, -0.33258400120832f, -0.96674194128896f, -0.25575200653312f, 0.0f, -0.9668239818752f, 0.25544301215744f, 0.0f, -0.09205400469504f, 0.99575402594304f, 0.0f, 0.6820489854976f, 0.73130701750272f, 0.0f, 0.87030096723968f, 0.49252000595968f, 0.0f, 0.87030096723968f, 0.49252000595968f, 0.0f, 0.80372503150592f, 0.49336901697536f, 0.33258400120832f, 0.84543897862144f, 0.40354497691648f, 0.34983500578816f, 0.91532103254016f, 0.40272499048448f, 0.0f, 0.86999604133888f, 0.33685898264576f, 0.36004601790464f, 0.94180797841408f, 0.33615100510208f, 0.0f, 0.9041929568256f, 0.20579098820608f, 0.37428001767424f, 0.97869000343552f, 0.20534198796288f, 0.0f, 0.92187899461632f, -0.06636899926016f, 0.38175200247808f, 0.99780395008f, -0.06623899680768f, 0.0f, 0.6148040163328f, 0.49399698817024f, 0.6148040163328f, 0.64680202600448f, 0.404096024576f, 0.64680202600448f, 0.66565500305408f, 0.33735200210944f, 0.66565500305408f, 0.6919230062592f, 0.20611998941184f, 0.6919230062592f, 0.70554300186624f, -0.06647899488256f, 0.70554300186624f, 0.33258400120832f, 0.49336901697536f, 0.80372503150592f, 0.34983500578816f, 0.40354497691648f, 0.84543897862144f, 0.3600470245376f, 0.33685799698432f, 0.86999604133888f, 0.37428001767424f, 0.20579098820608f, 0.9041929568256f, 0.38175200247808f, -0.06636899926016f, 0.92187899461632f, 0.0f, 0.49252000595968f, 0.87030096723968f, 0.0f, 0.40272499048448f, 0.91532103254016f, 0.0f, 0.33615100510208f, 0.94180797841408f, 0.0f, 0.20534198796288f, 0.97869000343552f, 0.0f, -0.06623899680768f, 0.99780395008f, 0.0f, 0.49252000595968f, 0.87030096723968f, -0.3324849946624f, 0.49254601064448f, 0.80427096211456f, -0.34983500578816f, 0.40354497691648f, 0.84543897862144f, 0.0f, 0.40272499048448f, 0.91532103254016f, -0.36004601790464f, 0.33685898264576f, 0.86999604133888f, 0.0f, 0.33615100510208f, 0.94180797841408f, -0.37428001767424f, 0.20579098820608f, 0.9041929568256f, 0.0f, 0.20534198796288f, 0.97869000343552f, -0.38175200247808f, -0.06636899926016f, 0.92187899461632f, 0.0f, -0.06623899680768f, 0.99780395008f, -0.61524198555648f, 0.49260099796992f, 0.61548399689728f, -0.64680202600448f, 0.404096024576f, 0.64680202600448f, -0.66565500305408f, 0.33735200210944f, 0.66565500305408f, -0.6919230062592f, 0.20611998941184f, 0.6919230062592f, -0.70554300186624f, -0.06647899488256f, 0.70554300186624f, -0.80412600696832f, 0.4926340071424f, 0.3327049859072f, -0.84543897862144f, 0.40354497691648f, 0.34983500578816f, -0.86999604133888f, 0.33685799698432f, 0.3600470245376f, -0.9041929568256f, 0.20579098820608f, 0.37428001767424f, -0.92187899461632f, -0.06636899926016f, 0.38175200247808f, -0.87032202264576f, 0.49248297025536f, -0.000054f, -0.91532103254016f, 0.40272499048448f, 0.0f, -0.94180797841408f, 0.33615100510208f, 0.0f, -0.97869000343552f, 0.20534198796288f, 0.0f, -0.99780395008f, -0.06623899680768f, 0.0f, -0.87032202264576f, 0.49248297025536f, -0.000054f, -0.80372503150592f, 0.49336901697536f, -0.33258400120832f, -0.84543897862144f, 0.40354497691648f, -0.34983500578816f, -0.91532103254016f, 0.40272499048448f, 0.0f, -0.86999604133888f, 0.33685898264576f, -0.36004601790464f, -0.94180797841408f, 0.33615100510208f, 0.0f, -0.9041929568256f, 0.20579098820608f, -0.37428001767424f, -0.97869000343552f, 0.20534198796288f, 0.0f, -0.92187899461632f, -0.06636899926016f, -0.38175200247808f, -0.99780395008f, -0.06623899680768f, 0.0f, -0.6148040163328f, 0.49399698817024f, -0.6148040163328f, -0.64680202600448f, 0.404096024576f, -0.64680202600448f, -0.66565500305408f, 0.33735200210944f, -0.66565500305408f, -0.6919230062592f, 0.20611998941184f, -0.6919230062592f, -0.70554300186624f, -0.06647899488256f, -0.70554300186624f, -0.33258400120832f, 0.49336901697536f, -0.80372503150592f, -0.34983500578816f, 0.40354497691648f, -0.84543897862144f, -0.3600470245376f, 0.33685799698432f, -0.86999604133888f, -0.37428001767424f, 0.20579098820608f, -0.9041929568256f, -0.38175200247808f, -0.06636899926016f, -0.92187899461632f, 0.0f, 0.49252000595968f, -0.87030096723968f, 0.0f, 0.40272499048448f, -0.91532103254016f, 0.0f, 0.33615100510208f, -0.94180797841408f, 0.0f, 0.20534198796288f, -0.97869000343552f, 0.0f, -0.06623899680768f, -0.99780395008f, 0.0f, 0.49252000595968f, -0.87030096723968f, 0.33258400120832f, 0.49336901697536f, -0.80372503150592f, 0.34983500578816f, 0.40354497691648f, -0.84543897862144f, 0.0f, 0.40272499048448f, -0.91532103254016f, 0.36004601790464f, 0.33685898264576f, -0.86999604133888f, 0.0f, 0.33615100510208f, -0.94180797841408f, 0.37428001767424f, 0.20579098820608f, -0.9041929568256f, 0.0f, 0.20534198796288f, -0.97869000343552f, 0.38175200247808f, -0.06636899926016f, -0.92187899461632f, 0.0f, -0.06623899680768f, -0.99780395008f, 0.6148040163328f, 0.49399698817024f, -0.6148040163328f, 0.64680202600448f, 0.404096024576f, -0.64680202600448f, 0.66565500305408f, 0.33735200210944f, -0.66565500305408f, 0.6919230062592f, 0.20611998941184f, -0.6919230062592f, 0.70554300186624f, -0.06647899488256f, -0.70554300186624f, 0.80372503150592f, 0.49336901697536f, -0.33258400120832f, 0.84543897862144f, 0.40354497691648f, -0.34983500578816f, 0.86999604133888f, 0.33685799698432f, -0.3600470245376f, 0.9041929568256f, 0.20579098820608f, -0.37428001767424f, 0.92187899461632f, -0.06636899926016f, -0.38175200247808f, 0.87030096723968f, 0.49252000595968f, 0.0f, 0.91532103254016f, 0.40272499048448f, 0.0f, 0.94180797841408f, 0.33615100510208f, 0.0f, 0.97869000343552f, 0.20534198796288f, 0.0f, 0.99780395008f, -0.06623899680768f, 0.0f, 0.99780395008f, -0.06623899680768f, 0.0f, 0.92187899461632f, -0.06636899926016f, 0.38175200247808f, 0.83143696580608f, -0.43617997553664f, 0.34417900781568f, 0.90018202779648f, -0.43551299731456f, 0.0f, 0.67351198302208f, -0.68466501484544f, 0.27859399737344f, 0.72961100873728f, -0.68386298003456f, 0.0f, 0.64039895957504f, -0.72092401795072f, 0.26487400955904f, 0.69395099418624f, -0.72002199093248f, 0.0f, 0.73294900363264f, -0.6089959538688f, 0.30316599181312f, 0.79395003826176f, -0.60798399414272f, 0.0f, 0.70554300186624f, -0.06647899488256f, 0.70554300186624f, 0.6360919965696f, -0.43677799940096f, 0.6360919965696f, 0.51496498495488f, -0.68528904339456f, 0.51496498495488f, 0.48965097619456f, -0.72144595714048f, 0.48965097619456f, 0.56055497228288f, -0.609554006016f, 0.56055497228288f, 0.38175200247808f, -0.06636899926016f, 0.92187899461632f, 0.34417900781568f, -0.43617997553664f, 0.83143696580608f, 0.27859399737344f, -0.68466501484544f, 0.67351198302208f, 0.26487400955904f, -0.72092401795072f, 0.64039895957504f, 0.30316599181312f, -0.6089959538688f, 0.73294900363264f, 0.0f, -0.06623899680768f, 0.99780395008f, 0.0f, -0.43551299731456f, 0.90018202779648f, 0.0f, -0.68386298003456f, 0.72961100873728f, 0.0f, -0.72002199093248f, 0.69395099418624f, 0.0f, -0.60798399414272f, 0.79395003826176f, 0.0f, -0.06623899680768f, 0.99780395008f, -0.38175200247808f, -0.06636899926016f, 0.92187899461632f, -0.34417900781568f, -0.43617997553664f, 0.83143696580608f, 0.0f, -0.43551299731456f, 0.90018202779648f, -0.27859399737344f, -0.68466501484544f, 0.67351198302208f, 0.0f, -0.68386298003456f, 0.72961100873728f, -0.26487400955904f, -0.72092401795072f, 0.64039895957504f, 0.0f, -0.72002199093248f, 0.69395099418624f, -0.30316599181312f, -0.6089959538688f, 0.73294900363264f, 0.0f, -0.60798399414272f, 0.79395003826176f, -0.70554300186624f, -0.06647899488256f, 0.70554300186624f, -0.6360919965696f, -0.43677799940096f, 0.6360919965696f, -0.51496498495488f, -0.68528904339456f, 0.51496498495488f, -0.48965097619456f, -0.72144595714048f, 0.48965097619456f, -0.56055497228288f, -0.609554006016f, 0.56055497228288f, -0.92187899461632f, -0.06636899926016f, 0.38175200247808f, -0.83143696580608f, -0.43617997553664f, 0.34417900781568f, -0.67351198302208f, -0.68466501484544f, 0.27859399737344f, -0.64039895957504f, -0.72092401795072f, 0.26487400955904f, -0.73294900363264f, -0.6089959538688f, 0.30316599181312f, -0.99780395008f, -0.06623899680768f, 0.0f, -0.90018202779648f, -0.43551299731456f, 0.0f, -0.72961100873728f, -0.68386298003456f, 0.0f, -0.69395099418624f, -0.72002199093248f, 0.0f, -0.79395003826176f, -0.60798399414272f, 0.0f, -0.99780395008f, -0.06623899680768f, 0.0f, -0.92187899461632f, -0.06636899926016f, -0.38175200247808f, -0.83143696580608f, -0.43617997553664f, -0.34417900781568f, -0.90018202779648f, -0.43551299731456f, 0.0f, -0.67351198302208f, -0.68466501484544f, -0.27859399737344f, -0.72961100873728f, -0.68386298003456f, 0.0f, -0.64039895957504f, -0.72092401795072f, -0.26487400955904f, -0.69395099418624f, -0.72002199093248f, 0.0f, -0.73294900363264f, -0.6089959538688f, -0.30316599181312f, -0.79395003826176f, -0.60798399414272f, 0.0f, -0.70554300186624f, -0.06647899488256f, -0.70554300186624f, -0.6360919965696f, -0.43677799940096f, -0.6360919965696f, -0.51496498495488f, -0.68528904339456f, -0.51496498495488f, -0.48965097619456f, -0.72144595714048f, -0.48965097619456f, -0.56055497228288f, -0.609554006016f, -0.56055497228288f, -0.38175200247808f, -0.06636899926016f, -0.92187899461632f, -0.34417900781568f, -0.43617997553664f, -0.83143696580608f, -0.27859399737344f, -0.68466501484544f, -0.67351198302208f, -0.26487400955904f, -0.72092401795072f, -0.64039895957504f, -0.30316599181312f, -0.6089959538688f, -0.73294900363264f, 0.0f, -0.06623899680768f, -0.99780395008f, 0.0f, -0.43551299731456f, -0.90018202779648f, 0.0f, -0.68386298003456f, -0.72961100873728f, 0.0f, -0.72002199093248f, -0.69395099418624f, 0.0f, -0.60798399414272f, -0.79395003826176f, 0.0f, -0.06623899680768f, -0.99780395008f, 0.38175200247808f, -0.06636899926016f, -0.92187899461632f, 0.34417900781568f, -0.43617997553664f, -0.83143696580608f, 0.0f, -0.43551299731456f, -0.90018202779648f, 0.27859399737344f, -0.68466501484544f, -0.67351198302208f, 0.0f, -0.68386298003456f, -0.72961100873728f, 0.26487400955904f, -0.72092401795072f, -0.64039895957504f, 0.0f, -0.72002199093248f, -0.69395099418624f, 0.30316599181312f, -0.6089959538688f, -0.73294900363264f, 0.0f, -0.60798399414272f, -0.79395003826176f, 0.70554300186624f, -0.06647899488256f, -0.70554300186624f, 0.6360919965696f, -0.43677799940096f, -0.6360919965696f, 0.51496498495488f, -0.68528904339456f, -0.51496498495488f, 0.48965097619456f, -0.72144595714048f, -0.48965097619456f, 0.56055497228288f, -0.609554006016f, -0.56055497228288f, 0.92187899461632f, -0.06636899926016f, -0.38175200247808f, 0.83143696580608f, -0.43617997553664f, -0.34417900781568f, 0.67351198302208f, -0.68466501484544f, -0.27859399737344f, 0.64039895957504f, -0.72092401795072f, -0.26487400955904f, 0.73294900363264f, -0.6089959538688f, -0.30316599181312f, 0.99780395008f, -0.06623899680768f, 0.0f, 0.90018202779648f, -0.43551299731456f, 0.0f, 0.72961100873728f, -0.68386298003456f, 0.0f, 0.69395099418624f, -0.72002199093248f, 0.0f, 0.79395003826176f, -0.60798399414272f, 0.0f, 0.79395003826176f, -0.60798399414272f, 0.0f, 0.73294900363264f, -0.6089959538688f, 0.30316599181312f, 0.57623000907776f, -0.78180098506752f, 0.23821599899648f, 0.62386002198528f, -0.7815359889408f, 0.0f, 0.16362899505152f, -0.98420794589184f, 0.06752700465152f, 0.17729100709888f, -0.98415895642112f, 0.0f, 0.04542099881984f, -0.99879196033024f, 0.01873500045312f, 0.0492069978112f, -0.99878902431744f, 0.0f, 0.0f, -1.00000000376832f, 0.0f, 0.0f, -1.00000000376832f, 0.0f, 0.56055497228288f, -0.609554006016f, 0.56055497228288f, 0.44041601286144f, -0.7823480061952f, 0.44041601286144f, 0.12490200055808f, -0.98427597750272f, 0.12490200055808f, 0.03466200088576f, -0.998798000128f, 0.03466200088576f, 0.0f, -1.00000000376832f, 0.0f, 0.30316599181312f, -0.6089959538688f, 0.73294900363264f, 0.23821599899648f, -0.78180098506752f, 0.57623000907776f, 0.06752700465152f, -0.98420794589184f, 0.16362899505152f, 0.01873500045312f, -0.99879196033024f, 0.04542099881984f, 0.0f, -1.00000000376832f, 0.0f, 0.0f, -0.60798399414272f, 0.79395003826176f, 0.0f, -0.7815359889408f, 0.62386002198528f, 0.0f, -0.98415895642112f, 0.17729100709888f, 0.0f, -0.99878902431744f, 0.0492069978112f, 0.0f, -1.00000000376832f, 0.0f, 0.0f, -0.60798399414272f, 0.79395003826176f, -0.30316599181312f, -0.6089959538688f, 0.73294900363264f, -0.23821599899648f, -0.78180098506752f, 0.57623000907776f, 0.0f, -0.7815359889408f, 0.62386002198528f, -0.06752700465152f, -0.98420794589184f, 0.16362899505152f, 0.0f, -0.98415895642112f, 0.17729100709888f, -0.01873500045312f, -0.99879196033024f, 0.04542099881984f, 0.0f, -0.99878902431744f, 0.0492069978112f, 0.0f, -1.00000000376832f, 0.0f, 0.0f, -1.00000000376832f, 0.0f, -0.56055497228288f, -0.609554006016f, 0.56055497228288f, -0.44041601286144f, -0.7823480061952f, 0.44041601286144f, -0.12490200055808f, -0.98427597750272f, 0.12490200055808f, -0.03466200088576f, -0.998798000128f, 0.03466200088576f, 0.0f, -1.00000000376832f, 0.0f, -0.73294900363264f, -0.6089959538688f, 0.30316599181312f, -0.57623000907776f, -0.78180098506752f, 0.23821599899648f, -0.16362899505152f, -0.98420794589184f, 0.06752700465152f, -0.04542099881984f, -0.99879196033024f, 0.01873500045312f, 0.0f, -1.00000000376832f, 0.0f, -0.79395003826176f, -0.60798399414272f, 0.0f, -0.62386002198528f, -0.7815359889408f, 0.0f, -0.17729100709888f, -0.98415895642112f, 0.0f, -0.0492069978112f, -0.99878902431744f, 0.0f, 0.0f, -1.00000000376832f, 0.0f, -0.79395003826176f, -0.60798399414272f, 0.0f, -0.73294900363264f, -0.6089959538688f, -0.30316599181312f, -0.57623000907776f, -0.78180098506752f, -0.23821599899648f, -0.62386002198528f, -0.7815359889408f, 0.0f, -0.16362899505152f, -0.98420794589184f, -0.06752700465152f, -0.17729100709888f, -0.98415895642112f, 0.0f, -0.04542099881984f, -0.99879196033024f, -0.01873500045312f, -0.0492069978112f, -0.99878902431744f, 0.0f, 0.0f, -1.00000000376832f, 0.0f, 0.0f, -1.00000000376832f, 0.0f, -0.56055497228288f, -0.609554006016f, -0.56055497228288f, -0.44041601286144f, -0.7823480061952f, -0.44041601286144f, -0.12490200055808f, -0.98427597750272f, -0.12490200055808f, -0.03466200088576f, -0.998798000128f, -0.03466200088576f, 0.0f, -1.00000000376832f, 0.0f, -0.30316599181312f, -0.6089959538688f, -0.73294900363264f, -0.23821599899648f, -0.78180098506752f, -0.57623000907776f, -0.06752700465152f, -0.98420794589184f, -0.16362899505152f, -0.01873500045312f, -0.99879196033024f, -0.04542099881984f, 0.0f, -1.00000000376832f, 0.0f, 0.0f, -0.60798399414272f, -0.79395003826176f, 0.0f, -0.7815359889408f, -0.62386002198528f, 0.0f, -0.98415895642112f, -0.17729100709888f, 0.0f, -0.99878902431744f, -0.0492069978112f, 0.0f, -1.00000000376832f, 0.0f, 0.0f, -0.60798399414272f, -0.79395003826176f, 0.30316599181312f, -0.6089959538688f, -0.73294900363264f, 0.23821599899648f, -0.78180098506752f, -0.57623000907776f, 0.0f, -0.7815359889408f, -0.62386002198528f, 0.06752700465152f, -0.98420794589184f, -0.16362899505152f, 0.0f, -0.98415895642112f, -0.17729100709888f, 0.01873500045312f, -0.99879196033024f, -0.04542099881984f, 0.0f, -0.99878902431744f, -0.0492069978112f, 0.0f, -1.00000000376832f, 0.0f, 0.0f, -1.00000000376832f, 0.0f, 0.56055497228288f, -0.609554006016f, -0.56055497228288f, 0.44041601286144f, -0.7823480061952f, -0.44041601286144f, 0.12490200055808f, -0.98427597750272f, -0.12490200055808f, 0.03466200088576f, -0.998798000128f, -0.03466200088576f, 0.0f, -1.00000000376832f, 0.0f, 0.73294900363264f, -0.6089959538688f, -0.30316599181312f, 0.57623000907776f, -0.78180098506752f, -0.23821599899648f, 0.16362899505152f, -0.98420794589184f, -0.06752700465152f, 0.04542099881984f, -0.99879196033024f, -0.01873500045312f, 0.0f, -1.00000000376832f, 0.0f, 0.79395003826176f, -0.60798399414272f, 0.0f, 0.62386002198528f, -0.7815359889408f, 0.0f, 0.17729100709888f, -0.98415895642112f, 0.0f, 0.0492069978112f, -0.99878902431744f, 0.0f, 0.0f, -1.00000000376832f, 0.0f, 0.00778499981312f, -0.99997005643776f, -0.00021500000256f, 0.00703800016896f, -0.8124949856256f, 0.58292596375552f, 0.03612700049408f, -0.83725798866944f, 0.54561402257408f, 0.03913799958528f, -0.99923303333888f, -0.00098799992832f, 0.16184599642112f, -0.81042098618368f, 0.5630490312704f, 0.17951199592448f, -0.98374598524928f, -0.00436800028672f, 0.48236500877312f, -0.5951480397824f, 0.64274596626432f, 0.61229997490176f, -0.79055600746496f, -0.01045900034048f, 0.73872003039232f, -0.1145929990144f, 0.66419899236352f, 0.98615200579584f, -0.16570701053952f, -0.00666899972096f, -0.00190800003072f, 0.16212099596288f, 0.98676898791424f, 0.00276100022272f, 0.01710499954688f, 0.99985001545728f, 0.01053200023552f, 0.07339800264704f, 0.9972469465088f, -0.06604000329728f, 0.13006900559872f, 0.98930301861888f, -0.0944269950976f, 0.01659399962624f, 0.99539298025472f, -0.00920199954432f, 0.87150901067776f, 0.49029299830784f, -0.04860600123392f, 0.8406089859072f, 0.5394579587072f, -0.22329799213056f, 0.80288096976896f, 0.552739012608f, -0.59636497514496f, 0.55997095739392f, 0.57513500213248f, -0.80333697449984f, 0.06823500316672f, 0.59160297209856f, -0.01056000049152f, 0.99994396786688f, 0.00010300000256f, -0.05879800266752f, 0.9982699372544f, 0.0007089999872f, -0.28071000276992f, 0.95978703028224f, 0.00326799982592f, -0.7497230319616f, 0.66173798449152f, 0.00426700013568f, -0.997350965248f, 0.0727140007936f, 0.00205800013824f, -0.01056000049152f, 0.99994396786688f, 0.00010300000256f, -0.00879199977472f, 0.87149298843648f, -0.49032898543616f, -0.04649300000768f, 0.84117798518784f, -0.53875599998976f, -0.05879800266752f, 0.9982699372544f, 0.0007089999872f, -0.21790900355072f, 0.80680700608512f, -0.54916101963776f, -0.28071000276992f, 0.95978703028224f, 0.00326799982592f, -0.59729099358208f, 0.56002699329536f, -0.57411998056448f, -0.7497230319616f, 0.66173798449152f, 0.00426700013568f, -0.80400001007616f, 0.06291200147456f, -0.59129099976704f, -0.997350965248f, 0.0727140007936f, 0.00205800013824f, -0.00180500004864f, 0.1616909959168f, -0.986840039424f, 0.00203100012544f, 0.01455300018176f, -0.99989195849728f, 0.00921499992064f, 0.06006899736576f, -0.99815199342592f, -0.05933499940864f, 0.11386600030208f, -0.99172296425472f, -0.08690100338688f, 0.01229000015872f, -0.99614099243008f, 0.0064170000384f, -0.81237897117696f, -0.58309499420672f, 0.03378300059648f, -0.83751300235264f, -0.54537301786624f, 0.15711299698688f, -0.81194695786496f, -0.5621889892352f, 0.48440599904256f, -0.58936501731328f, -0.64652901875712f, 0.73887001870336f, -0.10131999817728f, -0.6661880152064f, 0.00778499981312f, -0.99997005643776f, -0.00021500000256f, 0.03913799958528f, -0.99923303333888f, -0.00098799992832f, 0.17951199592448f, -0.98374598524928f, -0.00436800028672f, 0.61229997490176f, -0.79055600746496f, -0.01045900034048f, 0.98615200579584f, -0.16570701053952f, -0.00666899972096f, 0.98615200579584f, -0.16570701053952f, -0.00666899972096f, 0.73872003039232f, -0.1145929990144f, 0.66419899236352f, 0.72560897163264f, 0.25935099199488f, 0.6373609832448f, 0.94651197423616f, 0.322649980928f, -0.00335700000768f, 0.64594500386816f, 0.46198798942208f, 0.60772000464896f, 0.82583002021888f, 0.56387002433536f, -0.007452000256f, 0.5316150296576f, 0.63665998921728f, 0.55861401616384f, 0.6500110041088f, 0.7598929608704f, -0.00693599993856f, 0.42496402915328f, 0.68171797102592f, 0.59553899085824f, 0.53242897629184f, 0.84645802672128f, -0.00524400001024f, -0.0944269950976f, 0.01659399962624f, 0.99539298025472f, -0.04956100231168f, -0.01975500013568f, 0.99857595367424f, -0.03781700091904f, -0.03562499997696f, 0.99864901844992f, -0.03791299805184f, -0.03651199827968f, 0.99861403795456f, -0.16885399683072f, -0.29794601271296f, 0.93953005191168f, -0.80333697449984f, 0.06823500316672f, 0.59160297209856f, -0.74234097303552f, -0.29916598894592f, 0.59952404103168f, -0.61960200650752f, -0.52940601556992f, 0.57950299226112f, -0.48370798297088f, -0.68576002179072f, 0.5438370217984f, -0.44529197514752f, -0.79435495636992f, 0.41317702828032f, -0.997350965248f, 0.0727140007936f, 0.00205800013824f, -0.92651302944768f, -0.37625700286464f, 0.00199500005376f, -0.75392002031616f, -0.65695203196928f, 0.00431700017152f, -0.56622399356928f, -0.82424398610432f, 0.00346100006912f, -0.48180402061312f, -0.87627701157888f, 0.00185000001536f, -0.997350965248f, 0.0727140007936f, 0.00205800013824f, -0.80400001007616f, 0.06291200147456f, -0.59129099976704f, -0.74467501932544f, -0.2944239927296f, -0.598977019904f, -0.92651302944768f, -0.37625700286464f, 0.00199500005376f, -0.6219490131968f, -0.52811400216576f, -0.57816500928512f, -0.75392002031616f, -0.65695203196928f, 0.00431700017152f, -0.48117101625344f, -0.6883400220672f, -0.54282804002816f, -0.56622399356928f, -0.82424398610432f, 0.00346100006912f, -0.4380549971968f, -0.79703494885376f, -0.4157440262144f, -0.48180402061312f, -0.87627701157888f, 0.00185000001536f, -0.08690100338688f, 0.01229000015872f, -0.99614099243008f, -0.04433799806976f, -0.0170559995904f, -0.99887106490368f, -0.02617699991552f, -0.02816700055552f, -0.99926004465664f, -0.02529300054016f, -0.02833200185344f, -0.99927799627776f, -0.15748200136704f, -0.28939300896768f, -0.94416702275584f, 0.73887001870336f, -0.10131999817728f, -0.6661880152064f, 0.7282440011776f, 0.25240998510592f, -0.63714199863296f, 0.6470540197888f, 0.45972499464192f, -0.6082550300672f, 0.52299397332992f, 0.64065699315712f, -0.56217003098112f, 0.40997799067648f, 0.68285697622016f, -0.60466898403328f, 0.98615200579584f, -0.16570701053952f, -0.00666899972096f, 0.94651197423616f, 0.322649980928f, -0.00335700000768f, 0.82583002021888f, 0.56387002433536f, -0.007452000256f, 0.6500110041088f, 0.7598929608704f, -0.00693599993856f, 0.53242897629184f, 0.84645802672128f, -0.00524400001024f, -0.23078698483712f, 0.97298197512192f, -0.00652299993088f, -0.15287799775232f, 0.68721095737344f, 0.71019003904f, -0.31672099667968f, 0.63775004688384f, 0.70211298394112f, -0.54893599522816f, 0.83586296315904f, -0.00151099998208f, -0.60106699964416f, 0.47145201696768f, 0.64532999307264f, -0.87567101853696f, 0.48280700452864f, 0.00989199990784f, -0.63588999888896f, 0.4460900253696f, 0.62980003725312f, -0.87755400937472f, 0.47909701681152f, 0.01909100118016f, -0.4357449842688f, 0.60100899241984f, 0.67000999084032f, -0.69618899091456f, 0.71743997739008f, 0.02449600151552f, 0.11111299547136f, -0.08506899955712f, 0.99015999881216f, 0.22330998784f, 0.00653999996928f, 0.9747260506112f, 0.19009701412864f, 0.15496400338944f, 0.9694580047872f, 0.00527000010752f, 0.18948200333312f, 0.98186995695616f, -0.01175099932672f, 0.24668700409856f, 0.96902397820928f, 0.3439059795968f, -0.72279501307904f, 0.59941201117184f, 0.572489990144f, -0.56765597089792f, 0.59162700546048f, 0.78743603249152f, -0.25646000504832f, 0.56051097403392f, 0.6470970114048f, -0.30637400522752f, 0.69814097805312f, 0.42752800718848f, -0.49934397079552f, 0.75357499686912f, 0.4109260292096f, -0.91166796152832f, 0.00128399998976f, 0.67151998222336f, -0.74098596118528f, -0.00089899999232f, 0.92202596302848f, -0.38705997807616f, -0.00725200011264f, 0.84691000492032f, -0.53155601580032f, -0.01385399975936f, 0.53592400592896f, -0.8442009878528f, -0.01050399997952f, 0.4109260292096f, -0.91166796152832f, 0.00128399998976f, 0.34118800769024f, -0.72282303102976f, -0.60093097836544f, 0.578664005632f, -0.56113898717184f, -0.59183802089472f, 0.67151998222336f, -0.74098596118528f, -0.00089899999232f, 0.78486903455744f, -0.25102001373184f, -0.5665420476416f, 0.92202596302848f, -0.38705997807616f, -0.00725200011264f, 0.64268099649536f, -0.30225700225024f, -0.7039900188672f, 0.84691000492032f, -0.53155601580032f, -0.01385399975936f, 0.41858898067456f, -0.50004202881024f, -0.75811700867072f, 0.53592400592896f, -0.8442009878528f, -0.01050399997952f, 0.11580600221696f, -0.07913900343296f, -0.99011394535424f, 0.23281100914688f, 0.01256499970048f, -0.972440993792f, 0.2066630049792f, 0.15360000524288f, -0.9662799806464f, 0.02449899782144f, 0.16144299720704f, -0.98657797931008f, 0.00338099994624f, 0.21111500701696f, -0.97745503256576f, -0.13491200065536f, 0.68749101105152f, -0.71355101872128f, -0.31953998839808f, 0.63307297849344f, -0.70506199908352f, -0.6039019716608f, 0.46144197492736f, -0.6499030007808f, -0.63181502283776f, 0.43716899241984f, -0.6400719716352f, -0.42430497816576f, 0.61270703210496f, -0.66675000999936f, -0.23078698483712f, 0.97298197512192f, -0.00652299993088f, -0.54893599522816f, 0.83586296315904f, -0.00151099998208f, -0.87567101853696f, 0.48280700452864f, 0.00989199990784f, -0.87755400937472f, 0.47909701681152f, 0.01909100118016f, -0.69618899091456f, 0.71743997739008f, 0.02449600151552f, -0.69618899091456f, 0.71743997739008f, 0.02449600151552f, -0.4357449842688f, 0.60100899241984f, 0.67000999084032f, -0.25985802043392f, 0.79193803063296f, 0.55254800400384f, -0.4257990311936f, 0.90475306418176f, 0.01080499961856f, 0.00953699991552f, 0.99971999203328f, -0.0216689999872f, 0.02204099936256f, 0.9997559791616f, 0.00162300002304f, 0.41015402561536f, 0.33291799363584f, -0.84908097667072f, 0.99959802167296f, 0.0258789998592f, 0.01155600089088f, 0.54152201764864f, -0.5486199963648f, -0.63700098613248f, 0.709586059264f, -0.70455197171712f, 0.009671000064f, -0.01175099932672f, 0.24668700409856f, 0.96902397820928f, 0.04631000252416f, 0.4552250097664f, 0.88917197979648f, -0.01068800016384f, 0.9887950045184f, 0.14889900834816f, -0.04437499707392f, 0.68294602129408f, -0.72912002351104f, 0.12282499170304f, 0.0092320006144f, -0.99238499319808f, 0.42752800718848f, -0.49934397079552f, 0.75357499686912f, 0.48183900110848f, -0.18044300558336f, 0.85747998654464f, 0.4552719859712f, 0.73675105632256f, 0.49992500772864f, -0.22054199885824f, 0.90719297470464f, -0.35827799293952f, -0.23591898841088f, 0.65724999532544f, -0.71579597799424f, 0.53592400592896f, -0.8442009878528f, -0.01050399997952f, 0.72809099296768f, -0.68530296848384f, -0.01558499950592f, 0.88873895985152f, 0.45810897125376f, -0.01667899981824f, -0.2600980185088f, 0.9655820484608f, 0.0008f, -0.37161101426688f, 0.92837798477824f, -0.00441699991552f, 0.53592400592896f, -0.8442009878528f, -0.01050399997952f, 0.41858898067456f, -0.50004202881024f, -0.75811700867072f, 0.48016501243904f, -0.1783629873152f, -0.858852950016f, 0.72809099296768f, -0.68530296848384f, -0.01558499950592f, 0.48810298441728f, 0.71680202375168f, -0.49794701590528f, 0.88873895985152f, 0.45810897125376f, -0.01667899981824f, -0.22200499306496f, 0.90539898699776f, 0.36189402824704f, -0.2600980185088f, 0.9655820484608f, 0.0008f, -0.23540399079424f, 0.66317998620672f, 0.71047701331968f, -0.37161101426688f, 0.92837798477824f, -0.00441699991552f, 0.00338099994624f, 0.21111500701696f, -0.97745503256576f, 0.05871900295168f, 0.43770301120512f, -0.89719996153856f, 0.00132499996672f, 0.98645902884864f, -0.16400000221184f, -0.04418900066304f, 0.68167502135296f, 0.73031900725248f, 0.13880200790016f, -0.03418900135936f, 0.98972999876608f, -0.42430497816576f, 0.61270703210496f, -0.66675000999936f, -0.25888898940928f, 0.79720599257088f, -0.54537897377792f, 0.01226799972352f, 0.99973895028736f, 0.01928500084736f, 0.3986300076032f, 0.35489297989632f, 0.84566303834112f, 0.53756397879296f, -0.58139902738432f, 0.6107370094592f, -0.69618899091456f, 0.71743997739008f, 0.02449600151552f, -0.4257990311936f, 0.90475306418176f, 0.01080499961856f, 0.02204099936256f, 0.9997559791616f, 0.00162300002304f, 0.99959802167296f, 0.0258789998592f, 0.01155600089088f, 0.709586059264f, -0.70455197171712f, 0.009671000064f, 0.0f, 1.00000000376832f, 0.0f, 0.0f, 1.00000000376832f, 0.0f, 0.76264098496512f, 0.5650339856384f, 0.31482500349952f, 0.82454002008064f, 0.5658030112768f, 0.000017f, 0.84798198513664f, -0.39799800987648f, 0.35003400454144f, 0.91770096451584f, -0.39727197585408f, 0.000033f, 0.86414096072704f, -0.35526002343936f, 0.3564420202496f, 0.935268974592f, -0.35393898545152f, 0.000112f, 0.7209920495616f, 0.62562502705152f, 0.29793301037056f, 0.78071197597696f, 0.62489098190848f, 0.00007500000256f, 0.0f, 1.00000000376832f, 0.0f, 0.58335697043456f, 0.56516497375232f, 0.58333801218048f, 0.64848499048448f, -0.39872597327872f, 0.6484479967232f, 0.66087198654464f, -0.35589399248896f, 0.6607480029184f, 0.5518630322176f, 0.62528801472512f, 0.5517799849984f, 0.0f, 1.00000000376832f, 0.0f, 0.31482500349952f, 0.56505101451264f, 0.76262898925568f, 0.35004499361792f, -0.39797603172352f, 0.8479880249344f, 0.35647402278912f, -0.35519899631616f, 0.8641520336896f, 0.29798199984128f, 0.62551496851456f, 0.72106704371712f, 0.0f, 1.00000000376832f, 0.0f, -0.000017f, 0.5658030112768f, 0.82454002008064f, -0.000033f, -0.39727197585408f, 0.91770096451584f, -0.000112f, -0.35393898545152f, 0.935268974592f, -0.00007500000256f, 0.62489001721856f, 0.78071197597696f, 0.0f, 1.00000000376832f, 0.0f, 0.0f, 1.00000000376832f, 0.0f, -0.31482500349952f, 0.5650339856384f, 0.76264098496512f, -0.000017f, 0.5658030112768f, 0.82454002008064f, -0.35003400454144f, -0.39799800987648f, 0.84798198513664f, -0.000033f, -0.39727197585408f, 0.91770096451584f, -0.3564420202496f, -0.35526002343936f, 0.86414096072704f, -0.000112f, -0.35393898545152f, 0.935268974592f, -0.29793301037056f, 0.62562502705152f, 0.7209920495616f, -0.00007500000256f, 0.62489001721856f, 0.78071197597696f, 0.0f, 1.00000000376832f, 0.0f, -0.58333801218048f, 0.56516497375232f, 0.58335697043456f, -0.6484479967232f, -0.39872597327872f, 0.64848499048448f, -0.6607480029184f, -0.35589399248896f, 0.66087198654464f, -0.5517799849984f, 0.62528801472512f, 0.5518630322176f, 0.0f, 1.00000000376832f, 0.0f, -0.76262898925568f, 0.56505101451264f, 0.31482500349952f, -0.8479880249344f, -0.39797603172352f, 0.35004499361792f, -0.8641520336896f, -0.35519899631616f, 0.35647402278912f, -0.72106704371712f, 0.62551496851456f, 0.29798199984128f, 0.0f, 1.00000000376832f, 0.0f, -0.82454002008064f, 0.5658030112768f, -0.000017f, -0.91770096451584f, -0.39727197585408f, -0.000033f, -0.935268974592f, -0.35393898545152f, -0.000112f, -0.78071197597696f, 0.62489001721856f, -0.00007500000256f, 0.0f, 1.00000000376832f, 0.0f, 0.0f, 1.00000000376832f, 0.0f, -0.76264098496512f, 0.5650339856384f, -0.31482500349952f, -0.82454002008064f, 0.5658030112768f, -0.000017f, -0.84798198513664f, -0.39799800987648f, -0.35003400454144f, -0.91770096451584f, -0.39727197585408f, -0.000033f, -0.86414096072704f, -0.35526002343936f, -0.3564420202496f, -0.935268974592f, -0.35393898545152f, -0.000112f, -0.7209920495616f, 0.62562502705152f, -0.29793301037056f, -0.78071197597696f, 0.62489001721856f, -0.00007500000256f, 0.0f, 1.00000000376832f, 0.0f, -0.58335697043456f, 0.56516497375232f, -0.58333801218048f, -0.64848499048448f, -0.39872597327872f, -0.6484479967232f, -0.66087198654464f, -0.35589399248896f, -0.6607480029184f, -0.5518630322176f, 0.62528801472512f, -0.5517799849984f, 0.0f, 1.00000000376832f, 0.0f, -0.31482500349952f, 0.56505101451264f, -0.76262898925568f, -0.35004499361792f, -0.39797603172352f, -0.8479880249344f, -0.35647402278912f, -0.35519899631616f, -0.8641520336896f, -0.29798199984128f, 0.62551496851456f, -0.72106704371712f, 0.0f, 1.00000000376832f, 0.0f, 0.000017f, 0.5658030112768f, -0.82454002008064f, 0.000033f, -0.39727197585408f, -0.91770096451584f, 0.000112f, -0.35393898545152f, -0.935268974592f, 0.00007500000256f, 0.62489001721856f, -0.78071197597696f, 0.0f, 1.00000000376832f, 0.0f, 0.0f, 1.00000000376832f, 0.0f, 0.31482500349952f, 0.5650339856384f, -0.76264098496512f, 0.000017f, 0.5658030112768f, -0.82454002008064f, 0.35003400454144f, -0.39799800987648f, -0.84798198513664f, 0.000033f, -0.39727197585408f, -0.91770096451584f, 0.3564420202496f, -0.35526002343936f, -0.86414096072704f, 0.000112f, -0.35393898545152f, -0.935268974592f, 0.29793301037056f, 0.62562502705152f, -0.7209920495616f, 0.00007500000256f, 0.62489001721856f, -0.78071197597696f, 0.0f, 1.00000000376832f, 0.0f, 0.58333801218048f, 0.56516497375232f, -0.58335697043456f, 0.6484479967232f, -0.39872597327872f, -0.64848499048448f, 0.6607480029184f, -0.35589399248896f, -0.66087198654464f, 0.5517799849984f, 0.62528801472512f, -0.5518630322176f, 0.0f, 1.00000000376832f, 0.0f, 0.76262898925568f, 0.56505101451264f, -0.31482500349952f, 0.8479880249344f, -0.39797603172352f, -0.35004499361792f, 0.8641520336896f, -0.35519899631616f, -0.35647402278912f, 0.72106704371712f, 0.62551496851456f, -0.29798199984128f, 0.0f, 1.00000000376832f, 0.0f, 0.82454002008064f, 0.5658030112768f, 0.000017f, 0.91770096451584f, -0.39727197585408f, 0.000033f, 0.935268974592f, -0.35393898545152f, 0.000112f, 0.78071197597696f, 0.62489098190848f, 0.00007500000256f, 0.78071197597696f, 0.62489098190848f, 0.00007500000256f, 0.7209920495616f, 0.62562502705152f, 0.29793301037056f, 0.21797799985152f, 0.97177502220288f, 0.09021600825344f, 0.23658298867712f, 0.97161102491648f, 0.0f, 0.15958898900992f, 0.98497701347328f, 0.06596100358144f, 0.17308400484352f, 0.98490696859648f, 0.0f, 0.35049799942144f, 0.92531194855424f, 0.14473999941632f, 0.379703001088f, 0.92510802149376f, 0.0f, 0.48558900248576f, 0.85065300180992f, 0.20147400081408f, 0.52667200045056f, 0.850067980288f, 0.0f, 0.5518630322176f, 0.62528801472512f, 0.5517799849984f, 0.1666309947392f, 0.97183802064896f, 0.1666309947392f, 0.12190800150528f, 0.985026002944f, 0.12190800150528f, 0.2676680032256f, 0.92558499774464f, 0.2676680032256f, 0.3713150222336f, 0.85102897922048f, 0.3713150222336f, 0.29798199984128f, 0.62551496851456f, 0.72106704371712f, 0.09021600825344f, 0.97177502220288f, 0.21797799985152f, 0.06596100358144f, 0.98497701347328f, 0.15958898900992f, 0.14473999941632f, 0.92531194855424f, 0.35049799942144f, 0.20147400081408f, 0.85065300180992f, 0.48558900248576f, -0.00007500000256f, 0.62489001721856f, 0.78071197597696f, 0.0f, 0.97161102491648f, 0.23658298867712f, 0.0f, 0.98490696859648f, 0.17308400484352f, 0.0f, 0.92510802149376f, 0.379703001088f, 0.0f, 0.850067980288f, 0.52667200045056f, -0.00007500000256f, 0.62489001721856f, 0.78071197597696f, -0.29793301037056f, 0.62562502705152f, 0.7209920495616f, -0.09021600825344f, 0.97177502220288f, 0.21797799985152f, 0.0f, 0.97161102491648f, 0.23658298867712f, -0.06596100358144f, 0.98497701347328f, 0.15958898900992f, 0.0f, 0.98490696859648f, 0.17308400484352f, -0.14473999941632f, 0.92531194855424f, 0.35049799942144f, 0.0f, 0.92510802149376f, 0.379703001088f, -0.20147400081408f, 0.85065300180992f, 0.48558900248576f, 0.0f, 0.850067980288f, 0.52667200045056f, -0.5517799849984f, 0.62528801472512f, 0.5518630322176f, -0.1666309947392f, 0.97183802064896f, 0.1666309947392f, -0.12190800150528f, 0.985026002944f, 0.12190800150528f, -0.2676680032256f, 0.92558499774464f, 0.2676680032256f, -0.3713150222336f, 0.85102897922048f, 0.3713150222336f, -0.72106704371712f, 0.62551496851456f, 0.29798199984128f, -0.21797799985152f, 0.97177502220288f, 0.09021600825344f, -0.15958898900992f, 0.98497701347328f, 0.06596100358144f, -0.35049799942144f, 0.92531194855424f, 0.14473999941632f, -0.48558900248576f, 0.85065300180992f, 0.20147400081408f, -0.78071197597696f, 0.62489001721856f, -0.00007500000256f, -0.23658298867712f, 0.97161102491648f, 0.0f, -0.17308400484352f, 0.98490696859648f, 0.0f, -0.379703001088f, 0.92510802149376f, 0.0f, -0.52667200045056f, 0.850067980288f, 0.0f, -0.78071197597696f, 0.62489001721856f, -0.00007500000256f, -0.7209920495616f, 0.62562502705152f, -0.29793301037056f, -0.21797799985152f, 0.97177502220288f, -0.09021600825344f, -0.23658298867712f, 0.97161102491648f, 0.0f, -0.15958898900992f, 0.98497701347328f, -0.06596100358144f, -0.17308400484352f, 0.98490696859648f, 0.0f, -0.35049799942144f, 0.92531194855424f, -0.14473999941632f, -0.379703001088f, 0.92510802149376f, 0.0f, -0.48558900248576f, 0.85065300180992f, -0.20147400081408f, -0.52667200045056f, 0.850067980288f, 0.0f, -0.5518630322176f, 0.62528801472512f, -0.5517799849984f, -0.1666309947392f, 0.97183802064896f, -0.1666309947392f, -0.12190800150528f, 0.985026002944f, -0.12190800150528f, -0.2676680032256f, 0.92558499774464f, -0.2676680032256f, -0.3713150222336f, 0.85102897922048f, -0.3713150222336f, -0.29798199984128f, 0.62551496851456f, -0.72106704371712f, -0.09021600825344f, 0.97177502220288f, -0.21797799985152f, -0.06596100358144f, 0.98497701347328f, -0.15958898900992f, -0.14473999941632f, 0.92531194855424f, -0.35049799942144f, -0.20147400081408f, 0.85065300180992f, -0.48558900248576f, 0.00007500000256f, 0.62489001721856f, -0.78071197597696f, 0.0f, 0.97161102491648f, -0.23658298867712f, 0.0f, 0.98490696859648f, -0.17308400484352f, 0.0f, 0.92510802149376f, -0.379703001088f, 0.0f, 0.850067980288f, -0.52667200045056f, 0.00007500000256f, 0.62489001721856f, -0.78071197597696f, 0.29793301037056f, 0.62562502705152f, -0.7209920495616f, 0.09021600825344f, 0.97177502220288f, -0.21797799985152f, 0.0f, 0.97161102491648f, -0.23658298867712f, 0.06596100358144f, 0.98497701347328f, -0.15958898900992f, 0.0f, 0.98490696859648f, -0.17308400484352f, 0.14473999941632f, 0.92531194855424f, -0.35049799942144f, 0.0f, 0.92510802149376f, -0.379703001088f, 0.20147400081408f, 0.85065300180992f, -0.48558900248576f, 0.0f, 0.850067980288f, -0.52667200045056f, 0.5517799849984f, 0.62528801472512f, -0.5518630322176f, 0.1666309947392f, 0.97183802064896f, -0.1666309947392f, 0.12190800150528f, 0.985026002944f, -0.12190800150528f, 0.2676680032256f, 0.92558499774464f, -0.2676680032256f, 0.3713150222336f, 0.85102897922048f, -0.3713150222336f, 0.72106704371712f, 0.62551496851456f, -0.29798199984128f, 0.21797799985152f, 0.97177502220288f, -0.09021600825344f, 0.15958898900992f, 0.98497701347328f, -0.06596100358144f, 0.35049799942144f, 0.92531194855424f, -0.14473999941632f, 0.48558900248576f, 0.85065300180992f, -0.20147400081408f, 0.78071197597696f, 0.62489098190848f, 0.00007500000256f, 0.23658298867712f, 0.97161102491648f, 0.0f, 0.17308400484352f, 0.98490696859648f, 0.0f, 0.379703001088f, 0.92510802149376f, 0.0f, 0.52667200045056f, 0.850067980288f, 0.0f };
 
-  inline static const float tangents[] = { 0.01289799991296f, -0.0487570014208f, -0.99872703250432f, 0.38619100217344f, -0.01642200039424f, -0.92100800544768f, 0.38136398741504f, 0.00015599998976f, -0.92300894011392f, 0.01286700007424f, 0.0487020036096f, -0.99872996851712f, 0.3750789906432f, -0.00071699996672f, -0.906170990592f, 0.1921010106368f, 0.01775900033024f, -0.98121396781056f, 0.37826200600576f, -0.00011299999744f, -0.91429401526272f, 0.10451499876352f, -0.0974749958144f, -0.98973503193088f, 0.3655939915776f, 0.02846300045312f, -0.92571904770048f, 0.04767199789056f, -0.08423799783424f, -0.9953049837568f, 0.70926796324864f, -0.01636400103424f, -0.70311999438848f, 0.70619899101184f, 0.0f, -0.70619899101184f, 0.69373603610624f, 0.0f, -0.69373603610624f, 0.69977700827136f, 0.0f, -0.69977700827136f, 0.69240300240896f, 0.02822900023296f, -0.71508596621312f, 0.92435405340672f, -0.0165779996672f, -0.37810400657408f, 0.92300894011392f, -0.00015599998976f, -0.38136398741504f, 0.906170990592f, 0.00071699996672f, -0.3750789906432f, 0.91429401526272f, 0.00011299999744f, -0.37826200600576f, 0.91336598355968f, 0.02849100005376f, -0.3954440142848f, 0.9987040477184f, 0.0483699982336f, -0.0158530011136f, 0.99873701494784f, -0.04807000064f, -0.014648999936f, 0.98121497444352f, -0.01753999998976f, -0.19211701190656f, 0.98973503193088f, 0.09745799839744f, -0.10452800110592f, 0.9953049837568f, 0.08423799783424f, -0.04767199789056f, 0.99881796501504f, -0.0476000026624f, 0.00975899983872f, 0.90946796519424f, -0.01263700017152f, 0.40958397775872f, 0.92400902995968f, -0.0003150000128f, 0.38115100065792f, 0.99878902431744f, 0.04801800175616f, 0.01066300014592f, 0.90722694856704f, 0.02073100025856f, 0.3714230255616f, 0.98143500763136f, 0.01795700031488f, 0.19095200202752f, 0.91487006097408f, -0.00114800001024f, 0.37714401427456f, 0.98974904090624f, -0.09742700249088f, 0.10442499948544f, 0.92581602000896f, 0.0283079999488f, 0.36539501379584f, 0.9953049837568f, -0.08423799783424f, 0.04767199789056f, 0.67689301147648f, -0.01988700012544f, 0.73140298317824f, 0.69946201604096f, -0.00029799999488f, 0.71451403091968f, 0.69405899751424f, 0.01556000014336f, 0.69339801714688f, 0.70025801105408f, -0.00078399995904f, 0.6996300398592f, 0.71514200211456f, 0.02807899881472f, 0.69238698016768f, 0.35193599557632f, -0.0198439993344f, 0.93390003765248f, 0.3665400168448f, -0.00052100001792f, 0.9298419646464f, 0.37116901851136f, 0.00152299995136f, 0.90848305872896f, 0.3776480018432f, -0.00011000000512f, 0.91476503560192f, 0.39533697564672f, 0.02841099894784f, 0.91343502180352f, 0.00132100005888f, 0.04583099727872f, 0.99894798843904f, 0.00389700026368f, -0.04690299846656f, 0.99889102979072f, 0.18706000248832f, -0.0188180004864f, 0.9821629710336f, 0.1036399935488f, 0.09715500187648f, 0.98985800892416f, 0.04757700214784f, 0.08418800173056f, 0.9953129529344f, -0.0229669994496f, -0.04599199563776f, 0.9986780430336f, -0.38619100217344f, -0.01642200039424f, 0.92100800544768f, -0.38136398741504f, 0.00015599998976f, 0.92300894011392f, -0.02043100135424f, 0.0461440024576f, 0.99872602587136f, -0.3750789906432f, -0.00071699996672f, 0.906170990592f, -0.19216600137728f, 0.01677200064512f, 0.98121900097536f, -0.37826200600576f, -0.00011299999744f, 0.91429401526272f, -0.1047120052224f, -0.09722500481024f, 0.98973897457664f, -0.3655939915776f, 0.02846300045312f, 0.92571904770048f, -0.04771099967488f, -0.0842069966848f, 0.9953049837568f, -0.70926796324864f, -0.01636400103424f, 0.70311999438848f, -0.70619899101184f, 0.0f, 0.70619899101184f, -0.69373603610624f, 0.0f, 0.69373603610624f, -0.69977700827136f, 0.0f, 0.69977700827136f, -0.69240300240896f, 0.02822900023296f, 0.71508596621312f, -0.92435405340672f, -0.0165779996672f, 0.37810400657408f, -0.92300894011392f, -0.00015599998976f, 0.38136398741504f, -0.906170990592f, 0.00071699996672f, 0.3750789906432f, -0.91429401526272f, 0.00011299999744f, 0.37826200600576f, -0.91336598355968f, 0.02849100005376f, 0.3954440142848f, -0.99872703250432f, 0.0487570014208f, 0.01289799991296f, -0.99872996851712f, -0.0487020036096f, 0.01286700007424f, -0.98121396781056f, -0.01775900033024f, 0.1921010106368f, -0.98973503193088f, 0.0974749958144f, 0.10451499876352f, -0.9953049837568f, 0.08423799783424f, 0.04767199789056f, -0.99872703250432f, -0.0487570014208f, -0.01289799991296f, -0.92100800544768f, -0.01642200039424f, -0.38619100217344f, -0.92300894011392f, 0.00015599998976f, -0.38136398741504f, -0.99872996851712f, 0.0487020036096f, -0.01286700007424f, -0.906170990592f, -0.00071699996672f, -0.3750789906432f, -0.98121396781056f, 0.01775900033024f, -0.1921010106368f, -0.91429401526272f, -0.00011299999744f, -0.37826200600576f, -0.98973503193088f, -0.0974749958144f, -0.10451499876352f, -0.92571904770048f, 0.02846300045312f, -0.3655939915776f, -0.9953049837568f, -0.08423799783424f, -0.04767199789056f, -0.70311999438848f, -0.01636400103424f, -0.70926796324864f, -0.70619899101184f, 0.0f, -0.70619899101184f, -0.69373603610624f, 0.0f, -0.69373603610624f, -0.69977700827136f, 0.0f, -0.69977700827136f, -0.71508596621312f, 0.02822900023296f, -0.69240300240896f, -0.37810400657408f, -0.0165779996672f, -0.92435405340672f, -0.38136398741504f, -0.00015599998976f, -0.92300894011392f, -0.3750789906432f, 0.00071699996672f, -0.906170990592f, -0.37826200600576f, 0.00011299999744f, -0.91429401526272f, -0.3954440142848f, 0.02849100005376f, -0.91336598355968f, -0.01289799991296f, 0.0487570014208f, -0.99872703250432f, -0.01286700007424f, -0.0487020036096f, -0.99872996851712f, -0.1921010106368f, -0.01775900033024f, -0.98121396781056f, -0.10451499876352f, 0.0974749958144f, -0.98973503193088f, -0.04767199789056f, 0.08423799783424f, -0.9953049837568f, 0.04767199789056f, -0.08423799783424f, -0.9953049837568f, 0.3954440142848f, -0.02849100005376f, -0.91336598355968f, 0.38111698485248f, -0.000016f, -0.92101899452416f, 0.03192299978752f, -0.07255599611904f, -0.99685301747712f, 0.38152999796736f, 0.000002f, -0.9219080192f, 0.02226199986176f, -0.06237399810048f, -0.99780395008f, 0.38213901090816f, 0.000017f, -0.9231889596416f, 0.0083179995136f, -0.03964800073728f, -0.99917901070336f, 0.3822889992192f, -0.00443000029184f, -0.92394695426048f, 0.00086599999488f, 0.01304900009984f, -0.99991402053632f, 0.71508596621312f, -0.02822900023296f, -0.69240300240896f, 0.7048519483392f, 0.0f, -0.7048519483392f, 0.70553301942272f, 0.0f, -0.70553301942272f, 0.70651800977408f, 0.0f, -0.70651800977408f, 0.70683904180224f, -0.00437999992832f, -0.70725201297408f, 0.92571904770048f, -0.02846300045312f, -0.3655939915776f, 0.9210179878912f, 0.000016f, -0.38111698485248f, 0.9219080192f, -0.000002f, -0.38152999796736f, 0.9231889596416f, -0.000017f, -0.38213901090816f, 0.92372297842688f, -0.00439999987712f, -0.38283199381504f, 0.9953049837568f, 0.08423799783424f, -0.04767199789056f, 0.99685301747712f, 0.07255599611904f, -0.03192299978752f, 0.99780395008f, 0.06237399810048f, -0.02226199986176f, 0.99917901070336f, 0.03964800073728f, -0.0083179995136f, 0.99991402053632f, -0.01304900009984f, -0.00086599999488f, 0.9953049837568f, -0.08423799783424f, 0.04767199789056f, 0.91350003351552f, -0.02861100171264f, 0.39516198928384f, 0.92101899452416f, -0.000016f, 0.38111698485248f, 0.99685301747712f, -0.07255599611904f, 0.03192299978752f, 0.9219080192f, 0.000002f, 0.38152999796736f, 0.99780395008f, -0.06237399810048f, 0.02226199986176f, 0.9231889596416f, 0.000017f, 0.38213901090816f, 0.99917901070336f, -0.03964800073728f, 0.0083179995136f, 0.92394695426048f, -0.00443000029184f, 0.3822889992192f, 0.99991402053632f, 0.01304900009984f, 0.00086599999488f, 0.69258998448128f, -0.02826200154112f, 0.71493698453504f, 0.7048519483392f, 0.0f, 0.7048519483392f, 0.70553301942272f, 0.0f, 0.70553301942272f, 0.70651800977408f, 0.0f, 0.70651800977408f, 0.70725201297408f, -0.00437999992832f, 0.70683904180224f, 0.36561001381888f, -0.02841299910656f, 0.92572802351104f, 0.38111698485248f, 0.000016f, 0.9210179878912f, 0.38152999796736f, -0.000002f, 0.9219080192f, 0.38213901090816f, -0.000017f, 0.9231889596416f, 0.38283199381504f, -0.00439999987712f, 0.92372297842688f, 0.04757700214784f, 0.08418800173056f, 0.9953129529344f, 0.03192299978752f, 0.07255599611904f, 0.99685301747712f, 0.02226199986176f, 0.06237399810048f, 0.99780395008f, 0.0083179995136f, 0.03964800073728f, 0.99917901070336f, 0.00086599999488f, -0.01304900009984f, 0.99991402053632f, -0.04771099967488f, -0.0842069966848f, 0.9953049837568f, -0.3954440142848f, -0.02849100005376f, 0.91336598355968f, -0.38111698485248f, -0.000016f, 0.92101899452416f, -0.03192299978752f, -0.07255599611904f, 0.99685301747712f, -0.38152999796736f, 0.000002f, 0.9219080192f, -0.02226199986176f, -0.06237399810048f, 0.99780395008f, -0.38213901090816f, 0.000017f, 0.9231889596416f, -0.0083179995136f, -0.03964800073728f, 0.99917901070336f, -0.3822889992192f, -0.00443000029184f, 0.92394695426048f, -0.00086599999488f, 0.01304900009984f, 0.99991402053632f, -0.71508596621312f, -0.02822900023296f, 0.69240300240896f, -0.7048519483392f, 0.0f, 0.7048519483392f, -0.70553301942272f, 0.0f, 0.70553301942272f, -0.70651800977408f, 0.0f, 0.70651800977408f, -0.70683904180224f, -0.00437999992832f, 0.70725201297408f, -0.92571904770048f, -0.02846300045312f, 0.3655939915776f, -0.9210179878912f, 0.000016f, 0.38111698485248f, -0.9219080192f, -0.000002f, 0.38152999796736f, -0.9231889596416f, -0.000017f, 0.38213901090816f, -0.92372297842688f, -0.00439999987712f, 0.38283199381504f, -0.9953049837568f, 0.08423799783424f, 0.04767199789056f, -0.99685301747712f, 0.07255599611904f, 0.03192299978752f, -0.99780395008f, 0.06237399810048f, 0.02226199986176f, -0.99917901070336f, 0.03964800073728f, 0.0083179995136f, -0.99991402053632f, -0.01304900009984f, 0.00086599999488f, -0.9953049837568f, -0.08423799783424f, -0.04767199789056f, -0.91336598355968f, -0.02849100005376f, -0.3954440142848f, -0.92101899452416f, -0.000016f, -0.38111698485248f, -0.99685301747712f, -0.07255599611904f, -0.03192299978752f, -0.9219080192f, 0.000002f, -0.38152999796736f, -0.99780395008f, -0.06237399810048f, -0.02226199986176f, -0.9231889596416f, 0.000017f, -0.38213901090816f, -0.99917901070336f, -0.03964800073728f, -0.0083179995136f, -0.92394695426048f, -0.00443000029184f, -0.3822889992192f, -0.99991402053632f, 0.01304900009984f, -0.00086599999488f, -0.69240300240896f, -0.02822900023296f, -0.71508596621312f, -0.7048519483392f, 0.0f, -0.7048519483392f, -0.70553301942272f, 0.0f, -0.70553301942272f, -0.70651800977408f, 0.0f, -0.70651800977408f, -0.70725201297408f, -0.00437999992832f, -0.70683904180224f, -0.3655939915776f, -0.02846300045312f, -0.92571904770048f, -0.38111698485248f, 0.000016f, -0.9210179878912f, -0.38152999796736f, -0.000002f, -0.9219080192f, -0.38213901090816f, -0.000017f, -0.9231889596416f, -0.38283199381504f, -0.00439999987712f, -0.92372297842688f, -0.04767199789056f, 0.08423799783424f, -0.9953049837568f, -0.03192299978752f, 0.07255599611904f, -0.99685301747712f, -0.02226199986176f, 0.06237399810048f, -0.99780395008f, -0.0083179995136f, 0.03964800073728f, -0.99917901070336f, -0.00086599999488f, -0.01304900009984f, -0.99991402053632f, 0.00086599999488f, 0.01304900009984f, -0.99991402053632f, 0.38283199381504f, 0.00439999987712f, -0.92372297842688f, 0.38101502132224f, -0.00003899999744f, -0.9204739866624f, 0.0373130002432f, 0.07712400211968f, -0.99632302522368f, 0.37877199142912f, 0.000084f, -0.91548796583936f, 0.09151099961344f, 0.09763299524608f, -0.99100598992896f, 0.37838800289792f, 0.0001f, -0.91457494974464f, 0.10134600286208f, 0.09767599734784f, -0.99004499099648f, 0.35679597756416f, -0.03188200046592f, -0.92665102204928f, 0.07246600208384f, 0.09463200219136f, -0.99287094525952f, 0.70725201297408f, 0.00437999992832f, -0.70683904180224f, 0.70447395766272f, 0.0f, -0.70447395766272f, 0.70067899334656f, 0.0f, -0.70067899334656f, 0.69999301492736f, 0.0f, -0.69999301492736f, 0.68478203592704f, -0.03168000016384f, -0.71923102908416f, 0.92394695426048f, 0.00443000029184f, -0.3822889992192f, 0.9204739866624f, 0.00003899999744f, -0.38101502132224f, 0.91548796583936f, -0.000084f, -0.37877199142912f, 0.91457494974464f, -0.0001f, -0.37838800289792f, 0.907875975168f, -0.03206300041216f, -0.40216198905856f, 0.99991402053632f, -0.01304900009984f, -0.00086599999488f, 0.99632302522368f, -0.07712400211968f, -0.0373130002432f, 0.99100598992896f, -0.09763299524608f, -0.09151099961344f, 0.99004499099648f, -0.09767599734784f, -0.10134600286208f, 0.99287094525952f, -0.09463200219136f, -0.07246600208384f, 0.99991402053632f, 0.01304900009984f, 0.00086599999488f, 0.92372297842688f, 0.00439999987712f, 0.38283199381504f, 0.9204739866624f, -0.00003899999744f, 0.38101502132224f, 0.99632302522368f, 0.07712400211968f, 0.0373130002432f, 0.91548796583936f, 0.000084f, 0.37877199142912f, 0.99100598992896f, 0.09763299524608f, 0.09151099961344f, 0.91457494974464f, 0.0001f, 0.37838800289792f, 0.99004499099648f, 0.09767599734784f, 0.10134600286208f, 0.92665102204928f, -0.03188200046592f, 0.35679597756416f, 0.99287094525952f, 0.09463200219136f, 0.07246600208384f, 0.70683904180224f, 0.00437999992832f, 0.70725201297408f, 0.70447395766272f, 0.0f, 0.70447395766272f, 0.70067899334656f, 0.0f, 0.70067899334656f, 0.69999301492736f, 0.0f, 0.69999301492736f, 0.71923102908416f, -0.03168000016384f, 0.68478203592704f, 0.3822889992192f, 0.00443000029184f, 0.92394695426048f, 0.38101502132224f, 0.00003899999744f, 0.9204739866624f, 0.37877199142912f, -0.000084f, 0.91548796583936f, 0.37838800289792f, -0.0001f, 0.91457494974464f, 0.40216198905856f, -0.03206300041216f, 0.907875975168f, 0.00086599999488f, -0.01304900009984f, 0.99991402053632f, 0.0373130002432f, -0.07712400211968f, 0.99632302522368f, 0.09151099961344f, -0.09763299524608f, 0.99100598992896f, 0.10134600286208f, -0.09767599734784f, 0.99004499099648f, 0.07246600208384f, -0.09463200219136f, 0.99287094525952f, -0.00086599999488f, 0.01304900009984f, 0.99991402053632f, -0.38283199381504f, 0.00439999987712f, 0.92372297842688f, -0.38101502132224f, -0.00003899999744f, 0.9204739866624f, -0.0373130002432f, 0.07712400211968f, 0.99632302522368f, -0.37877199142912f, 0.000084f, 0.91548796583936f, -0.09151099961344f, 0.09763299524608f, 0.99100598992896f, -0.37838800289792f, 0.0001f, 0.91457494974464f, -0.10134600286208f, 0.09767599734784f, 0.99004499099648f, -0.35679597756416f, -0.03188200046592f, 0.92665102204928f, -0.07246600208384f, 0.09463200219136f, 0.99287094525952f, -0.70725201297408f, 0.00437999992832f, 0.70683904180224f, -0.70447395766272f, 0.0f, 0.70447395766272f, -0.70067899334656f, 0.0f, 0.70067899334656f, -0.69999301492736f, 0.0f, 0.69999301492736f, -0.68478203592704f, -0.03168000016384f, 0.71923102908416f, -0.92394695426048f, 0.00443000029184f, 0.3822889992192f, -0.9204739866624f, 0.00003899999744f, 0.38101502132224f, -0.91548796583936f, -0.000084f, 0.37877199142912f, -0.91457494974464f, -0.0001f, 0.37838800289792f, -0.907875975168f, -0.03206300041216f, 0.40216198905856f, -0.99991402053632f, -0.01304900009984f, 0.00086599999488f, -0.99632302522368f, -0.07712400211968f, 0.0373130002432f, -0.99100598992896f, -0.09763299524608f, 0.09151099961344f, -0.99004499099648f, -0.09767599734784f, 0.10134600286208f, -0.99287094525952f, -0.09463200219136f, 0.07246600208384f, -0.99991402053632f, 0.01304900009984f, -0.00086599999488f, -0.92372297842688f, 0.00439999987712f, -0.38283199381504f, -0.9204739866624f, -0.00003899999744f, -0.38101502132224f, -0.99632302522368f, 0.07712400211968f, -0.0373130002432f, -0.91548796583936f, 0.000084f, -0.37877199142912f, -0.99100598992896f, 0.09763299524608f, -0.09151099961344f, -0.91457494974464f, 0.0001f, -0.37838800289792f, -0.99004499099648f, 0.09767599734784f, -0.10134600286208f, -0.92665102204928f, -0.03188200046592f, -0.35679597756416f, -0.99287094525952f, 0.09463200219136f, -0.07246600208384f, -0.70683904180224f, 0.00437999992832f, -0.70725201297408f, -0.70447395766272f, 0.0f, -0.70447395766272f, -0.70067899334656f, 0.0f, -0.70067899334656f, -0.69999301492736f, 0.0f, -0.69999301492736f, -0.71923102908416f, -0.03168000016384f, -0.68478203592704f, -0.3822889992192f, 0.00443000029184f, -0.92394695426048f, -0.38101502132224f, 0.00003899999744f, -0.9204739866624f, -0.37877199142912f, -0.000084f, -0.91548796583936f, -0.37838800289792f, -0.0001f, -0.91457494974464f, -0.40216198905856f, -0.03206300041216f, -0.907875975168f, -0.00086599999488f, -0.01304900009984f, -0.99991402053632f, -0.0373130002432f, -0.07712400211968f, -0.99632302522368f, -0.09151099961344f, -0.09763299524608f, -0.99100598992896f, -0.10134600286208f, -0.09767599734784f, -0.99004499099648f, -0.07246600208384f, -0.09463200219136f, -0.99287094525952f, 0.07246600208384f, 0.09463200219136f, -0.99287094525952f, 0.40216198905856f, 0.03206300041216f, -0.907875975168f, 0.37766800867328f, 0.0001809999872f, -0.91295804555264f, 0.11919300755456f, 0.09514499702784f, -0.98830200602624f, 0.37516002459648f, 0.000168f, -0.90660795318272f, 0.18773398519808f, 0.033819000832f, -0.98163801194496f, 0.28234299211776f, -0.16822500851712f, -0.76754999836672f, 0.12883399278592f, -0.32698601046016f, -0.6540689932288f, 0.06457000460288f, -0.6666670047232f, -0.32701899866112f, 0.0f, -1.00000000376832f, 0.0f, 0.71923203571712f, 0.03168000016384f, -0.68478203592704f, 0.69876299333632f, 0.0f, -0.69876299333632f, 0.69403500609536f, 0.0f, -0.69403500609536f, 0.55519901384704f, -0.16825300549632f, -0.60089599787008f, 0.18540300075008f, -0.6666670047232f, -0.27701398208512f, 0.92665001541632f, 0.03188200046592f, -0.35679501287424f, 0.91295804555264f, -0.0001809999872f, -0.37766800867328f, 0.90660795318272f, -0.000168f, -0.37516002459648f, 0.74260596916224f, -0.16831800672256f, -0.34261600043008f, 0.27701398208512f, -0.6666670047232f, -0.18540300075008f, 0.99287094525952f, -0.09463200219136f, -0.07246600208384f, 0.98830200602624f, -0.09514499702784f, -0.11919300755456f, 0.981637005312f, -0.033819000832f, -0.18773398519808f, 0.98110298652672f, -0.00951999987712f, -0.19325199056896f, 0.49052901179392f, -0.50000000188416f, -0.09685600043008f, 0.99287094525952f, 0.09463200219136f, 0.07246600208384f, 0.907875975168f, 0.03206300041216f, 0.40216198905856f, 0.91295804555264f, 0.0001809999872f, 0.37766800867328f, 0.98830200602624f, 0.09514499702784f, 0.11919300755456f, 0.90660795318272f, 0.000168f, 0.37516002459648f, 0.98163801194496f, 0.033819000832f, 0.18773398519808f, 0.76754999836672f, -0.16822500851712f, 0.28234299211776f, 0.6540689932288f, -0.32698601046016f, 0.12883399278592f, 0.32701899866112f, -0.6666670047232f, 0.06457000460288f, 0.0f, -1.00000000376832f, 0.0f, 0.68478203592704f, 0.03168000016384f, 0.71923203571712f, 0.69876299333632f, 0.0f, 0.69876299333632f, 0.69403500609536f, 0.0f, 0.69403500609536f, 0.60089599787008f, -0.16825300549632f, 0.55519901384704f, 0.27701398208512f, -0.6666670047232f, 0.18540300075008f, 0.35679501287424f, 0.03188200046592f, 0.92665001541632f, 0.37766800867328f, -0.0001809999872f, 0.91295804555264f, 0.37516002459648f, -0.000168f, 0.90660795318272f, 0.34261600043008f, -0.16831800672256f, 0.74260596916224f, 0.18540300075008f, -0.6666670047232f, 0.27701398208512f, 0.07246600208384f, -0.09463200219136f, 0.99287094525952f, 0.11919300755456f, -0.09514499702784f, 0.98830200602624f, 0.18773398519808f, -0.033819000832f, 0.981637005312f, 0.19325199056896f, -0.00951999987712f, 0.98110298652672f, 0.09685600043008f, -0.50000000188416f, 0.49052901179392f, -0.07246600208384f, 0.09463200219136f, 0.99287094525952f, -0.40216198905856f, 0.03206300041216f, 0.907875975168f, -0.37766800867328f, 0.0001809999872f, 0.91295804555264f, -0.11919300755456f, 0.09514499702784f, 0.98830200602624f, -0.37516002459648f, 0.000168f, 0.90660795318272f, -0.18773398519808f, 0.033819000832f, 0.98163801194496f, -0.28234299211776f, -0.16822500851712f, 0.76754999836672f, -0.12883399278592f, -0.32698601046016f, 0.6540689932288f, -0.06457000460288f, -0.6666670047232f, 0.32701899866112f, 0.0f, -1.00000000376832f, 0.0f, -0.71923203571712f, 0.03168000016384f, 0.68478203592704f, -0.69876299333632f, 0.0f, 0.69876299333632f, -0.69403500609536f, 0.0f, 0.69403500609536f, -0.55519901384704f, -0.16825300549632f, 0.60089599787008f, -0.18540300075008f, -0.6666670047232f, 0.27701398208512f, -0.92665001541632f, 0.03188200046592f, 0.35679501287424f, -0.91295804555264f, -0.0001809999872f, 0.37766800867328f, -0.90660795318272f, -0.000168f, 0.37516002459648f, -0.74260596916224f, -0.16831800672256f, 0.34261600043008f, -0.27701398208512f, -0.6666670047232f, 0.18540300075008f, -0.99287094525952f, -0.09463200219136f, 0.07246600208384f, -0.98830200602624f, -0.09514499702784f, 0.11919300755456f, -0.981637005312f, -0.033819000832f, 0.18773398519808f, -0.98110298652672f, -0.00951999987712f, 0.19325199056896f, -0.49052901179392f, -0.50000000188416f, 0.09685600043008f, -0.99287094525952f, 0.09463200219136f, -0.07246600208384f, -0.907875975168f, 0.03206300041216f, -0.40216198905856f, -0.91295804555264f, 0.0001809999872f, -0.37766800867328f, -0.98830200602624f, 0.09514499702784f, -0.11919300755456f, -0.90660795318272f, 0.000168f, -0.37516002459648f, -0.98163801194496f, 0.033819000832f, -0.18773398519808f, -0.76754999836672f, -0.16822500851712f, -0.28234299211776f, -0.6540689932288f, -0.32698601046016f, -0.12883399278592f, -0.32701899866112f, -0.6666670047232f, -0.06457000460288f, 0.0f, -1.00000000376832f, 0.0f, -0.68478203592704f, 0.03168000016384f, -0.71923203571712f, -0.69876299333632f, 0.0f, -0.69876299333632f, -0.69403500609536f, 0.0f, -0.69403500609536f, -0.60089599787008f, -0.16825300549632f, -0.55519901384704f, -0.27701398208512f, -0.6666670047232f, -0.18540300075008f, -0.35679501287424f, 0.03188200046592f, -0.92665001541632f, -0.37766800867328f, -0.0001809999872f, -0.91295804555264f, -0.37516002459648f, -0.000168f, -0.90660795318272f, -0.34261600043008f, -0.16831800672256f, -0.74260596916224f, -0.18540300075008f, -0.6666670047232f, -0.27701398208512f, -0.07246600208384f, -0.09463200219136f, -0.99287094525952f, -0.11919300755456f, -0.09514499702784f, -0.98830200602624f, -0.18773398519808f, -0.033819000832f, -0.981637005312f, -0.19325199056896f, -0.00951999987712f, -0.98110298652672f, -0.09685600043008f, -0.50000000188416f, -0.49052901179392f, -0.00659799998464f, 0.00016300000256f, -0.99616800374784f, -0.04390800064512f, -0.55936597098496f, -0.77912602574848f, 0.23287899881472f, -0.5065349791744f, -0.7927100342272f, 0.11139900506112f, 0.0053449998336f, -0.99233298382848f, 0.45219202465792f, -0.42180202725376f, -0.7370990157824f, 0.17797799215104f, 0.03684100210688f, -0.98279706591232f, 0.60753797185536f, -0.2707980025856f, -0.7066869563392f, 0.1189470011392f, 0.10517800288256f, -0.98648293638144f, 0.65837197164544f, -0.06727500038144f, -0.74384697982976f, 0.00106299998208f, 0.04653399932928f, -0.99891594395648f, -0.16229900222464f, -0.9069570031616f, 0.14869500788736f, 0.3020159975424f, -0.88471200858112f, 0.01430099984384f, 0.70486402793472f, -0.67880200699904f, 0.0425149988864f, 0.89485199015936f, -0.38824600141824f, 0.11077999919104f, 0.9622920364032f, -0.14349601079296f, 0.09367900389376f, -0.12511900336128f, -0.4783349956608f, 0.8479049777152f, 0.11315400671232f, -0.5167160229888f, 0.81536699334656f, 0.39563200299008f, -0.43452700033024f, 0.79100194586624f, 0.52446097309696f, -0.26438298238976f, 0.80123302772736f, 0.57146502807552f, -0.123328004096f, 0.79021601718272f, -0.09435599601664f, -0.00109899997184f, 0.99553801928704f, 0.01204100005888f, 0.0f, 0.99655002095616f, 0.09501499457536f, 0.02440500084736f, 0.99369697148928f, 0.03737499992064f, 0.03591000031232f, 0.9978089832448f, -0.00088000004096f, -0.04031199838208f, 0.99735297851392f, 0.00716400033792f, -0.000027f, 0.99616498384896f, 0.0439879991296f, 0.46913298628608f, 0.83303096909824f, -0.23342700560384f, 0.49840398532608f, 0.79831899308032f, -0.10737399365632f, -0.00703000018944f, 0.99275501469696f, -0.45147500838912f, 0.39375001878528f, 0.75762996609024f, -0.15364399300608f, -0.0482949988352f, 0.98631600308224f, -0.55756002951168f, 0.2001739972608f, 0.77532103704576f, -0.07242999922688f, -0.08845999996928f, 0.99230303649792f, -0.58770197577728f, 0.04768600162304f, 0.80419303194624f, 0.00058300002304f, -0.02030199898112f, 0.99979397955584f, 0.1366370025472f, 0.89661401726976f, 0.14665700605952f, -0.30453899722752f, 0.88331798970368f, 0.01223799996416f, -0.702028972032f, 0.67247301197824f, 0.03398799982592f, -0.88903298056192f, 0.37605399855104f, 0.09636800364544f, -0.96680997289984f, 0.13584199319552f, 0.08601800278016f, 0.12022499508224f, 0.56931402121216f, -0.79185599004672f, -0.1131350065152f, 0.52366103543808f, -0.81117805805568f, -0.39790699347968f, 0.45853297344512f, -0.77344198885376f, -0.57933903691776f, 0.32973799817216f, -0.73464903892992f, -0.64475000471552f, 0.12459299569664f, -0.73404195536896f, 0.0937879928832f, 0.00094400004096f, -0.99559195803648f, -0.01607999946752f, 0.00035599998976f, -0.99648794525696f, -0.11933199630336f, -0.01737299984384f, -0.99121998331904f, -0.08618299621376f, -0.05359900033024f, -0.99400802107392f, -0.00411099987968f, 0.01570299969536f, -0.99802297663488f, 0.01014200008704f, 0.100344004608f, -0.99338801905664f, 0.65978901725184f, 0.12964099784704f, -0.71144799469568f, 0.563424002048f, 0.2899020087296f, -0.75940004626432f, -0.02122700029952f, 0.05189100109824f, -0.99769296879616f, 0.39725599555584f, 0.45872700194816f, -0.77096701394944f, -0.0505460031488f, 0.06086900318208f, -0.99576702828544f, 0.11805199958016f, 0.56928004734976f, -0.76116198948864f, -0.11414600155136f, 0.0886299951104f, -0.98693600509952f, -0.00128699998208f, 0.62938203291648f, -0.71953897488384f, -0.18971199799296f, 0.1132869976064f, -0.97528204754944f, 0.96859699806208f, 0.13331100336128f, 0.0896620036096f, 0.89021401268224f, 0.39323101560832f, 0.0519620001792f, 0.6728280178688f, 0.6965069611008f, 0.05032500002816f, 0.25133200703488f, 0.91697199448064f, 0.0430690009088f, -0.19813699158016f, 0.90469098848256f, 0.2512879878144f, 0.59377201446912f, 0.03307800100864f, 0.80246699196416f, 0.55712495435776f, 0.20220898967552f, 0.79074600943616f, 0.43135098945536f, 0.37995998609408f, 0.8083120062464f, 0.19395600449536f, 0.51331196780544f, 0.81977998835712f, -0.15172199514112f, 0.50558299799552f, 0.80849303240704f, 0.00352000016384f, 0.01997899956224f, 0.99979397955584f, 0.01159600013312f, -0.02326200057856f, 0.9981369778176f, 0.01310999969792f, -0.00848099934208f, 0.9988969857024f, -0.02485400109056f, 0.02126399930368f, 0.99788095750144f, -0.1133540016128f, 0.06441199992832f, 0.98819706454016f, -0.00354599993344f, -0.07682599682048f, 0.9954169716736f, -0.58168696635392f, -0.1395750076416f, 0.77609002074112f, -0.52607695454208f, -0.27819599986688f, 0.7907890429952f, 0.0172889997312f, -0.03728000155648f, 0.99837001334784f, -0.36800798130176f, -0.4405499789312f, 0.79828896186368f, 0.03743100174336f, -0.03640099864576f, 0.99735197188096f, -0.09636899979264f, -0.5500450111488f, 0.78291398557696f, 0.1042630049792f, -0.06746900267008f, 0.98949494996992f, 0.10083399368704f, -0.4811239981056f, 0.81613203439616f, 0.18510300315648f, -0.09971100024832f, 0.97764704780288f, -0.96150501720064f, -0.14958199832576f, 0.08203400118272f, -0.88767897534464f, -0.39955900399616f, 0.04622499971072f, -0.66755800072192f, -0.700756000768f, 0.03723999838208f, -0.24551199080448f, -0.91519201574912f, 0.03216199909376f, 0.15477199863808f, -0.89756897640448f, 0.24929500135424f, -0.6700729892864f, -0.01942499885056f, -0.7402250305536f, -0.59234599305216f, -0.215669014528f, -0.76248302747648f, -0.45611898372096f, -0.39906399223808f, -0.78683104608256f, -0.21001901441024f, -0.53330202066944f, -0.80314202324992f, 0.0512f, -0.65916997992448f, -0.70969100075008f, -0.0141760004096f, -0.04416000229376f, -0.99892399702016f, -0.00654499971072f, 0.00881399955456f, -0.998386958336f, 0.00239600009216f, -0.01671099973632f, -0.99892601028608f, 0.03813000085504f, -0.0417159970816f, -0.99692499173376f, 0.1174490054656f, -0.07998900011008f, -0.9866710089728f, -0.02072800002048f, 0.00177400004608f, 0.99796299808768f, 0.10236400238592f, -0.69617401724928f, 0.69568399671296f, 0.28175000141824f, -0.6379270045696f, 0.70654401445888f, -0.02771399999488f, -0.01639500087296f, 0.99839601803264f, 0.46214699548672f, -0.43765200846848f, 0.7501789528064f, -0.01494299967488f, -0.04751099953152f, 0.99600199319552f, 0.61217997586432f, -0.16587199348736f, 0.73558596255744f, 0.08200599896064f, 0.11102400282624f, 0.98334098325504f, 0.72324195811328f, -0.1459580043264f, 0.6012910174208f, 0.32238100021248f, 0.28197699715072f, 0.90363695988736f, 0.11889599840256f, -0.96922597588992f, -0.09661199679488f, 0.3230240079872f, -0.90692697194496f, -0.06791899906048f, 0.62878103109632f, -0.71109701533696f, -0.00962900000768f, 0.89524700971008f, -0.33669800525824f, 0.06016999620608f, 0.96892096610304f, -0.13095800930304f, 0.04508800253952f, 0.06500200218624f, -0.60835099574272f, -0.77086802837504f, 0.1816529993728f, -0.59399599030272f, -0.7457069858816f, 0.37600400244736f, -0.47768701763584f, -0.7467949883392f, 0.62888496594944f, -0.27160702091264f, -0.70209700364288f, 0.82300104605696f, -0.09450400251904f, -0.52953700368384f, -0.12820098842624f, -0.05917999890432f, -0.98998098591744f, -0.11097599901696f, -0.09937400889344f, -0.98725099732992f, -0.067672997888f, -0.1427209977856f, -0.98656900349952f, -0.00033499998208f, 0.0254439981056f, -0.99674203619328f, 0.2901909962752f, 0.19572398751744f, -0.92435094962176f, 0.07294999855104f, 0.03147900125184f, -0.99490501492736f, -0.04948299874304f, 0.61638703054848f, -0.76950898999296f, -0.24193399783424f, 0.56793300467712f, -0.77502198317056f, 0.05620399865856f, 0.05214300012544f, -0.99594897719296f, -0.42943998066688f, 0.41615502606336f, -0.7793209769984f, 0.02388800045056f, 0.0755379994624f, -0.994393980928f, -0.66559099797504f, 0.20106400759808f, -0.69395204276224f, -0.09678800027648f, -0.1286900023296f, -0.9791590105088f, -0.77167299919872f, 0.1793539964928f, -0.54437296996352f, -0.4178369839104f, -0.2544029925376f, -0.87217598889984f, -0.09499499823104f, 0.97878898900992f, -0.08934499811328f, -0.32998799966208f, 0.92735197413376f, -0.0670190010368f, -0.6511250112512f, 0.72807195082752f, -0.02352400039936f, -0.911676014592f, 0.34162599788544f, 0.03326400004096f, -0.9896330264576f, 0.0783410003968f, 0.01349600018432f, -0.0704410025984f, 0.7080140341248f, 0.69547402985472f, -0.21969600774144f, 0.664232001536f, 0.69598003068928f, -0.40750100250624f, 0.50477899186176f, 0.73705900212224f, -0.58660399087616f, 0.24636299411456f, 0.74730300243968f, -0.79903697403904f, 0.05794599796736f, 0.56173902430208f, 0.07605399846912f, 0.0247220011008f, 0.99679706546176f, 0.08756300087296f, 0.05929900179456f, 0.99269797216256f, 0.07250799755264f, 0.11122000265216f, 0.99017904095232f, 0.01555599982592f, -0.01123600039936f, 0.99702599057408f, -0.19481499795456f, -0.22127499542528f, 0.94394103365632f, 0.34173100228608f, 0.30123099160576f, 0.88968594980864f, 0.8375010066432f, 0.05739299995648f, 0.4931910107136f, 0.8273029758976f, -0.0553910009856f, 0.46846198153216f, 0.53113000034304f, 0.24026300809216f, 0.81219098247168f, 0.80699600142336f, 0.002638000128f, 0.4768929939456f, 0.64474304217088f, -0.01545499967488f, 0.76422097928192f, 0.88568005394432f, 0.04748799901696f, 0.44645300043776f, -0.0115360006144f, -0.00087299997696f, 0.99984506617856f, 0.7597830701056f, 0.02663600095232f, 0.62295996628992f, 0.32124501491712f, 0.33569600700416f, 0.88550003441664f, 0.99809201487872f, 0.02526199939072f, 0.00567299997696f, 0.99415306010624f, -0.00951599955968f, -0.04690500124672f, 0.98385897979904f, 0.01057200013312f, 0.00041699999744f, 0.99055602499584f, 0.04422199934976f, -0.01886500028416f, 0.99219901775872f, 0.01120200032256f, 0.12290599419904f, 0.82799998533632f, -0.08461000114176f, -0.52581699158016f, 0.87048400666624f, 0.00635599978496f, -0.48780799901696f, 0.77739402985472f, -0.09634700066816f, -0.5659670085632f, 0.81905798086656f, 0.01190399967232f, -0.47403801509888f, 0.9017590022144f, -0.05601400193024f, -0.34864300556288f, 0.4103860125696f, 0.27135800508416f, -0.8706020343808f, 0.3019320066048f, 0.34101899821056f, -0.88976799039488f, 0.13912299798528f, -0.30421200928768f, -0.94233897730048f, 0.61673100541952f, 0.166765002752f, -0.7692840075264f, 0.55583499616256f, 0.21867798724608f, -0.80107498635264f, -0.44100300570624f, -0.26931598721024f, -0.85553995317248f, -0.86396899426304f, -0.01922200109056f, -0.4643560095744f, -0.8705709965312f, -0.00562400002048f, -0.48554798219264f, -0.339693010944f, -0.34097298669568f, -0.87627801821184f, -0.76082099257344f, 0.11236600184832f, -0.58402701049856f, -0.16763299299328f, 0.29091600269312f, -0.9419429511168f, -0.826063978496f, -0.01346999943168f, -0.47305000484864f, -0.60062802378752f, -0.16114200346624f, -0.78229700345856f, -0.84958706139136f, 0.17417700900864f, -0.4440780177408f, -0.52514498019328f, -0.21412400070656f, -0.82363405041664f, -0.99914797285376f, 0.0078900002816f, -0.00175199993856f, -0.99465797042176f, 0.00779700011008f, -0.06129400152064f, -0.98409201532928f, -0.00012899999744f, -0.00873299968f, -0.9916060270592f, -0.04798700060672f, -0.0152069996544f, -0.989989961728f, -0.0194339995648f, 0.13816699027456f, -0.79278200848384f, 0.06795799560192f, 0.56695996809216f, -0.83634899910656f, 0.048954998784f, 0.46857199812608f, -0.81388296470528f, 0.00083799998464f, 0.47430900908032f, -0.88698699907072f, -0.05625400000512f, 0.44171800870912f, -0.78986403119104f, -0.15016800550912f, 0.55227499675648f, -0.29734098436096f, -0.31925800534016f, 0.89981301293056f, -0.49759800786944f, -0.24411600060416f, 0.83177896935424f, -0.62956201050112f, 0.0126179999744f, 0.77654199894016f, -0.01133800062976f, -0.008561000448f, 0.999899004928f, -0.3547320025088f, -0.34535100121088f, 0.86795903565824f, 0.09618999738368f, -0.50000000188416f, -0.49065999990784f, 0.18510000422912f, -0.6666670047232f, -0.27721700737024f, 0.3256660000768f, -0.18199099736064f, -0.76139896766464f, 0.06240099893248f, -0.09090699886592f, -0.9939019890688f, 0.38032098983936f, -0.00007100000256f, -0.92143599222784f, 0.03091799998464f, 0.07133599891456f, -0.99697297457152f, 0.3804109996032f, 0.00016300000256f, -0.92208896147456f, 0.0247120003072f, 0.06498300198912f, -0.9975799742464f, 0.35510898655232f, 0.03216100032512f, -0.92689102012416f, 0.0765789995008f, -0.0955559968768f, -0.99247399632896f, 0.27721700737024f, -0.6666670047232f, -0.18510000422912f, 0.59299896229888f, -0.18205301014528f, -0.5781109866496f, 0.7048519483392f, 0.0f, -0.7048519483392f, 0.70527204982784f, -0.000025f, -0.70541801160704f, 0.68352198311936f, 0.03204600037376f, -0.71994104086528f, 0.32710701613056f, -0.6666670047232f, -0.06412600082432f, 0.76946998296576f, -0.18225299456f, -0.30610001231872f, 0.92143800549376f, 0.00006700000256f, -0.38033197891584f, 0.92208803872768f, -0.000168f, -0.38044300214272f, 0.9071130312704f, 0.03243700125696f, -0.40300399558656f, 0.0f, -1.00000000376832f, 0.0f, 0.66260301774848f, -0.27272499167232f, -0.04157500030976f, 0.99697901436928f, -0.0712929968128f, -0.03082600054784f, 0.99759104720896f, -0.06492199583744f, -0.02444800032768f, 0.9925040275456f, 0.09545700081664f, -0.07630900166656f, 0.49065999990784f, -0.50000000188416f, 0.09618999738368f, 0.27721700737024f, -0.6666670047232f, 0.18510000422912f, 0.76139896766464f, -0.18199099736064f, 0.3256660000768f, 0.9939019890688f, -0.09090699886592f, 0.06240099893248f, 0.92143599222784f, -0.00007100000256f, 0.38032098983936f, 0.99697297457152f, 0.07133599891456f, 0.03091799998464f, 0.92208896147456f, 0.00016300000256f, 0.3804109996032f, 0.9975799742464f, 0.06498300198912f, 0.0247120003072f, 0.92689102012416f, 0.03216100032512f, 0.35510898655232f, 0.99247399632896f, -0.0955559968768f, 0.0765789995008f, 0.18510000422912f, -0.6666670047232f, 0.27721700737024f, 0.5781109866496f, -0.18205301014528f, 0.59299896229888f, 0.7048519483392f, 0.0f, 0.7048519483392f, 0.70541801160704f, -0.000025f, 0.70527204982784f, 0.71994104086528f, 0.03204600037376f, 0.68352198311936f, 0.06412600082432f, -0.6666670047232f, 0.32710701613056f, 0.30610001231872f, -0.18225299456f, 0.76946998296576f, 0.38033197891584f, 0.00006700000256f, 0.92143800549376f, 0.38044300214272f, -0.000168f, 0.92208803872768f, 0.40300399558656f, 0.03243700125696f, 0.9071130312704f, 0.0f, -1.00000000376832f, 0.0f, 0.04157500030976f, -0.27272499167232f, 0.66260301774848f, 0.03082600054784f, -0.0712929968128f, 0.99697901436928f, 0.02444800032768f, -0.06492199583744f, 0.99759104720896f, 0.07630900166656f, 0.09545700081664f, 0.9925040275456f, -0.09618999738368f, -0.50000000188416f, 0.49065999990784f, -0.18510000422912f, -0.6666670047232f, 0.27721700737024f, -0.3256660000768f, -0.18199099736064f, 0.76139896766464f, -0.06240099893248f, -0.09090699886592f, 0.9939019890688f, -0.38032098983936f, -0.00007100000256f, 0.92143599222784f, -0.03091799998464f, 0.07133599891456f, 0.99697297457152f, -0.3804109996032f, 0.00016300000256f, 0.92208896147456f, -0.0247120003072f, 0.06498300198912f, 0.9975799742464f, -0.35510898655232f, 0.03216100032512f, 0.92689102012416f, -0.0765789995008f, -0.0955559968768f, 0.99247399632896f, -0.27721700737024f, -0.6666670047232f, 0.18510000422912f, -0.59299896229888f, -0.18205301014528f, 0.5781109866496f, -0.7048519483392f, 0.0f, 0.7048519483392f, -0.70527204982784f, -0.000025f, 0.70541801160704f, -0.68352198311936f, 0.03204600037376f, 0.71994104086528f, -0.32710701613056f, -0.6666670047232f, 0.06412600082432f, -0.76946998296576f, -0.18225299456f, 0.30610001231872f, -0.92143800549376f, 0.00006700000256f, 0.38033197891584f, -0.92208803872768f, -0.000168f, 0.38044300214272f, -0.9071130312704f, 0.03243700125696f, 0.40300399558656f, 0.0f, -1.00000000376832f, 0.0f, -0.66260301774848f, -0.27272499167232f, 0.04157500030976f, -0.99697901436928f, -0.0712929968128f, 0.03082600054784f, -0.99759104720896f, -0.06492199583744f, 0.02444800032768f, -0.9925040275456f, 0.09545700081664f, 0.07630900166656f, -0.49065999990784f, -0.50000000188416f, -0.09618999738368f, -0.27721700737024f, -0.6666670047232f, -0.18510000422912f, -0.76139896766464f, -0.18199099736064f, -0.3256660000768f, -0.9939019890688f, -0.09090699886592f, -0.06240099893248f, -0.92143599222784f, -0.00007100000256f, -0.38032098983936f, -0.99697297457152f, 0.07133599891456f, -0.03091799998464f, -0.92208896147456f, 0.00016300000256f, -0.3804109996032f, -0.9975799742464f, 0.06498300198912f, -0.0247120003072f, -0.92689102012416f, 0.03216100032512f, -0.35510898655232f, -0.99247399632896f, -0.0955559968768f, -0.0765789995008f, -0.18510000422912f, -0.6666670047232f, -0.27721700737024f, -0.5781109866496f, -0.18205301014528f, -0.59299896229888f, -0.7048519483392f, 0.0f, -0.7048519483392f, -0.70541801160704f, -0.000025f, -0.70527204982784f, -0.71994104086528f, 0.03204600037376f, -0.68352198311936f, -0.06412600082432f, -0.6666670047232f, -0.32710701613056f, -0.30610001231872f, -0.18225299456f, -0.76946998296576f, -0.38033197891584f, 0.00006700000256f, -0.92143800549376f, -0.38044300214272f, -0.000168f, -0.92208803872768f, -0.40300399558656f, 0.03243700125696f, -0.9071130312704f, 0.0f, -1.00000000376832f, 0.0f, -0.04157500030976f, -0.27272499167232f, -0.66260301774848f, -0.03082600054784f, -0.0712929968128f, -0.99697901436928f, -0.02444800032768f, -0.06492199583744f, -0.99759104720896f, -0.07630900166656f, 0.09545700081664f, -0.9925040275456f, 0.0765789995008f, -0.0955559968768f, -0.99247399632896f, 0.40307097862144f, -0.03255299735552f, -0.90706496454656f, 0.3753639936f, 0.000007f, -0.90702100824064f, 0.18306199191552f, -0.04457400107008f, -0.982089990144f, 0.3751649738752f, -0.00007400000512f, -0.90657498595328f, 0.18801500356608f, -0.03304099938304f, -0.98160999399424f, 0.37590698819584f, -0.00026199998464f, -0.9086070423552f, 0.1662340038656f, -0.06822899482624f, -0.98372300046336f, 0.33324097601536f, 0.02980299931648f, -0.92900301996032f, 0.14071400235008f, -0.08718099939328f, -0.98620401516544f, 0.71982997569536f, -0.03201699938304f, -0.68365599113216f, 0.69435398291456f, 0.0f, -0.69435398291456f, 0.69403500609536f, 0.0f, -0.69403500609536f, 0.69551001698304f, 0.0f, -0.69551001698304f, 0.6639170093056f, 0.029100998656f, -0.7306150412288f, 0.92686501543936f, -0.0320399998976f, -0.3552330121216f, 0.90702100824064f, -0.000007f, -0.37536500023296f, 0.90657498595328f, 0.00007300000256f, -0.3751649738752f, 0.9086070423552f, 0.00026199998464f, -0.37590698819584f, 0.89262598914048f, 0.0289919991808f, -0.42114599616512f, 0.99247399632896f, 0.0956509978624f, -0.07646500356096f, 0.982089990144f, 0.04457400107008f, -0.18306199191552f, 0.98160999399424f, 0.03304099938304f, -0.18801500356608f, 0.98372300046336f, 0.06822899482624f, -0.1662340038656f, 0.98620401516544f, 0.08718099939328f, -0.14071400235008f, 0.99247399632896f, -0.0955559968768f, 0.0765789995008f, 0.90706496454656f, -0.03255299735552f, 0.40307097862144f, 0.90702100824064f, 0.000007f, 0.3753639936f, 0.982089990144f, -0.04457400107008f, 0.18306199191552f, 0.90657498595328f, -0.00007400000512f, 0.3751649738752f, 0.98160999399424f, -0.03304099938304f, 0.18801500356608f, 0.9086070423552f, -0.00026199998464f, 0.37590698819584f, 0.98372300046336f, -0.06822899482624f, 0.1662340038656f, 0.92900301996032f, 0.02980299931648f, 0.33324097601536f, 0.98620401516544f, -0.08718099939328f, 0.14071400235008f, 0.68365599113216f, -0.03201699938304f, 0.71982997569536f, 0.69435398291456f, 0.0f, 0.69435398291456f, 0.69403500609536f, 0.0f, 0.69403500609536f, 0.69551001698304f, 0.0f, 0.69551001698304f, 0.7306150412288f, 0.029100998656f, 0.6639170093056f, 0.3552330121216f, -0.0320399998976f, 0.92686501543936f, 0.37536500023296f, -0.000007f, 0.90702100824064f, 0.3751649738752f, 0.00007300000256f, 0.90657498595328f, 0.37590698819584f, 0.00026199998464f, 0.9086070423552f, 0.42114599616512f, 0.0289919991808f, 0.89262598914048f, 0.07646500356096f, 0.0956509978624f, 0.99247399632896f, 0.18306199191552f, 0.04457400107008f, 0.982089990144f, 0.18801500356608f, 0.03304099938304f, 0.98160999399424f, 0.1662340038656f, 0.06822899482624f, 0.98372300046336f, 0.14071400235008f, 0.08718099939328f, 0.98620401516544f, -0.0765789995008f, -0.0955559968768f, 0.99247399632896f, -0.40307097862144f, -0.03255299735552f, 0.90706496454656f, -0.3753639936f, 0.000007f, 0.90702100824064f, -0.18306199191552f, -0.04457400107008f, 0.982089990144f, -0.3751649738752f, -0.00007400000512f, 0.90657498595328f, -0.18801500356608f, -0.03304099938304f, 0.98160999399424f, -0.37590698819584f, -0.00026199998464f, 0.9086070423552f, -0.1662340038656f, -0.06822899482624f, 0.98372300046336f, -0.33324097601536f, 0.02980299931648f, 0.92900301996032f, -0.14071400235008f, -0.08718099939328f, 0.98620401516544f, -0.71982997569536f, -0.03201699938304f, 0.68365599113216f, -0.69435398291456f, 0.0f, 0.69435398291456f, -0.69403500609536f, 0.0f, 0.69403500609536f, -0.69551001698304f, 0.0f, 0.69551001698304f, -0.6639170093056f, 0.029100998656f, 0.7306150412288f, -0.92686501543936f, -0.0320399998976f, 0.3552330121216f, -0.90702100824064f, -0.000007f, 0.37536500023296f, -0.90657498595328f, 0.00007300000256f, 0.3751649738752f, -0.9086070423552f, 0.00026199998464f, 0.37590698819584f, -0.89262598914048f, 0.0289919991808f, 0.42114599616512f, -0.99247399632896f, 0.0956509978624f, 0.07646500356096f, -0.982089990144f, 0.04457400107008f, 0.18306199191552f, -0.98160999399424f, 0.03304099938304f, 0.18801500356608f, -0.98372300046336f, 0.06822899482624f, 0.1662340038656f, -0.98620401516544f, 0.08718099939328f, 0.14071400235008f, -0.99247399632896f, -0.0955559968768f, -0.0765789995008f, -0.90706496454656f, -0.03255299735552f, -0.40307097862144f, -0.90702100824064f, 0.000007f, -0.3753639936f, -0.982089990144f, -0.04457400107008f, -0.18306199191552f, -0.90657498595328f, -0.00007400000512f, -0.3751649738752f, -0.98160999399424f, -0.03304099938304f, -0.18801500356608f, -0.9086070423552f, -0.00026199998464f, -0.37590698819584f, -0.98372300046336f, -0.06822899482624f, -0.1662340038656f, -0.92900301996032f, 0.02980299931648f, -0.33324097601536f, -0.98620401516544f, -0.08718099939328f, -0.14071400235008f, -0.68365599113216f, -0.03201699938304f, -0.71982997569536f, -0.69435398291456f, 0.0f, -0.69435398291456f, -0.69403500609536f, 0.0f, -0.69403500609536f, -0.69551001698304f, 0.0f, -0.69551001698304f, -0.7306150412288f, 0.029100998656f, -0.6639170093056f, -0.3552330121216f, -0.0320399998976f, -0.92686501543936f, -0.37536500023296f, -0.000007f, -0.90702100824064f, -0.3751649738752f, 0.00007300000256f, -0.90657498595328f, -0.37590698819584f, 0.00026199998464f, -0.9086070423552f, -0.42114599616512f, 0.0289919991808f, -0.89262598914048f, -0.07646500356096f, 0.0956509978624f, -0.99247399632896f, -0.18306199191552f, 0.04457400107008f, -0.982089990144f, -0.18801500356608f, 0.03304099938304f, -0.98160999399424f, -0.1662340038656f, 0.06822899482624f, -0.98372300046336f, -0.14071400235008f, 0.08718099939328f, -0.98620401516544f };
-
-  inline static const float binormals[] = { 0.25542701088768f, -0.965512003584f, 0.05043399950336f, 0.23029000175616f, -0.96644599119872f, 0.11379700400128f, -0.23653901139968f, -0.966678020096f, -0.09789499244544f, -0.255118016512f, -0.96559698018304f, -0.05037299859456f, -0.92016100769792f, -0.09108300234752f, -0.38079800803328f, -0.9770480173056f, -0.09032400109568f, -0.19291999043584f, -0.67624004222976f, 0.6814529748992f, -0.27985899945984f, -0.72379996831744f, 0.67504797908992f, -0.14291599097856f, -0.46819899867136f, 0.8693500346368f, -0.15817600139264f, -0.49020797976576f, 0.86621496016896f, -0.09679199535104f, 0.16952399495168f, -0.96634398572544f, 0.19349599420416f, -0.1810679988224f, -0.96665897795584f, -0.1810679988224f, -0.70411995840512f, -0.09181900832768f, -0.70411995840512f, -0.51793497161728f, 0.68079899901952f, -0.51793497161728f, -0.3721780002816f, 0.86900199129088f, -0.32606699651072f, 0.08221600251904f, -0.96644297129984f, 0.24336899506176f, -0.09789499244544f, -0.966678020096f, -0.23653901139968f, -0.38079800803328f, -0.09108199571456f, -0.92016100769792f, -0.27985899945984f, 0.6814540234752f, -0.67624004222976f, -0.21894000541696f, 0.86934902800384f, -0.44305498505216f, 0.05082199883776f, -0.96497001562112f, 0.2573910147072f, -0.05021600055296f, -0.96581500010496f, -0.25432101486592f, -0.19291600584704f, -0.09059000385536f, -0.9770249486336f, -0.14291300253696f, 0.67506098143232f, -0.72378704986112f, -0.09679199535104f, 0.86621496016896f, -0.49020797976576f, -0.04850699993088f, -0.96500801601536f, 0.25769401122816f, -0.15833300467712f, -0.93313600323584f, 0.32278099001344f, 0.0565619982336f, -0.98882402910208f, -0.13793900888064f, 0.04915000246272f, -0.96581802000384f, -0.25451999264768f, 0.37838800289792f, -0.12381099917312f, -0.91732901363712f, 0.19179501518848f, -0.0905079947264f, -0.97725303488512f, 0.27772399386624f, 0.68688703127552f, -0.67160701403136f, 0.14281700540416f, 0.67506601459712f, -0.72380198158336f, 0.15788200165376f, 0.86982206160896f, -0.4674209972224f, 0.09679199535104f, 0.86621496016896f, -0.49020797976576f, -0.31390699618304f, -0.91151101067264f, 0.26572700516352f, 0.05247500025856f, -0.99727899099136f, -0.05178600194048f, 0.6997879554048f, -0.15676100050944f, -0.69693796777984f, 0.51192998658048f, 0.69005503102976f, -0.51161600098304f, 0.32515400138752f, 0.869797986304f, -0.37111398924288f, -0.31819298766848f, -0.9427499352064f, 0.09987600416768f, 0.15527999176704f, -0.98593801240576f, -0.06176299810816f, 0.91872504578048f, -0.1233299963904f, -0.37514601562112f, 0.6724870209536f, 0.68609799880704f, -0.27754399531008f, 0.44242999181312f, 0.86976896172032f, -0.21853800235008f, -0.25594800635904f, -0.96565905588224f, 0.04464200122368f, 0.25306201063424f, -0.96633895256064f, -0.046362001408f, 0.9778940084224f, -0.09153299873792f, -0.18800101556224f, 0.72381498392576f, 0.67521201831936f, -0.14205800415232f, 0.49017899712512f, 0.86624096485376f, -0.09670099992576f, -0.2549189967872f, -0.96565100281856f, -0.05033399681024f, -0.23029000175616f, -0.96644599119872f, -0.11379700400128f, 0.23653901139968f, -0.966678020096f, 0.09789499244544f, 0.2522659946496f, -0.96637502357504f, 0.04980999716864f, 0.92016100769792f, -0.09108300234752f, 0.38079800803328f, 0.97690398490624f, -0.09193000009728f, 0.19289199345664f, 0.67624004222976f, 0.6814529748992f, 0.27985899945984f, 0.72366096908288f, 0.6752019939328f, 0.14288799399936f, 0.46819899867136f, 0.8693500346368f, 0.15817600139264f, 0.49016599478272f, 0.86623903547392f, 0.09678400520192f, -0.16952399495168f, -0.96634398572544f, -0.19349599420416f, 0.1810679988224f, -0.96665897795584f, 0.1810679988224f, 0.70411995840512f, -0.09181900832768f, 0.70411995840512f, 0.51793497161728f, 0.68079899901952f, 0.51793497161728f, 0.3721780002816f, 0.86900199129088f, 0.32606699651072f, -0.08221600251904f, -0.96644297129984f, -0.24336899506176f, 0.09789499244544f, -0.966678020096f, 0.23653901139968f, 0.38079800803328f, -0.09108199571456f, 0.92016100769792f, 0.27985899945984f, 0.6814540234752f, 0.67624004222976f, 0.21894000541696f, 0.86934902800384f, 0.44305498505216f, -0.05043399950336f, -0.965512003584f, -0.25542701088768f, 0.05037299859456f, -0.96559698018304f, 0.255118016512f, 0.19291999043584f, -0.09032400109568f, 0.9770480173056f, 0.14291599097856f, 0.67504797908992f, 0.72379996831744f, 0.09679199535104f, 0.86621496016896f, 0.49020797976576f, 0.05043399950336f, -0.965512003584f, -0.25542701088768f, 0.11379700400128f, -0.96644599119872f, -0.23029000175616f, -0.09789499244544f, -0.966678020096f, 0.23653901139968f, -0.05037299859456f, -0.96559698018304f, 0.255118016512f, -0.38079800803328f, -0.09108300234752f, 0.92016100769792f, -0.19291999043584f, -0.09032400109568f, 0.9770480173056f, -0.27985899945984f, 0.6814529748992f, 0.67624004222976f, -0.14291599097856f, 0.67504797908992f, 0.72379996831744f, -0.15817600139264f, 0.8693500346368f, 0.46819899867136f, -0.09679199535104f, 0.86621496016896f, 0.49020797976576f, 0.19349599420416f, -0.96634398572544f, -0.16952399495168f, -0.1810679988224f, -0.96665897795584f, 0.1810679988224f, -0.70411995840512f, -0.09181900832768f, 0.70411995840512f, -0.51793497161728f, 0.68079899901952f, 0.51793497161728f, -0.32606699651072f, 0.86900199129088f, 0.3721780002816f, 0.24336899506176f, -0.96644297129984f, -0.08221600251904f, -0.23653901139968f, -0.966678020096f, 0.09789499244544f, -0.92016100769792f, -0.09108199571456f, 0.38079800803328f, -0.67624004222976f, 0.6814540234752f, 0.27985899945984f, -0.44305498505216f, 0.86934902800384f, 0.21894000541696f, 0.25542701088768f, -0.965512003584f, -0.05043399950336f, -0.255118016512f, -0.96559698018304f, 0.05037299859456f, -0.9770480173056f, -0.09032400109568f, 0.19291999043584f, -0.72379996831744f, 0.67504797908992f, 0.14291599097856f, -0.49020797976576f, 0.86621496016896f, 0.09679199535104f, -0.49020797976576f, 0.86621496016896f, -0.09679199535104f, -0.44305498505216f, 0.86934902800384f, -0.218938998784f, -0.37287597441024f, 0.91495998685184f, -0.15431199883264f, -0.40145797513216f, 0.9124410556416f, -0.07926799925248f, -0.31125797863424f, 0.94155506188288f, -0.12881099751424f, -0.33541301731328f, 0.93974001876992f, -0.06622800248832f, -0.19015200145408f, 0.97859596713984f, -0.07869099933696f, -0.20517400608768f, 0.97788696199168f, -0.04051199852544f, 0.0630180020224f, 0.99778499182592f, 0.02128899997696f, 0.06623400034304f, 0.997717966848f, 0.01307799977984f, -0.32606699651072f, 0.86900199129088f, -0.3721780002816f, -0.28573899423744f, 0.91471705276416f, -0.28573899423744f, -0.23854399356928f, 0.94137898500096f, -0.23854399356928f, -0.14574900215808f, 0.97852701278208f, -0.14574900215808f, 0.05011200278528f, 0.99777802928128f, 0.04390300155904f, -0.15817600139264f, 0.8693500346368f, -0.46820000530432f, -0.15431199883264f, 0.91495998685184f, -0.37287597441024f, -0.12881099751424f, 0.94155506188288f, -0.31125797863424f, -0.07869099933696f, 0.97859596713984f, -0.19015101579264f, 0.02946699886592f, 0.99778499182592f, 0.05963199807488f, -0.09679199535104f, 0.86621496016896f, -0.49020797976576f, -0.07926799925248f, 0.9124410556416f, -0.40145797513216f, -0.06622800248832f, 0.93974001876992f, -0.33541301731328f, -0.04051199852544f, 0.97788696199168f, -0.20517400608768f, 0.01307799977984f, 0.997717966848f, 0.06623400034304f, 0.09679199535104f, 0.86621496016896f, -0.49020797976576f, 0.21858200059904f, 0.86981199527936f, -0.44232198848512f, 0.15431199883264f, 0.91495998685184f, -0.37287597441024f, 0.07926799925248f, 0.9124410556416f, -0.40145797513216f, 0.12881099751424f, 0.94155506188288f, -0.31125797863424f, 0.06622800248832f, 0.93974001876992f, -0.33541301731328f, 0.07869099933696f, 0.97859596713984f, -0.19015200145408f, 0.04051199852544f, 0.97788696199168f, -0.20517400608768f, -0.02128899997696f, 0.99778499182592f, 0.0630180020224f, -0.01307799977984f, 0.997717966848f, 0.06623400034304f, 0.37113298944f, 0.86979194650624f, -0.32514901016576f, 0.28573899423744f, 0.91471705276416f, -0.28573899423744f, 0.23854399356928f, 0.94137898500096f, -0.23854399356928f, 0.14574900215808f, 0.97852701278208f, -0.14574900215808f, -0.04390300155904f, 0.99777802928128f, 0.05011200278528f, 0.46750198923264f, 0.86976803897344f, -0.15794099453952f, 0.37287597441024f, 0.91495998685184f, -0.15431199883264f, 0.31125797863424f, 0.94155506188288f, -0.12881099751424f, 0.19015101579264f, 0.97859596713984f, -0.07869099933696f, -0.05963199807488f, 0.99778499182592f, 0.02946699886592f, 0.49017899712512f, 0.86624096485376f, -0.09670099992576f, 0.40145797513216f, 0.9124410556416f, -0.07926799925248f, 0.33541301731328f, 0.93974001876992f, -0.06622800248832f, 0.20517400608768f, 0.97788696199168f, -0.04051199852544f, -0.06623400034304f, 0.997717966848f, 0.01307799977984f, 0.49016599478272f, 0.86623903547392f, 0.09678400520192f, 0.44305498505216f, 0.86934902800384f, 0.218938998784f, 0.37287597441024f, 0.91495998685184f, 0.15431199883264f, 0.40145797513216f, 0.9124410556416f, 0.07926799925248f, 0.31125797863424f, 0.94155506188288f, 0.12881099751424f, 0.33541301731328f, 0.93974001876992f, 0.06622800248832f, 0.19015200145408f, 0.97859596713984f, 0.07869099933696f, 0.20517400608768f, 0.97788696199168f, 0.04051199852544f, -0.0630180020224f, 0.99778499182592f, -0.02128899997696f, -0.06623400034304f, 0.997717966848f, -0.01307799977984f, 0.32606699651072f, 0.86900199129088f, 0.3721780002816f, 0.28573899423744f, 0.91471705276416f, 0.28573899423744f, 0.23854399356928f, 0.94137898500096f, 0.23854399356928f, 0.14574900215808f, 0.97852701278208f, 0.14574900215808f, -0.05011200278528f, 0.99777802928128f, -0.04390300155904f, 0.15817600139264f, 0.8693500346368f, 0.46820000530432f, 0.15431199883264f, 0.91495998685184f, 0.37287597441024f, 0.12881099751424f, 0.94155506188288f, 0.31125797863424f, 0.07869099933696f, 0.97859596713984f, 0.19015101579264f, -0.02946699886592f, 0.99778499182592f, -0.05963199807488f, 0.09679199535104f, 0.86621496016896f, 0.49020797976576f, 0.07926799925248f, 0.9124410556416f, 0.40145797513216f, 0.06622800248832f, 0.93974001876992f, 0.33541301731328f, 0.04051199852544f, 0.97788696199168f, 0.20517400608768f, -0.01307799977984f, 0.997717966848f, -0.06623400034304f, -0.09679199535104f, 0.86621496016896f, 0.49020797976576f, -0.218938998784f, 0.86934902800384f, 0.44305498505216f, -0.15431199883264f, 0.91495998685184f, 0.37287597441024f, -0.07926799925248f, 0.9124410556416f, 0.40145797513216f, -0.12881099751424f, 0.94155506188288f, 0.31125797863424f, -0.06622800248832f, 0.93974001876992f, 0.33541301731328f, -0.07869099933696f, 0.97859596713984f, 0.19015200145408f, -0.04051199852544f, 0.97788696199168f, 0.20517400608768f, 0.02128899997696f, 0.99778499182592f, -0.0630180020224f, 0.01307799977984f, 0.997717966848f, -0.06623400034304f, -0.3721780002816f, 0.86900199129088f, 0.32606699651072f, -0.28573899423744f, 0.91471705276416f, 0.28573899423744f, -0.23854399356928f, 0.94137898500096f, 0.23854399356928f, -0.14574900215808f, 0.97852701278208f, 0.14574900215808f, 0.04390300155904f, 0.99777802928128f, -0.05011200278528f, -0.46820000530432f, 0.8693500346368f, 0.15817600139264f, -0.37287597441024f, 0.91495998685184f, 0.15431199883264f, -0.31125797863424f, 0.94155506188288f, 0.12881099751424f, -0.19015101579264f, 0.97859596713984f, 0.07869099933696f, 0.05963199807488f, 0.99778499182592f, -0.02946699886592f, -0.49020797976576f, 0.86621496016896f, 0.09679199535104f, -0.40145797513216f, 0.9124410556416f, 0.07926799925248f, -0.33541301731328f, 0.93974001876992f, 0.06622800248832f, -0.20517400608768f, 0.97788696199168f, 0.04051199852544f, 0.06623400034304f, 0.997717966848f, -0.01307799977984f, 0.06623400034304f, 0.997717966848f, 0.01307799977984f, 0.05963199807488f, 0.99778499182592f, 0.02946699886592f, 0.40303201353728f, 0.8998589825024f, 0.16678899417088f, 0.43391198953472f, 0.89687196696576f, 0.0856769953792f, 0.63263102468096f, 0.72885796339712f, 0.26181099323392f, 0.67771203321856f, 0.72304902012928f, 0.13381600804864f, 0.66613399257088f, 0.69301402861568f, 0.27567602008064f, 0.71285400928256f, 0.68704301744128f, 0.14075500167168f, 0.57775996534784f, 0.79252397490176f, 0.19519099633664f, 0.60364901318656f, 0.78828999278592f, 0.1191920009216f, 0.04390300155904f, 0.99777802928128f, 0.05011200278528f, 0.3088479944704f, 0.8995699949568f, 0.3088479944704f, 0.48457301622784f, 0.72827101249536f, 0.48457301622784f, 0.51013897682944f, 0.69247103401984f, 0.51013897682944f, 0.45911099047936f, 0.79210295066624f, 0.4022299787264f, 0.02128899997696f, 0.99778499182592f, 0.0630180020224f, 0.16678999031808f, 0.8998589825024f, 0.40303201353728f, 0.26181099323392f, 0.72885796339712f, 0.63263102468096f, 0.27567602008064f, 0.69301402861568f, 0.66613399257088f, 0.27017701490688f, 0.79251701235712f, 0.54673700552704f, 0.01307799977984f, 0.997717966848f, 0.06623400034304f, 0.085675999232f, 0.89687196696576f, 0.43391198953472f, 0.13381600804864f, 0.72304902012928f, 0.67771203321856f, 0.14075500167168f, 0.68704301744128f, 0.71285400928256f, 0.1191920009216f, 0.78828999278592f, 0.60364901318656f, -0.01307799977984f, 0.997717966848f, 0.06623400034304f, -0.02946699886592f, 0.99778499182592f, 0.05963199807488f, -0.16678899417088f, 0.8998589825024f, 0.40303201353728f, -0.0856769953792f, 0.89687196696576f, 0.43391198953472f, -0.26181099323392f, 0.72885796339712f, 0.63263102468096f, -0.13381600804864f, 0.72304902012928f, 0.67771203321856f, -0.27567602008064f, 0.69301402861568f, 0.66613399257088f, -0.14075500167168f, 0.68704301744128f, 0.71285400928256f, -0.19519099633664f, 0.79252397490176f, 0.57775996534784f, -0.1191920009216f, 0.78828999278592f, 0.60364901318656f, -0.05011200278528f, 0.99777802928128f, 0.04390300155904f, -0.3088479944704f, 0.8995699949568f, 0.3088479944704f, -0.48457301622784f, 0.72827101249536f, 0.48457301622784f, -0.51013897682944f, 0.69247103401984f, 0.51013897682944f, -0.4022299787264f, 0.79210295066624f, 0.45911099047936f, -0.0630180020224f, 0.99778499182592f, 0.02128899997696f, -0.40303201353728f, 0.8998589825024f, 0.16678999031808f, -0.63263102468096f, 0.72885796339712f, 0.26181099323392f, -0.66613399257088f, 0.69301402861568f, 0.27567602008064f, -0.54673700552704f, 0.79251701235712f, 0.27017701490688f, -0.06623400034304f, 0.997717966848f, 0.01307799977984f, -0.43391198953472f, 0.89687196696576f, 0.085675999232f, -0.67771203321856f, 0.72304902012928f, 0.13381600804864f, -0.71285400928256f, 0.68704301744128f, 0.14075500167168f, -0.60364901318656f, 0.78828999278592f, 0.1191920009216f, -0.06623400034304f, 0.997717966848f, -0.01307799977984f, -0.05963199807488f, 0.99778499182592f, -0.02946699886592f, -0.40303201353728f, 0.8998589825024f, -0.16678899417088f, -0.43391198953472f, 0.89687196696576f, -0.0856769953792f, -0.63263102468096f, 0.72885796339712f, -0.26181099323392f, -0.67771203321856f, 0.72304902012928f, -0.13381600804864f, -0.66613399257088f, 0.69301402861568f, -0.27567602008064f, -0.71285400928256f, 0.68704301744128f, -0.14075500167168f, -0.57775996534784f, 0.79252397490176f, -0.19519099633664f, -0.60364901318656f, 0.78828999278592f, -0.1191920009216f, -0.04390300155904f, 0.99777802928128f, -0.05011200278528f, -0.3088479944704f, 0.8995699949568f, -0.3088479944704f, -0.48457301622784f, 0.72827101249536f, -0.48457301622784f, -0.51013897682944f, 0.69247103401984f, -0.51013897682944f, -0.45911099047936f, 0.79210295066624f, -0.4022299787264f, -0.02128899997696f, 0.99778499182592f, -0.0630180020224f, -0.16678999031808f, 0.8998589825024f, -0.40303201353728f, -0.26181099323392f, 0.72885796339712f, -0.63263102468096f, -0.27567602008064f, 0.69301402861568f, -0.66613399257088f, -0.27017701490688f, 0.79251701235712f, -0.54673700552704f, -0.01307799977984f, 0.997717966848f, -0.06623400034304f, -0.085675999232f, 0.89687196696576f, -0.43391198953472f, -0.13381600804864f, 0.72304902012928f, -0.67771203321856f, -0.14075500167168f, 0.68704301744128f, -0.71285400928256f, -0.1191920009216f, 0.78828999278592f, -0.60364901318656f, 0.01307799977984f, 0.997717966848f, -0.06623400034304f, 0.02946699886592f, 0.99778499182592f, -0.05963199807488f, 0.16678899417088f, 0.8998589825024f, -0.40303201353728f, 0.0856769953792f, 0.89687196696576f, -0.43391198953472f, 0.26181099323392f, 0.72885796339712f, -0.63263102468096f, 0.13381600804864f, 0.72304902012928f, -0.67771203321856f, 0.27567602008064f, 0.69301402861568f, -0.66613399257088f, 0.14075500167168f, 0.68704301744128f, -0.71285400928256f, 0.19519099633664f, 0.79252397490176f, -0.57775996534784f, 0.1191920009216f, 0.78828999278592f, -0.60364901318656f, 0.05011200278528f, 0.99777802928128f, -0.04390300155904f, 0.3088479944704f, 0.8995699949568f, -0.3088479944704f, 0.48457301622784f, 0.72827101249536f, -0.48457301622784f, 0.51013897682944f, 0.69247103401984f, -0.51013897682944f, 0.4022299787264f, 0.79210295066624f, -0.45911099047936f, 0.0630180020224f, 0.99778499182592f, -0.02128899997696f, 0.40303201353728f, 0.8998589825024f, -0.16678999031808f, 0.63263102468096f, 0.72885796339712f, -0.26181099323392f, 0.66613399257088f, 0.69301402861568f, -0.27567602008064f, 0.54673700552704f, 0.79251701235712f, -0.27017701490688f, 0.06623400034304f, 0.997717966848f, -0.01307799977984f, 0.43391198953472f, 0.89687196696576f, -0.085675999232f, 0.67771203321856f, 0.72304902012928f, -0.13381600804864f, 0.71285400928256f, 0.68704301744128f, -0.14075500167168f, 0.60364901318656f, 0.78828999278592f, -0.1191920009216f, 0.60364901318656f, 0.78828999278592f, 0.1191920009216f, 0.54673700552704f, 0.79251701235712f, 0.27017701490688f, 0.72238304854016f, 0.62352800088064f, 0.2989569867776f, 0.77239400005632f, 0.61656201691136f, 0.15251099615232f, 0.90940899328f, 0.17701500092416f, 0.37635200385024f, 0.96608695877632f, 0.17403500036096f, 0.1907560022016f, 0.94082298806272f, 0.04907499782144f, 0.33532598550528f, 0.98431196463104f, 0.04849300144128f, 0.16964000940032f, 0.98105802358784f, 0.0f, 0.19371200086016f, 0.70710697394176f, 0.0f, 0.70710697394176f, 0.4022299787264f, 0.79210295066624f, 0.45911099047936f, 0.55320298651648f, 0.62284202246144f, 0.55320298651648f, 0.69598799986688f, 0.17663900254208f, 0.69598799986688f, 0.74039800365056f, 0.04895899910144f, 0.67038299029504f, 0.83104203014144f, 0.0f, 0.55620904419328f, 0.19519099633664f, 0.79252397490176f, 0.57775996534784f, 0.29895600111616f, 0.62352800088064f, 0.72238304854016f, 0.37635200385024f, 0.17701500092416f, 0.90940899328f, 0.42757599002624f, 0.04906899996672f, 0.90264601362432f, 0.55620904419328f, 0.0f, 0.83104203014144f, 0.1191920009216f, 0.78828999278592f, 0.60364901318656f, 0.15251099615232f, 0.61656201691136f, 0.77239400005632f, 0.1907560022016f, 0.17403500036096f, 0.96608695877632f, 0.19348601176064f, 0.04827700002816f, 0.9799139852288f, 0.19371200086016f, 0.0f, 0.98105802358784f, -0.1191920009216f, 0.78828999278592f, 0.60364901318656f, -0.27017701490688f, 0.79251701235712f, 0.54673700552704f, -0.2989569867776f, 0.62352800088064f, 0.72238304854016f, -0.15251099615232f, 0.61656201691136f, 0.77239400005632f, -0.37635200385024f, 0.17701500092416f, 0.90940899328f, -0.1907560022016f, 0.17403500036096f, 0.96608695877632f, -0.33532598550528f, 0.04907499782144f, 0.94082298806272f, -0.16964000940032f, 0.04849399758848f, 0.98431196463104f, -0.19371200086016f, 0.0f, 0.98105802358784f, 0.70710697394176f, 0.0f, 0.70710697394176f, -0.45911099047936f, 0.79210295066624f, 0.4022299787264f, -0.55320298651648f, 0.62284202246144f, 0.55320298651648f, -0.69598799986688f, 0.17663900254208f, 0.69598799986688f, -0.67038299029504f, 0.04895899910144f, 0.74039800365056f, -0.55620904419328f, 0.0f, 0.83104203014144f, -0.57775996534784f, 0.79252397490176f, 0.19519099633664f, -0.72238304854016f, 0.62352800088064f, 0.29895600111616f, -0.90940899328f, 0.17701500092416f, 0.37635200385024f, -0.90264601362432f, 0.04906899996672f, 0.42757599002624f, -0.83104203014144f, 0.0f, 0.55620904419328f, -0.60364901318656f, 0.78828999278592f, 0.1191920009216f, -0.77239400005632f, 0.61656201691136f, 0.15251099615232f, -0.96608695877632f, 0.17403500036096f, 0.1907560022016f, -0.9799139852288f, 0.04827700002816f, 0.19348601176064f, -0.98105802358784f, 0.0f, 0.19371200086016f, -0.60364901318656f, 0.78828999278592f, -0.1191920009216f, -0.54673700552704f, 0.79251701235712f, -0.27017701490688f, -0.72238304854016f, 0.62352800088064f, -0.2989569867776f, -0.77239400005632f, 0.61656201691136f, -0.15251099615232f, -0.90940899328f, 0.17701500092416f, -0.37635200385024f, -0.96608695877632f, 0.17403500036096f, -0.1907560022016f, -0.94082298806272f, 0.04907499782144f, -0.33532598550528f, -0.98431196463104f, 0.04849399758848f, -0.16964000940032f, -0.98105802358784f, 0.0f, -0.19371200086016f, 0.70710697394176f, 0.0f, 0.70710697394176f, -0.4022299787264f, 0.79210295066624f, -0.45911099047936f, -0.55320298651648f, 0.62284202246144f, -0.55320298651648f, -0.69598799986688f, 0.17663900254208f, -0.69598799986688f, -0.74039800365056f, 0.04895899910144f, -0.67038299029504f, -0.83104203014144f, 0.0f, -0.55620904419328f, -0.19519099633664f, 0.79252397490176f, -0.57775996534784f, -0.29895600111616f, 0.62352800088064f, -0.72238304854016f, -0.37635200385024f, 0.17701500092416f, -0.90940899328f, -0.42757599002624f, 0.04906899996672f, -0.90264601362432f, -0.55620904419328f, 0.0f, -0.83104203014144f, -0.1191920009216f, 0.78828999278592f, -0.60364901318656f, -0.15251099615232f, 0.61656201691136f, -0.77239400005632f, -0.1907560022016f, 0.17403500036096f, -0.96608695877632f, -0.19348601176064f, 0.04827700002816f, -0.9799139852288f, -0.19371200086016f, 0.0f, -0.98105802358784f, 0.1191920009216f, 0.78828999278592f, -0.60364901318656f, 0.27017701490688f, 0.79251701235712f, -0.54673700552704f, 0.2989569867776f, 0.62352800088064f, -0.72238304854016f, 0.15251099615232f, 0.61656201691136f, -0.77239400005632f, 0.37635200385024f, 0.17701500092416f, -0.90940899328f, 0.1907560022016f, 0.17403500036096f, -0.96608695877632f, 0.33532598550528f, 0.04907499782144f, -0.94082298806272f, 0.16964000940032f, 0.04849399758848f, -0.98431196463104f, 0.19371200086016f, 0.0f, -0.98105802358784f, 0.70710697394176f, 0.0f, 0.70710697394176f, 0.45911099047936f, 0.79210295066624f, -0.4022299787264f, 0.55320298651648f, 0.62284202246144f, -0.55320298651648f, 0.69598799986688f, 0.17663900254208f, -0.69598799986688f, 0.67038299029504f, 0.04895899910144f, -0.74039800365056f, 0.55620904419328f, 0.0f, -0.83104203014144f, 0.57775996534784f, 0.79252397490176f, -0.19519099633664f, 0.72238304854016f, 0.62352800088064f, -0.29895600111616f, 0.90940899328f, 0.17701500092416f, -0.37635200385024f, 0.90264601362432f, 0.04906899996672f, -0.42757599002624f, 0.83104203014144f, 0.0f, -0.55620904419328f, 0.60364901318656f, 0.78828999278592f, -0.1191920009216f, 0.77239400005632f, 0.61656201691136f, -0.15251099615232f, 0.96608695877632f, 0.17403500036096f, -0.1907560022016f, 0.97991499186176f, 0.04827700002816f, -0.19348601176064f, 0.98105802358784f, 0.0f, -0.19371200086016f, 0.99994799439872f, 0.00778699997184f, -0.0066219999232f, 0.99892903018496f, -0.0209460002816f, -0.04125700128768f, 0.97002599743488f, 0.16066100068352f, 0.18230900948992f, 0.99298695970816f, 0.0387829989376f, 0.1116809986048f, 0.86770897125376f, 0.38861598097408f, 0.30993398366208f, 0.96750496907264f, 0.17574100205568f, 0.18179600416768f, 0.6127230124032f, 0.7536170237952f, 0.23797499428864f, 0.78161198972928f, 0.60327500709888f, 0.15856500211712f, 0.13049399345152f, 0.99111202193408f, 0.02585900089344f, 0.16583799865344f, 0.98507700568064f, 0.04606599888896f, 0.98476100681728f, -0.17129499787264f, 0.03004700033024f, 0.94638505459712f, 0.32293800378368f, -0.00813800030208f, 0.6942890131456f, 0.71718102106112f, -0.06011800256512f, 0.40592398614528f, 0.90921999794176f, -0.09244199878656f, 0.14772300939264f, 0.98902602678272f, -0.00247400005632f, 0.9917989650432f, -0.05454899970048f, 0.11557900648448f, 0.99201002242048f, 0.1035830034432f, -0.07202500247552f, 0.8882239832064f, 0.40116600963072f, -0.22388399931392f, 0.6046879842304f, 0.78460697444352f, -0.13691100594176f, 0.12908099534848f, 0.98974904090624f, 0.0611200008192f, 0.99548206727168f, 0.01050299990016f, 0.09436300050432f, 0.99819704025088f, 0.05880200298496f, -0.01206100033536f, 0.95506399232f, 0.27966299963392f, -0.09818999881728f, 0.66069402222592f, 0.74887301431296f, -0.05169999773696f, 0.07273799745536f, 0.99653500534784f, 0.04034300215296f, 0.99991796318208f, 0.01056099991552f, -0.0071909998592f, 0.99890503876608f, -0.01488400023552f, -0.04436499890176f, 0.96947696304128f, 0.1679760031744f, 0.17860298539008f, 0.99246200061952f, 0.0583789969408f, 0.10775600037888f, 0.85674900324352f, 0.4276290060288f, 0.288296009728f, 0.94739999227904f, 0.2765380124672f, 0.16112199663616f, 0.56277799534592f, 0.80267301617664f, 0.1974780035072f, 0.65776698523648f, 0.74448594010112f, 0.11438000177152f, 0.07901199990784f, 0.99687298236416f, -0.001368999936f, 0.0727410016256f, 0.99714603155456f, 0.0202060005376f, 0.9888780517376f, -0.1464750047232f, -0.02580899954688f, 0.94539796709376f, 0.32585000419328f, 0.00666299990016f, 0.69213997760512f, 0.72004799561728f, 0.04972299681792f, 0.3957499887616f, 0.91474800672768f, 0.0813489979392f, 0.13914499710976f, 0.99027198672896f, 0.00007899999744f, 0.99246694989824f, -0.0661680029696f, 0.10311000129536f, 0.99263002443776f, 0.09165900611584f, -0.07926999678976f, 0.90085898846208f, 0.35109499568128f, -0.25531300970496f, 0.65137000054784f, 0.73631602311168f, -0.18317999865856f, 0.15978700210176f, 0.98677804761088f, 0.0271410003968f, 0.99556201070592f, 0.0077310001152f, 0.09379199844352f, 0.99910300991488f, 0.03914900176896f, -0.01610800037888f, 0.97646995832832f, 0.17872000647168f, -0.120689000448f, 0.7859060342784f, 0.61003500879872f, -0.10103499522048f, 0.16579000532992f, 0.98605000032256f, 0.01483200004096f, 0.16553000042496f, 0.9810409947136f, 0.10078699651072f, -0.004679000064f, 0.98454600679424f, 0.17506599174144f, -0.3859579666432f, 0.92022803267584f, 0.06494200266752f, -0.32196700143616f, 0.94509295730688f, 0.05600600129536f, -0.64716101648384f, 0.75363698868224f, 0.11495299612672f, -0.56164402331648f, 0.8236119883776f, 0.07885500186624f, -0.83797001371648f, 0.49132400017408f, 0.23749998936064f, -0.75125906997248f, 0.64394700521472f, 0.14471699365888f, -0.90520898502656f, 0.3190630121472f, 0.28070501154816f, -0.824942002176f, 0.52026302005248f, 0.2209009893376f, -0.13363699515392f, 0.99059998130176f, -0.02919199932416f, -0.40396499451904f, 0.91477199814656f, -0.00195199991808f, -0.71913598615552f, 0.69486497497088f, -0.00244399996928f, -0.96375802953728f, 0.26541899644928f, -0.02688499843072f, -0.96377203851264f, -0.14977200029696f, -0.2207070027776f, 0.03522900000768f, 0.9971190202368f, -0.06716900507648f, -0.36206297481216f, 0.93200303783936f, 0.01676199985152f, -0.6534260064256f, 0.75695703195648f, -0.00712100020224f, -0.85285903794176f, 0.50889402351616f, -0.1168659972096f, -0.88148893761536f, 0.3079349993472f, -0.35798401417216f, 0.07265800159232f, 0.9971529940992f, -0.02018199994368f, -0.37608298119168f, 0.92622202863616f, 0.02595500064768f, -0.65683501088768f, 0.75388403318784f, 0.01502100062208f, -0.82387606175744f, 0.56583396524032f, -0.03257699926016f, -0.86886903185408f, 0.47745402404864f, -0.1307869970432f, 0.07265599881216f, 0.99437997195264f, 0.07700400308224f, -0.03439500197888f, 0.98780204498944f, 0.15187099779072f, -0.40362001301504f, 0.91340104794112f, 0.05282000273408f, -0.3758650032128f, 0.92576401063936f, 0.04107800150016f, -0.68781900562432f, 0.72134797819904f, 0.08100599824384f, -0.65589703868416f, 0.75305096052736f, 0.05210099941376f, -0.87088003284992f, 0.44613201035264f, 0.20623799615488f, -0.8175940009984f, 0.56217800015872f, 0.12448199344128f, -0.89269603401728f, 0.33124299833344f, 0.3055670001664f, -0.85650598526976f, 0.47137698086912f, 0.21024301121536f, -0.15155400278016f, 0.98812198649856f, 0.02541200080896f, -0.41033698115584f, 0.91193002164224f, 0.00264200011776f, -0.72406202843136f, 0.68973500563456f, -0.00047400001536f, -0.9655589797888f, 0.25962299260928f, 0.01707899879424f, -0.9738259529728f, -0.11317299642368f, 0.19711800639488f, 0.06214200066048f, 0.99466401021952f, -0.0823550017536f, -0.33342900666368f, 0.94274397929472f, -0.00762599964672f, -0.60861100064768f, 0.79196294479872f, -0.0488599977984f, -0.82533098192896f, 0.54536404205568f, -0.146312003584f, -0.91056695672832f, 0.26805599731712f, -0.31466599743488f, 0.16523399790592f, 0.98518597369856f, -0.04589800128512f, -0.32260099145728f, 0.9464769937408f, 0.01047100063744f, -0.56391398064128f, 0.8256940408832f, -0.0151660003328f, -0.75896501305344f, 0.64870397509632f, -0.0561739988992f, -0.8382350098432f, 0.52637399515136f, -0.14245300273152f, 0.97278299734016f, 0.2308720033792f, 0.01979400060928f, 0.98281594028032f, 0.18095200534528f, 0.036465999872f, 0.90506394599424f, 0.42467902619648f, 0.02252199952384f, 0.83540393852928f, 0.54869301919744f, 0.03220000210944f, 0.64657003905024f, 0.76147094192128f, 0.04592100179968f, 0.48267496783872f, 0.87443000786944f, 0.04895399739392f, 0.44540002041856f, 0.87854302625792f, -0.17256900722688f, 0.47231201705984f, 0.87061201682432f, -0.1376850018304f, 0.48242498732032f, 0.78439298105344f, -0.38986399612928f, 0.6413980008448f, 0.63700002144256f, -0.42759801012224f, 0.98639401713664f, 0.13091400056832f, -0.09944199856128f, 0.9154840231936f, 0.3419510145024f, -0.21203200770048f, 0.7246469660672f, 0.64407996465152f, -0.24504600363008f, 0.35685499142144f, 0.91687795818496f, -0.17885500014592f, 0.141018005504f, 0.9598140416f, -0.2426319929344f, 0.93667800907776f, 0.30896698687488f, -0.16484401152f, 0.798262034432f, 0.55061300379648f, -0.2441370140672f, 0.47694399668224f, 0.82954499915776f, -0.29048201805824f, 0.4125959913472f, 0.91075100278784f, 0.01724600025088f, 0.34137400410112f, 0.86105605013504f, 0.37689097191424f, 0.902610026496f, 0.40664398036992f, -0.14119600128f, 0.73260196691968f, 0.66410399137792f, -0.1491979993088f, 0.38115599187968f, 0.91092296925184f, -0.15792300097536f, 0.53173704196096f, 0.84663804624896f, 0.02143399968768f, 0.7915729584128f, 0.49811000655872f, 0.35397698584576f, 0.90873404588032f, 0.40971601444864f, 0.07959599906816f, 0.93865696559104f, 0.29607900217344f, 0.17680299982848f, 0.77815697375232f, 0.59713999863808f, 0.19467000086528f, 0.73884703391744f, 0.66948901634048f, 0.07674700234752f, 0.4391599865856f, 0.8703520538624f, 0.22276799987712f, 0.3863859953664f, 0.91894004580352f, 0.07908800069632f, 0.3576120213504f, 0.93099304943616f, -0.0732519989248f, 0.52271400353792f, 0.83703602610176f, -0.16167999635456f, 0.42463800590336f, 0.84566203170816f, -0.32332398460928f, 0.7336190017536f, 0.47180899418112f, -0.48907899895808f, 0.98860198264832f, 0.10573199704064f, 0.10717800431616f, 0.9131960303616f, 0.34106901528576f, 0.2230340026368f, 0.71635600146432f, 0.64893101277184f, 0.25636500406272f, 0.35149699874816f, 0.92246997204992f, 0.15968101203968f, 0.07999800213504f, 0.9742709686272f, 0.210704007168f, 0.98832499081216f, 0.14482199805952f, -0.04732999958528f, 0.92105003237376f, 0.38232301502464f, -0.07413999599616f, 0.68048899801088f, 0.72303895379968f, -0.11895299899392f, 0.49353901211648f, 0.86363898642432f, 0.10269300359168f, 0.39124799062016f, 0.78808799510528f, 0.47522898771968f, 0.97002700406784f, 0.22955199299584f, -0.07970499854336f, 0.83124998373376f, 0.54571497947136f, -0.10592100286464f, 0.47742302814208f, 0.86862198734848f, -0.13252699357184f, 0.4792239783936f, 0.87768898207744f, 0.00241299996672f, 0.69029800706048f, 0.65970601197568f, 0.29711300296704f, 0.63121301438464f, 0.62805600370688f, -0.4550989709312f, 0.26494699044864f, 0.7970649800704f, -0.54266899202048f, 0.42169599524864f, 0.60782599471104f, -0.6728450048f, 0.7324269805568f, 0.35166099603456f, -0.58299701526528f, 0.50867097042944f, -0.02350700036096f, -0.86063997517824f, 0.76407199760384f, -0.01579800068096f, -0.64493698678784f, 0.19029100068864f, -0.9417420439552f, -0.27732899528704f, 0.02588700049408f, -0.99966504665088f, -0.00057500000256f, -0.33045700673536f, -0.83563294752768f, 0.4387669803008f, -0.62712700731392f, -0.62523197882368f, 0.46453900705792f, -0.02311599947776f, 0.96876502188032f, -0.2469020041216f, -0.01295100018688f, 0.89032499396608f, -0.45514099785728f, -0.00118000001024f, 0.14889399615488f, -0.9888520470528f, 0.01952099991552f, -0.72910702116864f, -0.68412101361664f, 0.01225299984384f, -0.99989497839616f, -0.00778499981312f, 0.3314639962112f, 0.86213096636416f, 0.3832260067328f, 0.08274699616256f, 0.98356495908864f, 0.16047699656704f, -0.38162999017472f, 0.66877300670464f, -0.63804398370816f, -0.4498839830528f, -0.42052800741376f, -0.78788398415872f, -0.27801700794368f, -0.75144999469056f, -0.59835601125376f, 0.73781397684224f, 0.4622659878912f, 0.49187500589056f, 0.615338999808f, 0.64340199735296f, 0.45540301602816f, -0.43678898847744f, 0.83521402044416f, -0.3341150060544f, -0.7429530058752f, -0.19959900012544f, -0.63889098145792f, -0.74329500942336f, -0.30037000585216f, -0.5977380225024f, 0.71979197530112f, 0.46337701707776f, -0.51689600057344f, 0.22183099236352f, 0.8657790042112f, -0.4485720047616f, 0.08203200364544f, 0.98394798292992f, -0.15848000454656f, 0.59534596898816f, 0.64345996263424f, -0.48116799635456f, -0.37556401995776f, 0.68749998686208f, 0.62152702427136f, -0.42666301587456f, 0.83994200768512f, 0.33534397906944f, -0.44476399616f, -0.4243259916288f, 0.78875296006144f, -0.7557309530112f, -0.20408600363008f, 0.62227000328192f, -0.42926700756992f, -0.72679797293056f, 0.53618501746688f, -0.76559000010752f, -0.30375199899648f, 0.56710400049152f, 0.00734799986688f, 0.97742894399488f, 0.21113499287552f, -0.01990099992576f, 0.89908496564224f, 0.4373209939968f, -0.00877500039168f, 0.1640049934336f, 0.98641993793536f, 0.02485599862784f, -0.73005703102464f, 0.6829339836416f, 0.01451399970816f, -0.99922598690816f, -0.03655200145408f, 0.40192899547136f, 0.78724301062144f, 0.46765499744256f, 0.41696100352f, 0.60154900905984f, 0.68138200727552f, 0.50336098156544f, -0.02283899977728f, 0.86377404301312f, 0.20588200460288f, -0.93318700597248f, 0.29457500864512f, -0.2351590014976f, -0.79891995295744f, -0.55355799240704f, 0.65338200817664f, 0.61915598422016f, 0.43558799147008f, 0.75555001073664f, 0.3489600110592f, 0.55441098801152f, 0.77651599425536f, -0.01814199926784f, 0.62983602438144f, 0.02597499961344f, -0.99962796900352f, -0.00826499989504f, -0.60865197899776f, -0.61980199092224f, -0.49536697368576f, -0.98131999981568f, 0.0f, -0.19238100140032f, -0.83165095919616f, 0.0f, -0.55529896411136f, -0.44256399982592f, 0.81078899441664f, -0.38308998545408f, -0.56235097325568f, 0.81951398559744f, -0.1102640054272f, 0.367917006848f, 0.91738597228544f, 0.15178600022016f, 0.39606699425792f, 0.91492399972352f, 0.07774799921152f, 0.32835201138688f, 0.93476700028928f, 0.13562799980544f, 0.35307500077056f, 0.93300799307776f, 0.0695230005248f, -0.593559027712f, 0.7794510004224f, -0.20035800137728f, -0.62018002354176f, 0.77484297027584f, -0.12245599780864f, -0.55529896411136f, 0.0f, -0.83165095919616f, -0.26169600638976f, 0.81069202210816f, -0.5237309964288f, 0.28196399480832f, 0.91706997342208f, 0.28191997558784f, 0.2516979810304f, 0.9345270022144f, 0.2516119977984f, -0.47103300599808f, 0.7797269856256f, -0.4124970057728f, -0.19238100140032f, 0.0f, -0.98131999981568f, -0.04031100223488f, 0.81072196943872f, -0.58404202610688f, 0.15178500407296f, 0.91739603861504f, 0.367894986752f, 0.13561999917056f, 0.9347899850752f, 0.32828997763072f, -0.27737798475776f, 0.77952800784384f, -0.5616019963904f, -1.00000000376832f, 0.0f, 0.0f, 0.2907499921408f, 0.78892199051264f, -0.54135600709632f, 0.07767199842304f, 0.9149270196224f, 0.3960739987456f, 0.06937299648512f, 0.93301302624256f, 0.35309400096768f, -0.12221000187904f, 0.77485504987136f, -0.62021399740416f, 0.19238100140032f, 0.0f, -0.98131999981568f, 0.55529896411136f, 0.0f, -0.83165095919616f, 0.38308998545408f, 0.81078899441664f, -0.44256399982592f, 0.1102640054272f, 0.81951398559744f, -0.56235097325568f, -0.15178600022016f, 0.91738597228544f, 0.367917006848f, -0.07774799921152f, 0.91492399972352f, 0.39606699425792f, -0.13562799980544f, 0.93476700028928f, 0.32835201138688f, -0.0695230005248f, 0.93300799307776f, 0.35307500077056f, 0.20035800137728f, 0.7794510004224f, -0.593559027712f, 0.12245599780864f, 0.77484297027584f, -0.62018002354176f, 0.83165095919616f, 0.0f, -0.55529896411136f, 0.5237309964288f, 0.81069202210816f, -0.26169600638976f, -0.28191997558784f, 0.91706997342208f, 0.28196399480832f, -0.2516119977984f, 0.9345270022144f, 0.2516979810304f, 0.4124970057728f, 0.7797269856256f, -0.47103300599808f, 0.98131999981568f, 0.0f, -0.19238100140032f, 0.58404202610688f, 0.81072196943872f, -0.04031100223488f, -0.367894986752f, 0.91739603861504f, 0.15178500407296f, -0.32828997763072f, 0.9347899850752f, 0.13561999917056f, 0.5616019963904f, 0.77952800784384f, -0.27737798475776f, -1.00000000376832f, 0.0f, 0.0f, 0.54135600709632f, 0.78892199051264f, 0.2907499921408f, -0.3960739987456f, 0.9149270196224f, 0.07767199842304f, -0.35309400096768f, 0.93301302624256f, 0.06937299648512f, 0.62021399740416f, 0.77485504987136f, -0.12221000187904f, 0.98131999981568f, 0.0f, 0.19238100140032f, 0.83165095919616f, 0.0f, 0.55529896411136f, 0.44256399982592f, 0.81078899441664f, 0.38308998545408f, 0.56235097325568f, 0.81951398559744f, 0.1102640054272f, -0.367917006848f, 0.91738597228544f, -0.15178600022016f, -0.39606699425792f, 0.91492399972352f, -0.07774799921152f, -0.32835201138688f, 0.93476700028928f, -0.13562799980544f, -0.35307500077056f, 0.93300799307776f, -0.0695230005248f, 0.593559027712f, 0.7794510004224f, 0.20035800137728f, 0.62018002354176f, 0.77484297027584f, 0.12245599780864f, 0.55529896411136f, 0.0f, 0.83165095919616f, 0.26169600638976f, 0.81069202210816f, 0.5237309964288f, -0.28196399480832f, 0.91706997342208f, -0.28191997558784f, -0.2516979810304f, 0.9345270022144f, -0.2516119977984f, 0.47103300599808f, 0.7797269856256f, 0.4124970057728f, 0.19238100140032f, 0.0f, 0.98131999981568f, 0.04031100223488f, 0.81072196943872f, 0.58404202610688f, -0.15178500407296f, 0.91739603861504f, -0.367894986752f, -0.13561999917056f, 0.9347899850752f, -0.32828997763072f, 0.27737798475776f, 0.77952800784384f, 0.5616019963904f, -1.00000000376832f, 0.0f, 0.0f, -0.2907499921408f, 0.78892199051264f, 0.54135600709632f, -0.07767199842304f, 0.9149270196224f, -0.3960739987456f, -0.06937299648512f, 0.93301302624256f, -0.35309400096768f, 0.12221000187904f, 0.77485504987136f, 0.62021399740416f, -0.19238100140032f, 0.0f, 0.98131999981568f, -0.55529896411136f, 0.0f, 0.83165095919616f, -0.38308998545408f, 0.81078899441664f, 0.44256399982592f, -0.1102640054272f, 0.81951398559744f, 0.56235097325568f, 0.15178600022016f, 0.91738597228544f, -0.367917006848f, 0.07774799921152f, 0.91492399972352f, -0.39606699425792f, 0.13562799980544f, 0.93476700028928f, -0.32835201138688f, 0.0695230005248f, 0.93300799307776f, -0.35307500077056f, -0.20035800137728f, 0.7794510004224f, 0.593559027712f, -0.12245599780864f, 0.77484297027584f, 0.62018002354176f, -0.83165095919616f, 0.0f, 0.55529896411136f, -0.5237309964288f, 0.81069202210816f, 0.26169600638976f, 0.28191997558784f, 0.91706997342208f, -0.28196399480832f, 0.2516119977984f, 0.9345270022144f, -0.2516979810304f, -0.4124970057728f, 0.7797269856256f, 0.47103300599808f, -0.98131999981568f, 0.0f, 0.19238100140032f, -0.58404202610688f, 0.81072196943872f, 0.04031100223488f, 0.367894986752f, 0.91739603861504f, -0.15178500407296f, 0.32828997763072f, 0.9347899850752f, -0.13561999917056f, -0.5616019963904f, 0.77952800784384f, 0.27737798475776f, -1.00000000376832f, 0.0f, 0.0f, -0.54135600709632f, 0.78892199051264f, -0.2907499921408f, 0.3960739987456f, 0.9149270196224f, -0.07767199842304f, 0.35309400096768f, 0.93301302624256f, -0.06937299648512f, -0.62021399740416f, 0.77485504987136f, 0.12221000187904f, -0.62018002354176f, 0.77484297027584f, -0.12245599780864f, -0.56164700127232f, 0.77943497818112f, -0.27755099979776f, -0.89792104628224f, 0.2359099916288f, -0.37159599865856f, -0.95420994813952f, 0.23234600763392f, -0.18841098780672f, -0.91012001169408f, 0.17268399407104f, -0.37664501792768f, -0.9667950411776f, 0.16990099996672f, -0.19089600806912f, -0.85498798276608f, 0.37920798932992f, -0.35383299538944f, -0.91004996681728f, 0.37352298774528f, -0.1796910088192f, -0.80641500643328f, 0.52486001917952f, -0.27242899963904f, -0.83834095796224f, 0.51940696260608f, -0.16553199271936f, -0.4125959913472f, 0.77972799225856f, -0.47094500950016f, -0.68719296380928f, 0.23565199998976f, -0.68719296380928f, -0.69651899875328f, 0.17240400330752f, -0.69651899875328f, -0.65448804614144f, 0.37853899784192f, -0.65448699756544f, -0.64049702240256f, 0.52429097795584f, -0.56114297176064f, -0.20047900704768f, 0.77954503671808f, -0.59339498848256f, -0.37159700529152f, 0.2359099916288f, -0.89792104628224f, -0.37664501792768f, 0.17268399407104f, -0.91012001169408f, -0.35383299538944f, 0.37920798932992f, -0.85498798276608f, -0.37707300470784f, 0.52490598875136f, -0.7630789541888f, -0.122458996736f, 0.7748309745664f, -0.62019403251712f, -0.18841098780672f, 0.23234600763392f, -0.95420994813952f, -0.19089600806912f, 0.16990099996672f, -0.9667950411776f, -0.17969199448064f, 0.37352298774528f, -0.91004996681728f, -0.16553199271936f, 0.51940696260608f, -0.83834095796224f, 0.12245599780864f, 0.77484297027584f, -0.62018002354176f, 0.27755099979776f, 0.77943497818112f, -0.56164700127232f, 0.37159599865856f, 0.2359099916288f, -0.89792104628224f, 0.18841098780672f, 0.23234600763392f, -0.95420994813952f, 0.37664501792768f, 0.17268399407104f, -0.91012001169408f, 0.19089600806912f, 0.16990099996672f, -0.9667950411776f, 0.35383299538944f, 0.37920798932992f, -0.85498798276608f, 0.1796910088192f, 0.37352298774528f, -0.91004996681728f, 0.27242899963904f, 0.52486001917952f, -0.80641500643328f, 0.16553199271936f, 0.51940696260608f, -0.83834095796224f, 0.47094500950016f, 0.77972799225856f, -0.4125959913472f, 0.68719296380928f, 0.23565199998976f, -0.68719296380928f, 0.69651899875328f, 0.17240400330752f, -0.69651899875328f, 0.65448699756544f, 0.37853899784192f, -0.65448804614144f, 0.56114297176064f, 0.52429097795584f, -0.64049702240256f, 0.59339498848256f, 0.77954503671808f, -0.20047900704768f, 0.89792104628224f, 0.2359099916288f, -0.37159700529152f, 0.91012001169408f, 0.17268399407104f, -0.37664501792768f, 0.85498798276608f, 0.37920798932992f, -0.35383299538944f, 0.7630789541888f, 0.52490598875136f, -0.37707300470784f, 0.62019403251712f, 0.7748309745664f, -0.122458996736f, 0.95420994813952f, 0.23234600763392f, -0.18841098780672f, 0.9667950411776f, 0.16990099996672f, -0.19089600806912f, 0.91004996681728f, 0.37352298774528f, -0.17969199448064f, 0.83834095796224f, 0.51940696260608f, -0.16553199271936f, 0.62018002354176f, 0.77484297027584f, 0.12245599780864f, 0.56164700127232f, 0.77943497818112f, 0.27755099979776f, 0.89792104628224f, 0.2359099916288f, 0.37159599865856f, 0.95420994813952f, 0.23234600763392f, 0.18841098780672f, 0.91012001169408f, 0.17268399407104f, 0.37664501792768f, 0.9667950411776f, 0.16990099996672f, 0.19089600806912f, 0.85498798276608f, 0.37920798932992f, 0.35383299538944f, 0.91004996681728f, 0.37352298774528f, 0.1796910088192f, 0.80641500643328f, 0.52486001917952f, 0.27242899963904f, 0.83834095796224f, 0.51940696260608f, 0.16553199271936f, 0.4125959913472f, 0.77972799225856f, 0.47094500950016f, 0.68719296380928f, 0.23565199998976f, 0.68719296380928f, 0.69651899875328f, 0.17240400330752f, 0.69651899875328f, 0.65448804614144f, 0.37853899784192f, 0.65448699756544f, 0.64049702240256f, 0.52429097795584f, 0.56114297176064f, 0.20047900704768f, 0.77954503671808f, 0.59339498848256f, 0.37159700529152f, 0.2359099916288f, 0.89792104628224f, 0.37664501792768f, 0.17268399407104f, 0.91012001169408f, 0.35383299538944f, 0.37920798932992f, 0.85498798276608f, 0.37707300470784f, 0.52490598875136f, 0.7630789541888f, 0.122458996736f, 0.7748309745664f, 0.62019403251712f, 0.18841098780672f, 0.23234600763392f, 0.95420994813952f, 0.19089600806912f, 0.16990099996672f, 0.9667950411776f, 0.17969199448064f, 0.37352298774528f, 0.91004996681728f, 0.16553199271936f, 0.51940696260608f, 0.83834095796224f, -0.12245599780864f, 0.77484297027584f, 0.62018002354176f, -0.27755099979776f, 0.77943497818112f, 0.56164700127232f, -0.37159599865856f, 0.2359099916288f, 0.89792104628224f, -0.18841098780672f, 0.23234600763392f, 0.95420994813952f, -0.37664501792768f, 0.17268399407104f, 0.91012001169408f, -0.19089600806912f, 0.16990099996672f, 0.9667950411776f, -0.35383299538944f, 0.37920798932992f, 0.85498798276608f, -0.1796910088192f, 0.37352298774528f, 0.91004996681728f, -0.27242899963904f, 0.52486001917952f, 0.80641500643328f, -0.16553199271936f, 0.51940696260608f, 0.83834095796224f, -0.47094500950016f, 0.77972799225856f, 0.4125959913472f, -0.68719296380928f, 0.23565199998976f, 0.68719296380928f, -0.69651899875328f, 0.17240400330752f, 0.69651899875328f, -0.65448699756544f, 0.37853899784192f, 0.65448804614144f, -0.56114297176064f, 0.52429097795584f, 0.64049702240256f, -0.59339498848256f, 0.77954503671808f, 0.20047900704768f, -0.89792104628224f, 0.2359099916288f, 0.37159700529152f, -0.91012001169408f, 0.17268399407104f, 0.37664501792768f, -0.85498798276608f, 0.37920798932992f, 0.35383299538944f, -0.7630789541888f, 0.52490598875136f, 0.37707300470784f, -0.62019403251712f, 0.7748309745664f, 0.122458996736f, -0.95420994813952f, 0.23234600763392f, 0.18841098780672f, -0.9667950411776f, 0.16990099996672f, 0.19089600806912f, -0.91004996681728f, 0.37352298774528f, 0.17969199448064f, -0.83834095796224f, 0.51940696260608f, 0.16553199271936f };
-
   inline static const float texCoords[] = { 2.0f, 2.0f, 0.0f, 1.75f, 2.0f, 0.0f, 1.75f, 1.975000023841858f, 0.0f, 2.0f, 1.975000023841858f, 0.0f, 1.75f, 1.9500000476837158f, 0.0f, 2.0f, 1.9500000476837158f, 0.0f, 1.75f, 1.9249999523162842f, 0.0f, 2.0f, 1.9249999523162842f, 0.0f, 1.75f, 1.899999976158142f, 0.0f, 2.0f, 1.899999976158142f, 0.0f, 1.5f, 2.0f, 0.0f, 1.5f, 1.975000023841858f, 0.0f, 1.5f, 1.9500000476837158f, 0.0f, 1.5f, 1.9249999523162842f, 0.0f, 1.5f, 1.899999976158142f, 0.0f, 1.25f, 2.0f, 0.0f, 1.25f, 1.975000023841858f, 0.0f, 1.25f, 1.9500000476837158f, 0.0f, 1.25f, 1.9249999523162842f, 0.0f, 1.25f, 1.899999976158142f, 0.0f, 1.0f, 2.0f, 0.0f, 1.0f, 1.975000023841858f, 0.0f, 1.0f, 1.9500000476837158f, 0.0f, 1.0f, 1.9249999523162842f, 0.0f, 1.0f, 1.899999976158142f, 0.0f, 1.0f, 2.0f, 0.0f, 0.75f, 2.0f, 0.0f, 0.75f, 1.975000023841858f, 0.0f, 1.0f, 1.975000023841858f, 0.0f, 0.75f, 1.9500000476837158f, 0.0f, 1.0f, 1.9500000476837158f, 0.0f, 0.75f, 1.9249999523162842f, 0.0f, 1.0f, 1.9249999523162842f, 0.0f, 0.75f, 1.899999976158142f, 0.0f, 1.0f, 1.899999976158142f, 0.0f, 0.5f, 2.0f, 0.0f, 0.5f, 1.975000023841858f, 0.0f, 0.5f, 1.9500000476837158f, 0.0f, 0.5f, 1.9249999523162842f, 0.0f, 0.5f, 1.899999976158142f, 0.0f, 0.25f, 2.0f, 0.0f, 0.25f, 1.975000023841858f, 0.0f, 0.25f, 1.9500000476837158f, 0.0f, 0.25f, 1.9249999523162842f, 0.0f, 0.25f, 1.899999976158142f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 1.975000023841858f, 0.0f, 0.0f, 1.9500000476837158f, 0.0f, 0.0f, 1.9249999523162842f, 0.0f, 0.0f, 1.899999976158142f, 0.0f, 2.0f, 2.0f, 0.0f, 1.75f, 2.0f, 0.0f, 1.75f, 1.975000023841858f, 0.0f, 2.0f, 1.975000023841858f, 0.0f, 1.75f, 1.9500000476837158f, 0.0f, 2.0f, 1.9500000476837158f, 0.0f, 1.75f, 1.9249999523162842f, 0.0f, 2.0f, 1.9249999523162842f, 0.0f, 1.75f, 1.899999976158142f, 0.0f, 2.0f, 1.899999976158142f, 0.0f, 1.5f, 2.0f, 0.0f, 1.5f, 1.975000023841858f, 0.0f, 1.5f, 1.9500000476837158f, 0.0f, 1.5f, 1.9249999523162842f, 0.0f, 1.5f, 1.899999976158142f, 0.0f, 1.25f, 2.0f, 0.0f, 1.25f, 1.975000023841858f, 0.0f, 1.25f, 1.9500000476837158f, 0.0f, 1.25f, 1.9249999523162842f, 0.0f, 1.25f, 1.899999976158142f, 0.0f, 1.0f, 2.0f, 0.0f, 1.0f, 1.975000023841858f, 0.0f, 1.0f, 1.9500000476837158f, 0.0f, 1.0f, 1.9249999523162842f, 0.0f, 1.0f, 1.899999976158142f, 0.0f, 1.0f, 2.0f, 0.0f, 0.75f, 2.0f, 0.0f, 0.75f, 1.975000023841858f, 0.0f, 1.0f, 1.975000023841858f, 0.0f, 0.75f, 1.9500000476837158f, 0.0f, 1.0f, 1.9500000476837158f, 0.0f, 0.75f, 1.9249999523162842f, 0.0f, 1.0f, 1.9249999523162842f, 0.0f, 0.75f, 1.899999976158142f, 0.0f, 1.0f, 1.899999976158142f, 0.0f, 0.5f, 2.0f, 0.0f, 0.5f, 1.975000023841858f, 0.0f, 0.5f, 1.9500000476837158f, 0.0f, 0.5f, 1.9249999523162842f, 0.0f, 0.5f, 1.899999976158142f, 0.0f, 0.25f, 2.0f, 0.0f, 0.25f, 1.975000023841858f, 0.0f, 0.25f, 1.9500000476837158f, 0.0f, 0.25f, 1.9249999523162842f, 0.0f, 0.25f, 1.899999976158142f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 1.975000023841858f, 0.0f, 0.0f, 1.9500000476837158f, 0.0f, 0.0f, 1.9249999523162842f, 0.0f, 0.0f, 1.899999976158142f, 0.0f, 2.0f, 1.899999976158142f, 0.0f, 1.75f, 1.899999976158142f, 0.0f, 1.75f, 1.6749999523162842f, 0.0f, 2.0f, 1.6749999523162842f, 0.0f, 1.75f, 1.4500000476837158f, 0.0f, 2.0f, 1.4500000476837158f, 0.0f, 1.75f, 1.225000023841858f, 0.0f, 2.0f, 1.225000023841858f, 0.0f, 1.75f, 1.0f, 0.0f, 2.0f, 1.0f, 0.0f, 1.5f, 1.899999976158142f, 0.0f, 1.5f, 1.6749999523162842f, 0.0f, 1.5f, 1.4500000476837158f, 0.0f, 1.5f, 1.225000023841858f, 0.0f, 1.5f, 1.0f, 0.0f, 1.25f, 1.899999976158142f, 0.0f, 1.25f, 1.6749999523162842f, 0.0f, 1.25f, 1.4500000476837158f, 0.0f, 1.25f, 1.225000023841858f, 0.0f, 1.25f, 1.0f, 0.0f, 1.0f, 1.899999976158142f, 0.0f, 1.0f, 1.6749999523162842f, 0.0f, 1.0f, 1.4500000476837158f, 0.0f, 1.0f, 1.225000023841858f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f, 1.899999976158142f, 0.0f, 0.75f, 1.899999976158142f, 0.0f, 0.75f, 1.6749999523162842f, 0.0f, 1.0f, 1.6749999523162842f, 0.0f, 0.75f, 1.4500000476837158f, 0.0f, 1.0f, 1.4500000476837158f, 0.0f, 0.75f, 1.225000023841858f, 0.0f, 1.0f, 1.225000023841858f, 0.0f, 0.75f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.5f, 1.899999976158142f, 0.0f, 0.5f, 1.6749999523162842f, 0.0f, 0.5f, 1.4500000476837158f, 0.0f, 0.5f, 1.225000023841858f, 0.0f, 0.5f, 1.0f, 0.0f, 0.25f, 1.899999976158142f, 0.0f, 0.25f, 1.6749999523162842f, 0.0f, 0.25f, 1.4500000476837158f, 0.0f, 0.25f, 1.225000023841858f, 0.0f, 0.25f, 1.0f, 0.0f, 0.0f, 1.899999976158142f, 0.0f, 0.0f, 1.6749999523162842f, 0.0f, 0.0f, 1.4500000476837158f, 0.0f, 0.0f, 1.225000023841858f, 0.0f, 0.0f, 1.0f, 0.0f, 2.0f, 1.899999976158142f, 0.0f, 1.75f, 1.899999976158142f, 0.0f, 1.75f, 1.6749999523162842f, 0.0f, 2.0f, 1.6749999523162842f, 0.0f, 1.75f, 1.4500000476837158f, 0.0f, 2.0f, 1.4500000476837158f, 0.0f, 1.75f, 1.225000023841858f, 0.0f, 2.0f, 1.225000023841858f, 0.0f, 1.75f, 1.0f, 0.0f, 2.0f, 1.0f, 0.0f, 1.5f, 1.899999976158142f, 0.0f, 1.5f, 1.6749999523162842f, 0.0f, 1.5f, 1.4500000476837158f, 0.0f, 1.5f, 1.225000023841858f, 0.0f, 1.5f, 1.0f, 0.0f, 1.25f, 1.899999976158142f, 0.0f, 1.25f, 1.6749999523162842f, 0.0f, 1.25f, 1.4500000476837158f, 0.0f, 1.25f, 1.225000023841858f, 0.0f, 1.25f, 1.0f, 0.0f, 1.0f, 1.899999976158142f, 0.0f, 1.0f, 1.6749999523162842f, 0.0f, 1.0f, 1.4500000476837158f, 0.0f, 1.0f, 1.225000023841858f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f, 1.899999976158142f, 0.0f, 0.75f, 1.899999976158142f, 0.0f, 0.75f, 1.6749999523162842f, 0.0f, 1.0f, 1.6749999523162842f, 0.0f, 0.75f, 1.4500000476837158f, 0.0f, 1.0f, 1.4500000476837158f, 0.0f, 0.75f, 1.225000023841858f, 0.0f, 1.0f, 1.225000023841858f, 0.0f, 0.75f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.5f, 1.899999976158142f, 0.0f, 0.5f, 1.6749999523162842f, 0.0f, 0.5f, 1.4500000476837158f, 0.0f, 0.5f, 1.225000023841858f, 0.0f, 0.5f, 1.0f, 0.0f, 0.25f, 1.899999976158142f, 0.0f, 0.25f, 1.6749999523162842f, 0.0f, 0.25f, 1.4500000476837158f, 0.0f, 0.25f, 1.225000023841858f, 0.0f, 0.25f, 1.0f, 0.0f, 0.0f, 1.899999976158142f, 0.0f, 0.0f, 1.6749999523162842f, 0.0f, 0.0f, 1.4500000476837158f, 0.0f, 0.0f, 1.225000023841858f, 0.0f, 0.0f, 1.0f, 0.0f, 2.0f, 1.0f, 0.0f, 1.75f, 1.0f, 0.0f, 1.75f, 0.8500000238418579f, 0.0f, 2.0f, 0.8500000238418579f, 0.0f, 1.75f, 0.699999988079071f, 0.0f, 2.0f, 0.699999988079071f, 0.0f, 1.75f, 0.550000011920929f, 0.0f, 2.0f, 0.550000011920929f, 0.0f, 1.75f, 0.4000000059604645f, 0.0f, 2.0f, 0.4000000059604645f, 0.0f, 1.5f, 1.0f, 0.0f, 1.5f, 0.8500000238418579f, 0.0f, 1.5f, 0.699999988079071f, 0.0f, 1.5f, 0.550000011920929f, 0.0f, 1.5f, 0.4000000059604645f, 0.0f, 1.25f, 1.0f, 0.0f, 1.25f, 0.8500000238418579f, 0.0f, 1.25f, 0.699999988079071f, 0.0f, 1.25f, 0.550000011920929f, 0.0f, 1.25f, 0.4000000059604645f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f, 0.8500000238418579f, 0.0f, 1.0f, 0.699999988079071f, 0.0f, 1.0f, 0.550000011920929f, 0.0f, 1.0f, 0.4000000059604645f, 0.0f, 1.0f, 1.0f, 0.0f, 0.75f, 1.0f, 0.0f, 0.75f, 0.8500000238418579f, 0.0f, 1.0f, 0.8500000238418579f, 0.0f, 0.75f, 0.699999988079071f, 0.0f, 1.0f, 0.699999988079071f, 0.0f, 0.75f, 0.550000011920929f, 0.0f, 1.0f, 0.550000011920929f, 0.0f, 0.75f, 0.4000000059604645f, 0.0f, 1.0f, 0.4000000059604645f, 0.0f, 0.5f, 1.0f, 0.0f, 0.5f, 0.8500000238418579f, 0.0f, 0.5f, 0.699999988079071f, 0.0f, 0.5f, 0.550000011920929f, 0.0f, 0.5f, 0.4000000059604645f, 0.0f, 0.25f, 1.0f, 0.0f, 0.25f, 0.8500000238418579f, 0.0f, 0.25f, 0.699999988079071f, 0.0f, 0.25f, 0.550000011920929f, 0.0f, 0.25f, 0.4000000059604645f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.8500000238418579f, 0.0f, 0.0f, 0.699999988079071f, 0.0f, 0.0f, 0.550000011920929f, 0.0f, 0.0f, 0.4000000059604645f, 0.0f, 2.0f, 1.0f, 0.0f, 1.75f, 1.0f, 0.0f, 1.75f, 0.8500000238418579f, 0.0f, 2.0f, 0.8500000238418579f, 0.0f, 1.75f, 0.699999988079071f, 0.0f, 2.0f, 0.699999988079071f, 0.0f, 1.75f, 0.550000011920929f, 0.0f, 2.0f, 0.550000011920929f, 0.0f, 1.75f, 0.4000000059604645f, 0.0f, 2.0f, 0.4000000059604645f, 0.0f, 1.5f, 1.0f, 0.0f, 1.5f, 0.8500000238418579f, 0.0f, 1.5f, 0.699999988079071f, 0.0f, 1.5f, 0.550000011920929f, 0.0f, 1.5f, 0.4000000059604645f, 0.0f, 1.25f, 1.0f, 0.0f, 1.25f, 0.8500000238418579f, 0.0f, 1.25f, 0.699999988079071f, 0.0f, 1.25f, 0.550000011920929f, 0.0f, 1.25f, 0.4000000059604645f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f, 0.8500000238418579f, 0.0f, 1.0f, 0.699999988079071f, 0.0f, 1.0f, 0.550000011920929f, 0.0f, 1.0f, 0.4000000059604645f, 0.0f, 1.0f, 1.0f, 0.0f, 0.75f, 1.0f, 0.0f, 0.75f, 0.8500000238418579f, 0.0f, 1.0f, 0.8500000238418579f, 0.0f, 0.75f, 0.699999988079071f, 0.0f, 1.0f, 0.699999988079071f, 0.0f, 0.75f, 0.550000011920929f, 0.0f, 1.0f, 0.550000011920929f, 0.0f, 0.75f, 0.4000000059604645f, 0.0f, 1.0f, 0.4000000059604645f, 0.0f, 0.5f, 1.0f, 0.0f, 0.5f, 0.8500000238418579f, 0.0f, 0.5f, 0.699999988079071f, 0.0f, 0.5f, 0.550000011920929f, 0.0f, 0.5f, 0.4000000059604645f, 0.0f, 0.25f, 1.0f, 0.0f, 0.25f, 0.8500000238418579f, 0.0f, 0.25f, 0.699999988079071f, 0.0f, 0.25f, 0.550000011920929f, 0.0f, 0.25f, 0.4000000059604645f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.8500000238418579f, 0.0f, 0.0f, 0.699999988079071f, 0.0f, 0.0f, 0.550000011920929f, 0.0f, 0.0f, 0.4000000059604645f, 0.0f, 2.0f, 0.4000000059604645f, 0.0f, 1.75f, 0.4000000059604645f, 0.0f, 1.75f, 0.30000001192092896f, 0.0f, 2.0f, 0.30000001192092896f, 0.0f, 1.75f, 0.20000000298023224f, 0.0f, 2.0f, 0.20000000298023224f, 0.0f, 1.75f, 0.10000000149011612f, 0.0f, 2.0f, 0.10000000149011612f, 0.0f, 1.75f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 1.5f, 0.4000000059604645f, 0.0f, 1.5f, 0.30000001192092896f, 0.0f, 1.5f, 0.20000000298023224f, 0.0f, 1.5f, 0.10000000149011612f, 0.0f, 1.5f, 0.0f, 0.0f, 1.25f, 0.4000000059604645f, 0.0f, 1.25f, 0.30000001192092896f, 0.0f, 1.25f, 0.20000000298023224f, 0.0f, 1.25f, 0.10000000149011612f, 0.0f, 1.25f, 0.0f, 0.0f, 1.0f, 0.4000000059604645f, 0.0f, 1.0f, 0.30000001192092896f, 0.0f, 1.0f, 0.20000000298023224f, 0.0f, 1.0f, 0.10000000149011612f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.4000000059604645f, 0.0f, 0.75f, 0.4000000059604645f, 0.0f, 0.75f, 0.30000001192092896f, 0.0f, 1.0f, 0.30000001192092896f, 0.0f, 0.75f, 0.20000000298023224f, 0.0f, 1.0f, 0.20000000298023224f, 0.0f, 0.75f, 0.10000000149011612f, 0.0f, 1.0f, 0.10000000149011612f, 0.0f, 0.75f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.5f, 0.4000000059604645f, 0.0f, 0.5f, 0.30000001192092896f, 0.0f, 0.5f, 0.20000000298023224f, 0.0f, 0.5f, 0.10000000149011612f, 0.0f, 0.5f, 0.0f, 0.0f, 0.25f, 0.4000000059604645f, 0.0f, 0.25f, 0.30000001192092896f, 0.0f, 0.25f, 0.20000000298023224f, 0.0f, 0.25f, 0.10000000149011612f, 0.0f, 0.25f, 0.0f, 0.0f, 0.0f, 0.4000000059604645f, 0.0f, 0.0f, 0.30000001192092896f, 0.0f, 0.0f, 0.20000000298023224f, 0.0f, 0.0f, 0.10000000149011612f, 0.0f, 0.0f, 0.0f, 0.0f, 2.0f, 0.4000000059604645f, 0.0f, 1.75f, 0.4000000059604645f, 0.0f, 1.75f, 0.30000001192092896f, 0.0f, 2.0f, 0.30000001192092896f, 0.0f, 1.75f, 0.20000000298023224f, 0.0f, 2.0f, 0.20000000298023224f, 0.0f, 1.75f, 0.10000000149011612f, 0.0f, 2.0f, 0.10000000149011612f, 0.0f, 1.75f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 1.5f, 0.4000000059604645f, 0.0f, 1.5f, 0.30000001192092896f, 0.0f, 1.5f, 0.20000000298023224f, 0.0f, 1.5f, 0.10000000149011612f, 0.0f, 1.5f, 0.0f, 0.0f, 1.25f, 0.4000000059604645f, 0.0f, 1.25f, 0.30000001192092896f, 0.0f, 1.25f, 0.20000000298023224f, 0.0f, 1.25f, 0.10000000149011612f, 0.0f, 1.25f, 0.0f, 0.0f, 1.0f, 0.4000000059604645f, 0.0f, 1.0f, 0.30000001192092896f, 0.0f, 1.0f, 0.20000000298023224f, 0.0f, 1.0f, 0.10000000149011612f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.4000000059604645f, 0.0f, 0.75f, 0.4000000059604645f, 0.0f, 0.75f, 0.30000001192092896f, 0.0f, 1.0f, 0.30000001192092896f, 0.0f, 0.75f, 0.20000000298023224f, 0.0f, 1.0f, 0.20000000298023224f, 0.0f, 0.75f, 0.10000000149011612f, 0.0f, 1.0f, 0.10000000149011612f, 0.0f, 0.75f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.5f, 0.4000000059604645f, 0.0f, 0.5f, 0.30000001192092896f, 0.0f, 0.5f, 0.20000000298023224f, 0.0f, 0.5f, 0.10000000149011612f, 0.0f, 0.5f, 0.0f, 0.0f, 0.25f, 0.4000000059604645f, 0.0f, 0.25f, 0.30000001192092896f, 0.0f, 0.25f, 0.20000000298023224f, 0.0f, 0.25f, 0.10000000149011612f, 0.0f, 0.25f, 0.0f, 0.0f, 0.0f, 0.4000000059604645f, 0.0f, 0.0f, 0.30000001192092896f, 0.0f, 0.0f, 0.20000000298023224f, 0.0f, 0.0f, 0.10000000149011612f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.875f, 1.0f, 0.0f, 0.875f, 0.875f, 0.0f, 1.0f, 0.875f, 0.0f, 0.875f, 0.75f, 0.0f, 1.0f, 0.75f, 0.0f, 0.875f, 0.625f, 0.0f, 1.0f, 0.625f, 0.0f, 0.875f, 0.5f, 0.0f, 1.0f, 0.5f, 0.0f, 0.75f, 1.0f, 0.0f, 0.75f, 0.875f, 0.0f, 0.75f, 0.75f, 0.0f, 0.75f, 0.625f, 0.0f, 0.75f, 0.5f, 0.0f, 0.625f, 1.0f, 0.0f, 0.625f, 0.875f, 0.0f, 0.625f, 0.75f, 0.0f, 0.625f, 0.625f, 0.0f, 0.625f, 0.5f, 0.0f, 0.5f, 1.0f, 0.0f, 0.5f, 0.875f, 0.0f, 0.5f, 0.75f, 0.0f, 0.5f, 0.625f, 0.0f, 0.5f, 0.5f, 0.0f, 0.5f, 1.0f, 0.0f, 0.375f, 1.0f, 0.0f, 0.375f, 0.875f, 0.0f, 0.5f, 0.875f, 0.0f, 0.375f, 0.75f, 0.0f, 0.5f, 0.75f, 0.0f, 0.375f, 0.625f, 0.0f, 0.5f, 0.625f, 0.0f, 0.375f, 0.5f, 0.0f, 0.5f, 0.5f, 0.0f, 0.25f, 1.0f, 0.0f, 0.25f, 0.875f, 0.0f, 0.25f, 0.75f, 0.0f, 0.25f, 0.625f, 0.0f, 0.25f, 0.5f, 0.0f, 0.125f, 1.0f, 0.0f, 0.125f, 0.875f, 0.0f, 0.125f, 0.75f, 0.0f, 0.125f, 0.625f, 0.0f, 0.125f, 0.5f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.875f, 0.0f, 0.0f, 0.75f, 0.0f, 0.0f, 0.625f, 0.0f, 0.0f, 0.5f, 0.0f, 1.0f, 0.5f, 0.0f, 0.875f, 0.5f, 0.0f, 0.875f, 0.375f, 0.0f, 1.0f, 0.375f, 0.0f, 0.875f, 0.25f, 0.0f, 1.0f, 0.25f, 0.0f, 0.875f, 0.125f, 0.0f, 1.0f, 0.125f, 0.0f, 0.875f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.75f, 0.5f, 0.0f, 0.75f, 0.375f, 0.0f, 0.75f, 0.25f, 0.0f, 0.75f, 0.125f, 0.0f, 0.75f, 0.0f, 0.0f, 0.625f, 0.5f, 0.0f, 0.625f, 0.375f, 0.0f, 0.625f, 0.25f, 0.0f, 0.625f, 0.125f, 0.0f, 0.625f, 0.0f, 0.0f, 0.5f, 0.5f, 0.0f, 0.5f, 0.375f, 0.0f, 0.5f, 0.25f, 0.0f, 0.5f, 0.125f, 0.0f, 0.5f, 0.0f, 0.0f, 0.5f, 0.5f, 0.0f, 0.375f, 0.5f, 0.0f, 0.375f, 0.375f, 0.0f, 0.5f, 0.375f, 0.0f, 0.375f, 0.25f, 0.0f, 0.5f, 0.25f, 0.0f, 0.375f, 0.125f, 0.0f, 0.5f, 0.125f, 0.0f, 0.375f, 0.0f, 0.0f, 0.5f, 0.0f, 0.0f, 0.25f, 0.5f, 0.0f, 0.25f, 0.375f, 0.0f, 0.25f, 0.25f, 0.0f, 0.25f, 0.125f, 0.0f, 0.25f, 0.0f, 0.0f, 0.125f, 0.5f, 0.0f, 0.125f, 0.375f, 0.0f, 0.125f, 0.25f, 0.0f, 0.125f, 0.125f, 0.0f, 0.125f, 0.0f, 0.0f, 0.0f, 0.5f, 0.0f, 0.0f, 0.375f, 0.0f, 0.0f, 0.25f, 0.0f, 0.0f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.5f, 0.0f, 0.0f, 0.625f, 0.0f, 0.0f, 0.625f, 0.22499999403953552f, 0.0f, 0.5f, 0.22499999403953552f, 0.0f, 0.625f, 0.44999998807907104f, 0.0f, 0.5f, 0.44999998807907104f, 0.0f, 0.625f, 0.675000011920929f, 0.0f, 0.5f, 0.675000011920929f, 0.0f, 0.625f, 0.8999999761581421f, 0.0f, 0.5f, 0.8999999761581421f, 0.0f, 0.75f, 0.0f, 0.0f, 0.75f, 0.22499999403953552f, 0.0f, 0.75f, 0.44999998807907104f, 0.0f, 0.75f, 0.675000011920929f, 0.0f, 0.75f, 0.8999999761581421f, 0.0f, 0.875f, 0.0f, 0.0f, 0.875f, 0.22499999403953552f, 0.0f, 0.875f, 0.44999998807907104f, 0.0f, 0.875f, 0.675000011920929f, 0.0f, 0.875f, 0.8999999761581421f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.22499999403953552f, 0.0f, 1.0f, 0.44999998807907104f, 0.0f, 1.0f, 0.675000011920929f, 0.0f, 1.0f, 0.8999999761581421f, 0.0f, 0.0f, 0.0f, 0.0f, 0.125f, 0.0f, 0.0f, 0.125f, 0.22499999403953552f, 0.0f, 0.0f, 0.22499999403953552f, 0.0f, 0.125f, 0.44999998807907104f, 0.0f, 0.0f, 0.44999998807907104f, 0.0f, 0.125f, 0.675000011920929f, 0.0f, 0.0f, 0.675000011920929f, 0.0f, 0.125f, 0.8999999761581421f, 0.0f, 0.0f, 0.8999999761581421f, 0.0f, 0.25f, 0.0f, 0.0f, 0.25f, 0.22499999403953552f, 0.0f, 0.25f, 0.44999998807907104f, 0.0f, 0.25f, 0.675000011920929f, 0.0f, 0.25f, 0.8999999761581421f, 0.0f, 0.375f, 0.0f, 0.0f, 0.375f, 0.22499999403953552f, 0.0f, 0.375f, 0.44999998807907104f, 0.0f, 0.375f, 0.675000011920929f, 0.0f, 0.375f, 0.8999999761581421f, 0.0f, 0.5f, 0.0f, 0.0f, 0.5f, 0.22499999403953552f, 0.0f, 0.5f, 0.44999998807907104f, 0.0f, 0.5f, 0.675000011920929f, 0.0f, 0.5f, 0.8999999761581421f, 0.0f, 0.5f, 0.8999999761581421f, 0.0f, 0.625f, 0.8999999761581421f, 0.0f, 0.625f, 0.925000011920929f, 0.0f, 0.5f, 0.925000011920929f, 0.0f, 0.625f, 0.949999988079071f, 0.0f, 0.5f, 0.949999988079071f, 0.0f, 0.625f, 0.9750000238418579f, 0.0f, 0.5f, 0.9750000238418579f, 0.0f, 0.625f, 1.0f, 0.0f, 0.5f, 1.0f, 0.0f, 0.75f, 0.8999999761581421f, 0.0f, 0.75f, 0.925000011920929f, 0.0f, 0.75f, 0.949999988079071f, 0.0f, 0.75f, 0.9750000238418579f, 0.0f, 0.75f, 1.0f, 0.0f, 0.875f, 0.8999999761581421f, 0.0f, 0.875f, 0.925000011920929f, 0.0f, 0.875f, 0.949999988079071f, 0.0f, 0.875f, 0.9750000238418579f, 0.0f, 0.875f, 1.0f, 0.0f, 1.0f, 0.8999999761581421f, 0.0f, 1.0f, 0.925000011920929f, 0.0f, 1.0f, 0.949999988079071f, 0.0f, 1.0f, 0.9750000238418579f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 0.8999999761581421f, 0.0f, 0.125f, 0.8999999761581421f, 0.0f, 0.125f, 0.925000011920929f, 0.0f, 0.0f, 0.925000011920929f, 0.0f, 0.125f, 0.949999988079071f, 0.0f, 0.0f, 0.949999988079071f, 0.0f, 0.125f, 0.9750000238418579f, 0.0f, 0.0f, 0.9750000238418579f, 0.0f, 0.125f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.25f, 0.8999999761581421f, 0.0f, 0.25f, 0.925000011920929f, 0.0f, 0.25f, 0.949999988079071f, 0.0f, 0.25f, 0.9750000238418579f, 0.0f, 0.25f, 1.0f, 0.0f, 0.375f, 0.8999999761581421f, 0.0f, 0.375f, 0.925000011920929f, 0.0f, 0.375f, 0.949999988079071f, 0.0f, 0.375f, 0.9750000238418579f, 0.0f, 0.375f, 1.0f, 0.0f, 0.5f, 0.8999999761581421f, 0.0f, 0.5f, 0.925000011920929f, 0.0f, 0.5f, 0.949999988079071f, 0.0f, 0.5f, 0.9750000238418579f, 0.0f, 0.5f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.875f, 1.0f, 0.0f, 0.875f, 0.75f, 0.0f, 1.0f, 0.75f, 0.0f, 0.875f, 0.5f, 0.0f, 1.0f, 0.5f, 0.0f, 0.875f, 0.25f, 0.0f, 1.0f, 0.25f, 0.0f, 0.875f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.75f, 1.0f, 0.0f, 0.75f, 0.75f, 0.0f, 0.75f, 0.5f, 0.0f, 0.75f, 0.25f, 0.0f, 0.75f, 0.0f, 0.0f, 0.625f, 1.0f, 0.0f, 0.625f, 0.75f, 0.0f, 0.625f, 0.5f, 0.0f, 0.625f, 0.25f, 0.0f, 0.625f, 0.0f, 0.0f, 0.5f, 1.0f, 0.0f, 0.5f, 0.75f, 0.0f, 0.5f, 0.5f, 0.0f, 0.5f, 0.25f, 0.0f, 0.5f, 0.0f, 0.0f, 0.5f, 1.0f, 0.0f, 0.375f, 1.0f, 0.0f, 0.375f, 0.75f, 0.0f, 0.5f, 0.75f, 0.0f, 0.375f, 0.5f, 0.0f, 0.5f, 0.5f, 0.0f, 0.375f, 0.25f, 0.0f, 0.5f, 0.25f, 0.0f, 0.375f, 0.0f, 0.0f, 0.5f, 0.0f, 0.0f, 0.25f, 1.0f, 0.0f, 0.25f, 0.75f, 0.0f, 0.25f, 0.5f, 0.0f, 0.25f, 0.25f, 0.0f, 0.25f, 0.0f, 0.0f, 0.125f, 1.0f, 0.0f, 0.125f, 0.75f, 0.0f, 0.125f, 0.5f, 0.0f, 0.125f, 0.25f, 0.0f, 0.125f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.75f, 0.0f, 0.0f, 0.5f, 0.0f, 0.0f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.875f, 1.0f, 0.0f, 0.875f, 0.75f, 0.0f, 1.0f, 0.75f, 0.0f, 0.875f, 0.5f, 0.0f, 1.0f, 0.5f, 0.0f, 0.875f, 0.25f, 0.0f, 1.0f, 0.25f, 0.0f, 0.875f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.75f, 1.0f, 0.0f, 0.75f, 0.75f, 0.0f, 0.75f, 0.5f, 0.0f, 0.75f, 0.25f, 0.0f, 0.75f, 0.0f, 0.0f, 0.625f, 1.0f, 0.0f, 0.625f, 0.75f, 0.0f, 0.625f, 0.5f, 0.0f, 0.625f, 0.25f, 0.0f, 0.625f, 0.0f, 0.0f, 0.5f, 1.0f, 0.0f, 0.5f, 0.75f, 0.0f, 0.5f, 0.5f, 0.0f, 0.5f, 0.25f, 0.0f, 0.5f, 0.0f, 0.0f, 0.5f, 1.0f, 0.0f, 0.375f, 1.0f, 0.0f, 0.375f, 0.75f, 0.0f, 0.5f, 0.75f, 0.0f, 0.375f, 0.5f, 0.0f, 0.5f, 0.5f, 0.0f, 0.375f, 0.25f, 0.0f, 0.5f, 0.25f, 0.0f, 0.375f, 0.0f, 0.0f, 0.5f, 0.0f, 0.0f, 0.25f, 1.0f, 0.0f, 0.25f, 0.75f, 0.0f, 0.25f, 0.5f, 0.0f, 0.25f, 0.25f, 0.0f, 0.25f, 0.0f, 0.0f, 0.125f, 1.0f, 0.0f, 0.125f, 0.75f, 0.0f, 0.125f, 0.5f, 0.0f, 0.125f, 0.25f, 0.0f, 0.125f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.75f, 0.0f, 0.0f, 0.5f, 0.0f, 0.0f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.875f, 1.0f, 0.0f, 0.875f, 0.75f, 0.0f, 1.0f, 0.75f, 0.0f, 0.875f, 0.5f, 0.0f, 1.0f, 0.5f, 0.0f, 0.875f, 0.25f, 0.0f, 1.0f, 0.25f, 0.0f, 0.875f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.75f, 1.0f, 0.0f, 0.75f, 0.75f, 0.0f, 0.75f, 0.5f, 0.0f, 0.75f, 0.25f, 0.0f, 0.75f, 0.0f, 0.0f, 0.625f, 1.0f, 0.0f, 0.625f, 0.75f, 0.0f, 0.625f, 0.5f, 0.0f, 0.625f, 0.25f, 0.0f, 0.625f, 0.0f, 0.0f, 0.5f, 1.0f, 0.0f, 0.5f, 0.75f, 0.0f, 0.5f, 0.5f, 0.0f, 0.5f, 0.25f, 0.0f, 0.5f, 0.0f, 0.0f, 0.5f, 1.0f, 0.0f, 0.375f, 1.0f, 0.0f, 0.375f, 0.75f, 0.0f, 0.5f, 0.75f, 0.0f, 0.375f, 0.5f, 0.0f, 0.5f, 0.5f, 0.0f, 0.375f, 0.25f, 0.0f, 0.5f, 0.25f, 0.0f, 0.375f, 0.0f, 0.0f, 0.5f, 0.0f, 0.0f, 0.25f, 1.0f, 0.0f, 0.25f, 0.75f, 0.0f, 0.25f, 0.5f, 0.0f, 0.25f, 0.25f, 0.0f, 0.25f, 0.0f, 0.0f, 0.125f, 1.0f, 0.0f, 0.125f, 0.75f, 0.0f, 0.125f, 0.5f, 0.0f, 0.125f, 0.25f, 0.0f, 0.125f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.75f, 0.0f, 0.0f, 0.5f, 0.0f, 0.0f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.875f, 1.0f, 0.0f, 0.875f, 0.75f, 0.0f, 1.0f, 0.75f, 0.0f, 0.875f, 0.5f, 0.0f, 1.0f, 0.5f, 0.0f, 0.875f, 0.25f, 0.0f, 1.0f, 0.25f, 0.0f, 0.875f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.75f, 1.0f, 0.0f, 0.75f, 0.75f, 0.0f, 0.75f, 0.5f, 0.0f, 0.75f, 0.25f, 0.0f, 0.75f, 0.0f, 0.0f, 0.625f, 1.0f, 0.0f, 0.625f, 0.75f, 0.0f, 0.625f, 0.5f, 0.0f, 0.625f, 0.25f, 0.0f, 0.625f, 0.0f, 0.0f, 0.5f, 1.0f, 0.0f, 0.5f, 0.75f, 0.0f, 0.5f, 0.5f, 0.0f, 0.5f, 0.25f, 0.0f, 0.5f, 0.0f, 0.0f, 0.5f, 1.0f, 0.0f, 0.375f, 1.0f, 0.0f, 0.375f, 0.75f, 0.0f, 0.5f, 0.75f, 0.0f, 0.375f, 0.5f, 0.0f, 0.5f, 0.5f, 0.0f, 0.375f, 0.25f, 0.0f, 0.5f, 0.25f, 0.0f, 0.375f, 0.0f, 0.0f, 0.5f, 0.0f, 0.0f, 0.25f, 1.0f, 0.0f, 0.25f, 0.75f, 0.0f, 0.25f, 0.5f, 0.0f, 0.25f, 0.25f, 0.0f, 0.25f, 0.0f, 0.0f, 0.125f, 1.0f, 0.0f, 0.125f, 0.75f, 0.0f, 0.125f, 0.5f, 0.0f, 0.125f, 0.25f, 0.0f, 0.125f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.75f, 0.0f, 0.0f, 0.5f, 0.0f, 0.0f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f };
 
   inline static const unsigned int indices[] = { 0, 1, 2, 2, 3, 0, 3, 2, 4, 4, 5, 3, 5, 4, 6, 6, 7, 5, 7, 6, 8, 8, 9, 7, 1, 10, 11, 11, 2, 1, 2, 11, 12, 12, 4, 2, 4, 12, 13, 13, 6, 4, 6, 13, 14, 14, 8, 6, 10, 15, 16, 16, 11, 10, 11, 16, 17, 17, 12, 11, 12, 17, 18, 18, 13, 12, 13, 18, 19, 19, 14, 13, 15, 20, 21, 21, 16, 15, 16, 21, 22, 22, 17, 16, 17, 22, 23, 23, 18, 17, 18, 23, 24, 24, 19, 18, 25, 26, 27, 27, 28, 25, 28, 27, 29, 29, 30, 28, 30, 29, 31, 31, 32, 30, 32, 31, 33, 33, 34, 32, 26, 35, 36, 36, 27, 26, 27, 36, 37, 37, 29, 27, 29, 37, 38, 38, 31, 29, 31, 38, 39, 39, 33, 31, 35, 40, 41, 41, 36, 35, 36, 41, 42, 42, 37, 36, 37, 42, 43, 43, 38, 37, 38, 43, 44, 44, 39, 38, 40, 45, 46, 46, 41, 40, 41, 46, 47, 47, 42, 41, 42, 47, 48, 48, 43, 42, 43, 48, 49, 49, 44, 43, 50, 51, 52, 52, 53, 50, 53, 52, 54, 54, 55, 53, 55, 54, 56, 56, 57, 55, 57, 56, 58, 58, 59, 57, 51, 60, 61, 61, 52, 51, 52, 61, 62, 62, 54, 52, 54, 62, 63, 63, 56, 54, 56, 63, 64, 64, 58, 56, 60, 65, 66, 66, 61, 60, 61, 66, 67, 67, 62, 61, 62, 67, 68, 68, 63, 62, 63, 68, 69, 69, 64, 63, 65, 70, 71, 71, 66, 65, 66, 71, 72, 72, 67, 66, 67, 72, 73, 73, 68, 67, 68, 73, 74, 74, 69, 68, 75, 76, 77, 77, 78, 75, 78, 77, 79, 79, 80, 78, 80, 79, 81, 81, 82, 80, 82, 81, 83, 83, 84, 82, 76, 85, 86, 86, 77, 76, 77, 86, 87, 87, 79, 77, 79, 87, 88, 88, 81, 79, 81, 88, 89, 89, 83, 81, 85, 90, 91, 91, 86, 85, 86, 91, 92, 92, 87, 86, 87, 92, 93, 93, 88, 87, 88, 93, 94, 94, 89, 88, 90, 95, 96, 96, 91, 90, 91, 96, 97, 97, 92, 91, 92, 97, 98, 98, 93, 92, 93, 98, 99, 99, 94, 93, 100, 101, 102, 102, 103, 100, 103, 102, 104, 104, 105, 103, 105, 104, 106, 106, 107, 105, 107, 106, 108, 108, 109, 107, 101, 110, 111, 111, 102, 101, 102, 111, 112, 112, 104, 102, 104, 112, 113, 113, 106, 104, 106, 113, 114, 114, 108, 106, 110, 115, 116, 116, 111, 110, 111, 116, 117, 117, 112, 111, 112, 117, 118, 118, 113, 112, 113, 118, 119, 119, 114, 113, 115, 120, 121, 121, 116, 115, 116, 121, 122, 122, 117, 116, 117, 122, 123, 123, 118, 117, 118, 123, 124, 124, 119, 118, 125, 126, 127, 127, 128, 125, 128, 127, 129, 129, 130, 128, 130, 129, 131, 131, 132, 130, 132, 131, 133, 133, 134, 132, 126, 135, 136, 136, 127, 126, 127, 136, 137, 137, 129, 127, 129, 137, 138, 138, 131, 129, 131, 138, 139, 139, 133, 131, 135, 140, 141, 141, 136, 135, 136, 141, 142, 142, 137, 136, 137, 142, 143, 143, 138, 137, 138, 143, 144, 144, 139, 138, 140, 145, 146, 146, 141, 140, 141, 146, 147, 147, 142, 141, 142, 147, 148, 148, 143, 142, 143, 148, 149, 149, 144, 143, 150, 151, 152, 152, 153, 150, 153, 152, 154, 154, 155, 153, 155, 154, 156, 156, 157, 155, 157, 156, 158, 158, 159, 157, 151, 160, 161, 161, 152, 151, 152, 161, 162, 162, 154, 152, 154, 162, 163, 163, 156, 154, 156, 163, 164, 164, 158, 156, 160, 165, 166, 166, 161, 160, 161, 166, 167, 167, 162, 161, 162, 167, 168, 168, 163, 162, 163, 168, 169, 169, 164, 163, 165, 170, 171, 171, 166, 165, 166, 171, 172, 172, 167, 166, 167, 172, 173, 173, 168, 167, 168, 173, 174, 174, 169, 168, 175, 176, 177, 177, 178, 175, 178, 177, 179, 179, 180, 178, 180, 179, 181, 181, 182, 180, 182, 181, 183, 183, 184, 182, 176, 185, 186, 186, 177, 176, 177, 186, 187, 187, 179, 177, 179, 187, 188, 188, 181, 179, 181, 188, 189, 189, 183, 181, 185, 190, 191, 191, 186, 185, 186, 191, 192, 192, 187, 186, 187, 192, 193, 193, 188, 187, 188, 193, 194, 194, 189, 188, 190, 195, 196, 196, 191, 190, 191, 196, 197, 197, 192, 191, 192, 197, 198, 198, 193, 192, 193, 198, 199, 199, 194, 193, 200, 201, 202, 202, 203, 200, 203, 202, 204, 204, 205, 203, 205, 204, 206, 206, 207, 205, 207, 206, 208, 208, 209, 207, 201, 210, 211, 211, 202, 201, 202, 211, 212, 212, 204, 202, 204, 212, 213, 213, 206, 204, 206, 213, 214, 214, 208, 206, 210, 215, 216, 216, 211, 210, 211, 216, 217, 217, 212, 211, 212, 217, 218, 218, 213, 212, 213, 218, 219, 219, 214, 213, 215, 220, 221, 221, 216, 215, 216, 221, 222, 222, 217, 216, 217, 222, 223, 223, 218, 217, 218, 223, 224, 224, 219, 218, 225, 226, 227, 227, 228, 225, 228, 227, 229, 229, 230, 228, 230, 229, 231, 231, 232, 230, 232, 231, 233, 233, 234, 232, 226, 235, 236, 236, 227, 226, 227, 236, 237, 237, 229, 227, 229, 237, 238, 238, 231, 229, 231, 238, 239, 239, 233, 231, 235, 240, 241, 241, 236, 235, 236, 241, 242, 242, 237, 236, 237, 242, 243, 243, 238, 237, 238, 243, 244, 244, 239, 238, 240, 245, 246, 246, 241, 240, 241, 246, 247, 247, 242, 241, 242, 247, 248, 248, 243, 242, 243, 248, 249, 249, 244, 243, 250, 251, 252, 252, 253, 250, 253, 252, 254, 254, 255, 253, 255, 254, 256, 256, 257, 255, 257, 256, 258, 258, 259, 257, 251, 260, 261, 261, 252, 251, 252, 261, 262, 262, 254, 252, 254, 262, 263, 263, 256, 254, 256, 263, 264, 264, 258, 256, 260, 265, 266, 266, 261, 260, 261, 266, 267, 267, 262, 261, 262, 267, 268, 268, 263, 262, 263, 268, 269, 269, 264, 263, 265, 270, 271, 271, 266, 265, 266, 271, 272, 272, 267, 266, 267, 272, 273, 273, 268, 267, 268, 273, 274, 274, 269, 268, 275, 276, 277, 277, 278, 275, 278, 277, 279, 279, 280, 278, 280, 279, 281, 281, 282, 280, 282, 281, 283, 283, 284, 282, 276, 285, 286, 286, 277, 276, 277, 286, 287, 287, 279, 277, 279, 287, 288, 288, 281, 279, 281, 288, 289, 289, 283, 281, 285, 290, 291, 291, 286, 285, 286, 291, 292, 292, 287, 286, 287, 292, 293, 293, 288, 287, 288, 293, 294, 294, 289, 288, 290, 295, 296, 296, 291, 290, 291, 296, 297, 297, 292, 291, 292, 297, 298, 298, 293, 292, 293, 298, 299, 299, 294, 293, 300, 301, 302, 302, 303, 300, 303, 302, 304, 304, 305, 303, 305, 304, 306, 306, 307, 305, 307, 306, 308, 308, 309, 307, 301, 310, 311, 311, 302, 301, 302, 311, 312, 312, 304, 302, 304, 312, 313, 313, 306, 304, 306, 313, 314, 314, 308, 306, 310, 315, 316, 316, 311, 310, 311, 316, 317, 317, 312, 311, 312, 317, 318, 318, 313, 312, 313, 318, 319, 319, 314, 313, 315, 320, 321, 321, 316, 315, 316, 321, 322, 322, 317, 316, 317, 322, 323, 323, 318, 317, 318, 323, 324, 324, 319, 318, 325, 326, 327, 327, 328, 325, 328, 327, 329, 329, 330, 328, 330, 329, 331, 331, 332, 330, 332, 331, 333, 333, 334, 332, 326, 335, 336, 336, 327, 326, 327, 336, 337, 337, 329, 327, 329, 337, 338, 338, 331, 329, 331, 338, 339, 339, 333, 331, 335, 340, 341, 341, 336, 335, 336, 341, 342, 342, 337, 336, 337, 342, 343, 343, 338, 337, 338, 343, 344, 344, 339, 338, 340, 345, 346, 346, 341, 340, 341, 346, 347, 347, 342, 341, 342, 347, 348, 348, 343, 342, 343, 348, 349, 349, 344, 343, 350, 351, 352, 352, 353, 350, 353, 352, 354, 354, 355, 353, 355, 354, 356, 356, 357, 355, 357, 356, 358, 358, 359, 357, 351, 360, 361, 361, 352, 351, 352, 361, 362, 362, 354, 352, 354, 362, 363, 363, 356, 354, 356, 363, 364, 364, 358, 356, 360, 365, 366, 366, 361, 360, 361, 366, 367, 367, 362, 361, 362, 367, 368, 368, 363, 362, 363, 368, 369, 369, 364, 363, 365, 370, 371, 371, 366, 365, 366, 371, 372, 372, 367, 366, 367, 372, 373, 373, 368, 367, 368, 373, 374, 374, 369, 368, 375, 376, 377, 377, 378, 375, 378, 377, 379, 379, 380, 378, 380, 379, 381, 381, 382, 380, 382, 381, 383, 383, 384, 382, 376, 385, 386, 386, 377, 376, 377, 386, 387, 387, 379, 377, 379, 387, 388, 388, 381, 379, 381, 388, 389, 389, 383, 381, 385, 390, 391, 391, 386, 385, 386, 391, 392, 392, 387, 386, 387, 392, 393, 393, 388, 387, 388, 393, 394, 394, 389, 388, 390, 395, 396, 396, 391, 390, 391, 396, 397, 397, 392, 391, 392, 397, 398, 398, 393, 392, 393, 398, 399, 399, 394, 393, 400, 401, 402, 402, 403, 400, 403, 402, 404, 404, 405, 403, 405, 404, 406, 406, 407, 405, 407, 406, 408, 408, 409, 407, 401, 410, 411, 411, 402, 401, 402, 411, 412, 412, 404, 402, 404, 412, 413, 413, 406, 404, 406, 413, 414, 414, 408, 406, 410, 415, 416, 416, 411, 410, 411, 416, 417, 417, 412, 411, 412, 417, 418, 418, 413, 412, 413, 418, 419, 419, 414, 413, 415, 420, 421, 421, 416, 415, 416, 421, 422, 422, 417, 416, 417, 422, 423, 423, 418, 417, 418, 423, 424, 424, 419, 418, 425, 426, 427, 427, 428, 425, 428, 427, 429, 429, 430, 428, 430, 429, 431, 431, 432, 430, 432, 431, 433, 433, 434, 432, 426, 435, 436, 436, 427, 426, 427, 436, 437, 437, 429, 427, 429, 437, 438, 438, 431, 429, 431, 438, 439, 439, 433, 431, 435, 440, 441, 441, 436, 435, 436, 441, 442, 442, 437, 436, 437, 442, 443, 443, 438, 437, 438, 443, 444, 444, 439, 438, 440, 445, 446, 446, 441, 440, 441, 446, 447, 447, 442, 441, 442, 447, 448, 448, 443, 442, 443, 448, 449, 449, 444, 443, 450, 451, 452, 452, 453, 450, 453, 452, 454, 454, 455, 453, 455, 454, 456, 456, 457, 455, 457, 456, 458, 458, 459, 457, 451, 460, 461, 461, 452, 451, 452, 461, 462, 462, 454, 452, 454, 462, 463, 463, 456, 454, 456, 463, 464, 464, 458, 456, 460, 465, 466, 466, 461, 460, 461, 466, 467, 467, 462, 461, 462, 467, 468, 468, 463, 462, 463, 468, 469, 469, 464, 463, 465, 470, 471, 471, 466, 465, 466, 471, 472, 472, 467, 466, 467, 472, 473, 473, 468, 467, 468, 473, 474, 474, 469, 468, 475, 476, 477, 477, 478, 475, 478, 477, 479, 479, 480, 478, 480, 479, 481, 481, 482, 480, 482, 481, 483, 483, 484, 482, 476, 485, 486, 486, 477, 476, 477, 486, 487, 487, 479, 477, 479, 487, 488, 488, 481, 479, 481, 488, 489, 489, 483, 481, 485, 490, 491, 491, 486, 485, 486, 491, 492, 492, 487, 486, 487, 492, 493, 493, 488, 487, 488, 493, 494, 494, 489, 488, 490, 495, 496, 496, 491, 490, 491, 496, 497, 497, 492, 491, 492, 497, 498, 498, 493, 492, 493, 498, 499, 499, 494, 493, 500, 501, 502, 502, 503, 500, 503, 502, 504, 504, 505, 503, 505, 504, 506, 506, 507, 505, 507, 506, 508, 508, 509, 507, 501, 510, 511, 511, 502, 501, 502, 511, 512, 512, 504, 502, 504, 512, 513, 513, 506, 504, 506, 513, 514, 514, 508, 506, 510, 515, 516, 516, 511, 510, 511, 516, 517, 517, 512, 511, 512, 517, 518, 518, 513, 512, 513, 518, 519, 519, 514, 513, 515, 520, 521, 521, 516, 515, 516, 521, 522, 522, 517, 516, 517, 522, 523, 523, 518, 517, 518, 523, 524, 524, 519, 518, 525, 526, 527, 527, 528, 525, 528, 527, 529, 529, 530, 528, 530, 529, 531, 531, 532, 530, 532, 531, 533, 533, 534, 532, 526, 535, 536, 536, 527, 526, 527, 536, 537, 537, 529, 527, 529, 537, 538, 538, 531, 529, 531, 538, 539, 539, 533, 531, 535, 540, 541, 541, 536, 535, 536, 541, 542, 542, 537, 536, 537, 542, 543, 543, 538, 537, 538, 543, 544, 544, 539, 538, 540, 545, 546, 546, 541, 540, 541, 546, 547, 547, 542, 541, 542, 547, 548, 548, 543, 542, 543, 548, 549, 549, 544, 543, 550, 551, 552, 552, 553, 550, 553, 552, 554, 554, 555, 553, 555, 554, 556, 556, 557, 555, 557, 556, 558, 558, 559, 557, 551, 560, 561, 561, 552, 551, 552, 561, 562, 562, 554, 552, 554, 562, 563, 563, 556, 554, 556, 563, 564, 564, 558, 556, 560, 565, 566, 566, 561, 560, 561, 566, 567, 567, 562, 561, 562, 567, 568, 568, 563, 562, 563, 568, 569, 569, 564, 563, 565, 570, 571, 571, 566, 565, 566, 571, 572, 572, 567, 566, 567, 572, 573, 573, 568, 567, 568, 573, 574, 574, 569, 568, 575, 576, 577, 577, 578, 575, 578, 577, 579, 579, 580, 578, 580, 579, 581, 581, 582, 580, 582, 581, 583, 583, 584, 582, 576, 585, 586, 586, 577, 576, 577, 586, 587, 587, 579, 577, 579, 587, 588, 588, 581, 579, 581, 588, 589, 589, 583, 581, 585, 590, 591, 591, 586, 585, 586, 591, 592, 592, 587, 586, 587, 592, 593, 593, 588, 587, 588, 593, 594, 594, 589, 588, 590, 595, 596, 596, 591, 590, 591, 596, 597, 597, 592, 591, 592, 597, 598, 598, 593, 592, 593, 598, 599, 599, 594, 593, 600, 601, 602, 602, 603, 600, 603, 602, 604, 604, 605, 603, 605, 604, 606, 606, 607, 605, 607, 606, 608, 608, 609, 607, 601, 610, 611, 611, 602, 601, 602, 611, 612, 612, 604, 602, 604, 612, 613, 613, 606, 604, 606, 613, 614, 614, 608, 606, 610, 615, 616, 616, 611, 610, 611, 616, 617, 617, 612, 611, 612, 617, 618, 618, 613, 612, 613, 618, 619, 619, 614, 613, 615, 620, 621, 621, 616, 615, 616, 621, 622, 622, 617, 616, 617, 622, 623, 623, 618, 617, 618, 623, 624, 624, 619, 618, 625, 626, 627, 627, 628, 625, 628, 627, 629, 629, 630, 628, 630, 629, 631, 631, 632, 630, 632, 631, 633, 633, 634, 632, 626, 635, 636, 636, 627, 626, 627, 636, 637, 637, 629, 627, 629, 637, 638, 638, 631, 629, 631, 638, 639, 639, 633, 631, 635, 640, 641, 641, 636, 635, 636, 641, 642, 642, 637, 636, 637, 642, 643, 643, 638, 637, 638, 643, 644, 644, 639, 638, 640, 645, 646, 646, 641, 640, 641, 646, 647, 647, 642, 641, 642, 647, 648, 648, 643, 642, 643, 648, 649, 649, 644, 643, 650, 651, 652, 652, 653, 650, 653, 652, 654, 654, 655, 653, 655, 654, 656, 656, 657, 655, 657, 656, 658, 658, 659, 657, 651, 660, 661, 661, 652, 651, 652, 661, 662, 662, 654, 652, 654, 662, 663, 663, 656, 654, 656, 663, 664, 664, 658, 656, 660, 665, 666, 666, 661, 660, 661, 666, 667, 667, 662, 661, 662, 667, 668, 668, 663, 662, 663, 668, 669, 669, 664, 663, 665, 670, 671, 671, 666, 665, 666, 671, 672, 672, 667, 666, 667, 672, 673, 673, 668, 667, 668, 673, 674, 674, 669, 668, 675, 676, 677, 677, 678, 675, 678, 677, 679, 679, 680, 678, 680, 679, 681, 681, 682, 680, 682, 681, 683, 683, 684, 682, 676, 685, 686, 686, 677, 676, 677, 686, 687, 687, 679, 677, 679, 687, 688, 688, 681, 679, 681, 688, 689, 689, 683, 681, 685, 690, 691, 691, 686, 685, 686, 691, 692, 692, 687, 686, 687, 692, 693, 693, 688, 687, 688, 693, 694, 694, 689, 688, 690, 695, 696, 696, 691, 690, 691, 696, 697, 697, 692, 691, 692, 697, 698, 698, 693, 692, 693, 698, 699, 699, 694, 693, 700, 701, 702, 702, 703, 700, 703, 702, 704, 704, 705, 703, 705, 704, 706, 706, 707, 705, 707, 706, 708, 708, 709, 707, 701, 710, 711, 711, 702, 701, 702, 711, 712, 712, 704, 702, 704, 712, 713, 713, 706, 704, 706, 713, 714, 714, 708, 706, 710, 715, 716, 716, 711, 710, 711, 716, 717, 717, 712, 711, 712, 717, 718, 718, 713, 712, 713, 718, 719, 719, 714, 713, 715, 720, 721, 721, 716, 715, 716, 721, 722, 722, 717, 716, 717, 722, 723, 723, 718, 717, 718, 723, 724, 724, 719, 718, 725, 726, 727, 727, 728, 725, 728, 727, 729, 729, 730, 728, 730, 729, 731, 731, 732, 730, 732, 731, 733, 733, 734, 732, 726, 735, 736, 736, 727, 726, 727, 736, 737, 737, 729, 727, 729, 737, 738, 738, 731, 729, 731, 738, 739, 739, 733, 731, 735, 740, 741, 741, 736, 735, 736, 741, 742, 742, 737, 736, 737, 742, 743, 743, 738, 737, 738, 743, 744, 744, 739, 738, 740, 745, 746, 746, 741, 740, 741, 746, 747, 747, 742, 741, 742, 747, 748, 748, 743, 742, 743, 748, 749, 749, 744, 743, 750, 751, 752, 752, 753, 750, 753, 752, 754, 754, 755, 753, 755, 754, 756, 756, 757, 755, 757, 756, 758, 758, 759, 757, 751, 760, 761, 761, 752, 751, 752, 761, 762, 762, 754, 752, 754, 762, 763, 763, 756, 754, 756, 763, 764, 764, 758, 756, 760, 765, 766, 766, 761, 760, 761, 766, 767, 767, 762, 761, 762, 767, 768, 768, 763, 762, 763, 768, 769, 769, 764, 763, 765, 770, 771, 771, 766, 765, 766, 771, 772, 772, 767, 766, 767, 772, 773, 773, 768, 767, 768, 773, 774, 774, 769, 768, 775, 776, 777, 777, 778, 775, 778, 777, 779, 779, 780, 778, 780, 779, 781, 781, 782, 780, 782, 781, 783, 783, 784, 782, 776, 785, 786, 786, 777, 776, 777, 786, 787, 787, 779, 777, 779, 787, 788, 788, 781, 779, 781, 788, 789, 789, 783, 781, 785, 790, 791, 791, 786, 785, 786, 791, 792, 792, 787, 786, 787, 792, 793, 793, 788, 787, 788, 793, 794, 794, 789, 788, 790, 795, 796, 796, 791, 790, 791, 796, 797, 797, 792, 791, 792, 797, 798, 798, 793, 792, 793, 798, 799, 799, 794, 793 };
@@ -1,6 +1,8 @@
 #include <ImageLoader.h>
 #include <GLApp.h>
 #include <Vec2.h>
+#include <MeshProcessing.h>
+#include <MeshOptimizer.h>
 #include "Teapot.h"
 #include "UnitPlane.h"
 #include "UnitCube.h"
@@ -40,12 +42,10 @@ public:
   GLBuffer planeTexCoordBuffer{GL_ARRAY_BUFFER};
 
   GLArray teapotArray;
-  GLBuffer teapotPosBuffer{GL_ARRAY_BUFFER};
-  GLBuffer teapotNormalBuffer{GL_ARRAY_BUFFER};
-  GLBuffer teapotTangBuffer{GL_ARRAY_BUFFER};
-  GLBuffer teapotBinBuffer{GL_ARRAY_BUFFER};
-  GLBuffer teapotTexCoordBuffer{GL_ARRAY_BUFFER};
+  GLBuffer teapotBuffer{GL_ARRAY_BUFFER};
   GLBuffer teapotIndexBuffer{GL_ELEMENT_ARRAY_BUFFER};
+  GLsizei teapotIndexCount{0};
+  GLenum teapotIndexType{GL_UNSIGNED_INT};
 
   bool leftMouseDown{false};
   bool rightMouseDown{false};
@@ -70,9 +70,9 @@ public:
   virtual void init() override {
     setupTextures();
     setupGeometry();
-    GL(glDisable(GL_CULL_FACE)); // the teapot is not watertight
-    GL(glEnable(GL_DEPTH_TEST));
-    GL(glDepthFunc(GL_LESS));
+    GLState::current().disable(GL_CULL_FACE); // the teapot is not watertight
+    GLState::current().enable(GL_DEPTH_TEST);
+    GLState::current().depthFunc(GL_LESS);
     GL(glClearColor(0.0f, 0.0f, 0.0f, 1.0f));
     setAnimation(false);
     resetAnimation();
@@ -117,7 +117,7 @@ public:
     Mat4 modelMatrix = Mat4::scaling(100, 100, 100);
     Mat4 modelView = viewMatrix * modelMatrix;
     Mat4 modelViewProjection = projectionMatrix * modelView;
-    Mat4 modelViewIT = Mat4::transpose(Mat4::inverse(modelView));
+    Mat3 modelViewIT = Mat4::normalMatrix(modelView);
 
     pPhongBumpTex.setUniform("MVP", modelViewProjection);
     pPhongBumpTex.setUniform("MV", modelView);
@@ -132,7 +132,7 @@ public:
     modelMatrix = {};
     modelView = viewMatrix * modelMatrix;
     modelViewProjection = projectionMatrix * modelView;
-    modelViewIT = Mat4::transpose(Mat4::inverse(modelView));
+    modelViewIT = Mat4::normalMatrix(modelView);
 
     pPhongBump.enable();
     pPhongBump.setUniform("MVP", modelViewProjection);
@@ -142,13 +142,13 @@ public:
     pPhongBump.setTexture("tn", udeNormals,0);
 
     teapotArray.bind();
-    GL(glDrawElements(GL_TRIANGLES, sizeof(Teapot::indices) / sizeof(Teapot::indices[0]), GL_UNSIGNED_INT, (void*)0));
+    GL(glDrawElements(GL_TRIANGLES, teapotIndexCount, teapotIndexType, (void*)0));
   }
 
   virtual void resize(int width, int height) override {
     float ratio = static_cast<float>(width) / static_cast<float>(height);
     projectionMatrix = Mat4::perspective(60.0f, ratio, 0.1f, 10000.0f);
-    GL(glViewport(0, 0, width, height));
+    GLState::current().viewport(0, 0, width, height);
   }
 
   void setupGeometry() {
@@ -180,27 +180,34 @@ public:
                               2, GL_STATIC_DRAW);
     planeArray.connectVertexAttrib(planeTexCoordBuffer, pPhongBumpTex, "vertexTexCoords", 2);
 
-    teapotPosBuffer.setData(Teapot::vertices,
-                           sizeof(Teapot::vertices)/sizeof(Teapot::vertices[0]),
-                           3, GL_STATIC_DRAW);
-    teapotArray.connectVertexAttrib(teapotPosBuffer, pPhongBump, "vertexPosition", 3);
-    teapotNormalBuffer.setData(Teapot::normals,
-                              sizeof(Teapot::normals)/sizeof(Teapot::normals[0]),
-                              3, GL_STATIC_DRAW);
-    teapotArray.connectVertexAttrib(teapotNormalBuffer, pPhongBump, "vertexNormal", 3);
-    teapotTangBuffer.setData(Teapot::tangents,
-                            sizeof(Teapot::tangents)/sizeof(Teapot::tangents[0]),
-                            3, GL_STATIC_DRAW);
-    teapotArray.connectVertexAttrib(teapotTangBuffer, pPhongBump, "vertexTangent", 3);
-    teapotBinBuffer.setData(Teapot::binormals,
-                           sizeof(Teapot::binormals)/sizeof(Teapot::binormals[0]),
-                           3, GL_STATIC_DRAW);
-    teapotArray.connectVertexAttrib(teapotBinBuffer, pPhongBump, "vertexBinormal", 3);
-    teapotTexCoordBuffer.setData(Teapot::texCoords,
-                                sizeof(Teapot::texCoords)/sizeof(Teapot::texCoords[0]),
-                                3, GL_STATIC_DRAW);
-    teapotArray.connectVertexAttrib(teapotTexCoordBuffer, pPhongBump, "vertexTexCoords", 3);
-    teapotIndexBuffer.setData(Teapot::indices, sizeof(Teapot::indices)/sizeof(Teapot::indices[0]));
+    const std::vector<MeshProcessing::Triangle> teapotTriangles =
+      MeshProcessing::toTriangles(Teapot::indices, sizeof(Teapot::indices)/sizeof(Teapot::indices[0]));
+    std::vector<Vec3> teapotTangents, teapotBinormals;
+    MeshProcessing::tangentFrames(
+      MeshProcessing::toVec3(Teapot::vertices, sizeof(Teapot::vertices)/sizeof(Teapot::vertices[0])),
+      MeshProcessing::toVec3(Teapot::normals, sizeof(Teapot::normals)/sizeof(Teapot::normals[0])),
+      MeshProcessing::toVec2(Teapot::texCoords, sizeof(Teapot::texCoords)/sizeof(Teapot::texCoords[0]), 3),
+      teapotTriangles, teapotTangents, teapotBinormals);
+    const std::vector<float> tangents = MeshProcessing::flatten(teapotTangents);
+    const std::vector<float> binormals = MeshProcessing::flatten(teapotBinormals);
+
+    // one interleaved, cache optimized vertex buffer and 16 bit indices
+    MeshOptimizer::Mesh teapot = MeshOptimizer::interleave({
+        {Teapot::vertices, 3}, {Teapot::normals, 3}, {tangents.data(), 3},
+        {binormals.data(), 3}, {Teapot::texCoords, 2, 3}
+      }, teapotTangents.size(), teapotTriangles);
+    MeshOptimizer::optimize(teapot);
+
+    teapotBuffer.setData(teapot.vertices, teapot.vertexSize(), GL_STATIC_DRAW);
+    teapotArray.connectVertexAttrib(teapotBuffer, pPhongBump, "vertexPosition", 3, teapot.attributeOffset(0));
+    teapotArray.connectVertexAttrib(teapotBuffer, pPhongBump, "vertexNormal", 3, teapot.attributeOffset(1));
+    teapotArray.connectVertexAttrib(teapotBuffer, pPhongBump, "vertexTangent", 3, teapot.attributeOffset(2));
+    teapotArray.connectVertexAttrib(teapotBuffer, pPhongBump, "vertexBinormal", 3, teapot.attributeOffset(3));
+    teapotArray.connectVertexAttrib(teapotBuffer, pPhongBump, "vertexTexCoords", 2, teapot.attributeOffset(4));
+    const MeshOptimizer::IndexData teapotIndices = MeshOptimizer::narrowIndices(teapot);
+    teapotIndices.upload(teapotIndexBuffer);
+    teapotIndexCount = GLsizei(teapotIndices.count());
+    teapotIndexType = teapotIndices.type;
   }
 
   virtual void keyboard(int key, int scancode, int action, int mods) override {
@@ -9,7 +9,7 @@ layout(location = 4) in vec2 vertexTexCoords;
 uniform mat4 MVP; // model-view-projection Matrix
 uniform mat4 MV; // model-view Matrix
 uniform mat4 M; // model matrix
-uniform mat4 MVit; // model-view inverse transpose Matrix
+uniform mat3 MVit; // model-view inverse transpose Matrix
 uniform mat4 worldToShadow;
 
 out vec3 posViewSpaceInterpolated;
@@ -23,9 +23,9 @@ void main() {
   gl_Position = MVP * vec4(vertexPosition, 1);
   posViewSpaceInterpolated    = vec3(MV * vec4(vertexPosition, 1));
 
-  normalViewSpaceInterpolated = normalize((MVit * vec4(vertexNormal, 0)).xyz);
-  tangentViewSpaceInterpolated = normalize((MVit * vec4(vertexTangent, 0)).xyz);;
-  binormViewSpaceInterpolated = normalize((MVit * vec4(vertexBinormal, 0)).xyz);;
+  normalViewSpaceInterpolated = normalize(MVit * vertexNormal);
+  tangentViewSpaceInterpolated = normalize(MVit * vertexTangent);;
+  binormViewSpaceInterpolated = normalize(MVit * vertexBinormal);;
   texCoordsInterpolated = vertexTexCoords;
   shadowPos = worldToShadow * M * vec4(vertexPosition, 1);
 }
@@ -1,4 +1,8 @@
+#include <algorithm>
+#include <cstring>
+
 #include "AbstractParticleSystem.h"
+#include "GLState.h"
 
 std::vector<uint8_t> spritePixel{
 	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,2,2,2,2,2,2,3,3,3,4,4,4,4,4,4,5,5,5,4,4,4,4,4,4,4,4,4,4,4,4,3,3,3,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
@@ -88,56 +92,234 @@ static std::string fsString{
 "out vec4 FragColor;\n"
 "void main() {\n"
 "    vec4 texValue = texture(sprite, gl_PointCoord).rgbr;\n"
-"    FragColor = vec4(color*texValue)*color.a;\n"
+"    FragColor = vec4(color.rgb*texValue.rgb, texValue.a)*color.a;\n"
+"}\n"};
+
+static std::string oitFsString{
+std::string{
+"#version 410\n"
+"uniform sampler2D sprite;\n"
+"in vec4 color;\n"
+"layout (location = 0) out vec4 accumulation;\n"
+"layout (location = 1) out vec4 revealage;\n"}
++ WeightedBlendedOIT::weightFunction +
+"void main() {\n"
+"    vec4 texValue = texture(sprite, gl_PointCoord).rgbr;\n"
+"    vec4 c = vec4(color.rgb*texValue.rgb, texValue.a)*color.a;\n"
+"    accumulation = c*oitWeight(c);\n"
+"    revealage = vec4(c.a);\n"
 "}\n"};
 
 AbstractParticleSystem::AbstractParticleSystem(float pointSize, float refDepth) :
 	pointSize(pointSize),
     refDepth(refDepth),
+    blendMode(ParticleBlendMode::ADDITIVE),
 	prog{GLProgram::createFromString(vsString, fsString)},
 	mvpLocation{prog.getUniformLocation("MVP")},
     ppLocation{prog.getUniformLocation("pointParam")},
 	texLocation{prog.getUniformLocation("sprite")},
 	sprite{GL_LINEAR, GL_LINEAR},
+    oitProg{GLProgram::createFromString(vsString, oitFsString)},
 	particleArray{},
-	vbPosColor{GL_ARRAY_BUFFER}	
+	vbPosColor{GL_ARRAY_BUFFER, size_t(1) << 22},
+    vbGeneration{0},
+    sortAxis{0.0f,0.0f,0.0f},
+    sortCount{0}
 {
 	// setup texture
 	sprite.setData(spritePixel, 64, 64 , 3);
-		
-	std::vector<float> empty;
-	vbPosColor.setData(empty,7,GL_DYNAMIC_DRAW);
-	
-	// setup geometry
-	particleArray.bind();
-	particleArray.connectVertexAttrib(vbPosColor, prog, "vPos", 3);
-	particleArray.connectVertexAttrib(vbPosColor, prog, "vColor", 4, 3);
+}
+
+void AbstractParticleSystem::writeData(float* target) const {
+    const std::vector<float> data = getData();
+    std::copy(data.begin(), data.end(), target);
+}
+
+void AbstractParticleSystem::beginRender(const Mat4& v, const Mat4& p,
+                                         ParticleBlendMode mode) {
+    if (mode == ParticleBlendMode::WEIGHTED_OIT) {
+        if (!oit) oit = std::make_unique<WeightedBlendedOIT>();
+        oit->begin();
+        oitProg.enable();
+        oitProg.setUniform("MVP", p*v);
+        oitProg.setUniform("pointParam", Vec2(pointSize,refDepth));
+        oitProg.setTexture("sprite", sprite, 0);
+    } else {
+        prog.enable();
+        prog.setUniform(mvpLocation, p*v);
+        prog.setUniform(ppLocation, Vec2(pointSize,refDepth));
+        prog.setTexture(texLocation, sprite, 0);
+
+        // colors are premultiplied
+        GLState& state = GLState::current();
+        state.enable(GL_BLEND);
+        if (mode == ParticleBlendMode::SORTED)
+            state.blendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+        else
+            state.blendFunc(GL_ONE, GL_ONE);
+        state.blendEquation(GL_FUNC_ADD);
+    }
+	GLState::current().disable(GL_CULL_FACE);
+	GLState::current().depthMask(false);
+			
+    GLState::current().enable(GL_PROGRAM_POINT_SIZE);
+}
+
+void AbstractParticleSystem::endRender(ParticleBlendMode mode) {
+    if (mode == ParticleBlendMode::WEIGHTED_OIT) oit->end();
+	GLState::current().disable(GL_BLEND);
+	GLState::current().enable(GL_CULL_FACE);
+	GLState::current().depthMask(true);
 }
 
 void AbstractParticleSystem::render(const Mat4& v, const Mat4& p) {
     if (getParticleCount() == 0) return;
-    
-	prog.enable();
-	prog.setUniform(mvpLocation, p*v);
-    prog.setUniform(ppLocation, Vec2(pointSize,refDepth));
-	prog.setTexture(texLocation, sprite, 0);		
-
-	glEnable(GL_BLEND);
-	glBlendFunc(GL_ONE, GL_ONE);
-	glBlendEquation(GL_FUNC_ADD);
-	glDisable(GL_CULL_FACE);
-	glDepthMask(GL_FALSE);
-			
-    glEnable( GL_PROGRAM_POINT_SIZE );
 
+	const size_t count = getParticleCount();
+	GLint first;
+	float* target = vbPosColor.map(count*7, 7, first);
+	if (blendMode == ParticleBlendMode::SORTED) {
+		sortVertices.resize(count*7);
+		writeData(sortVertices.data());
+		sortByDepth(v, count);
+		#pragma omp parallel for
+		for (int64_t i = 0;i<int64_t(count);++i) {
+			const float* source = sortVertices.data() + size_t(sortOrder[size_t(i)])*7;
+			std::copy(source, source+7, target + i*7);
+		}
+	} else {
+		writeData(target);
+	}
+	vbPosColor.unmap();
+
+	// growing the buffer replaces it, so the attributes are reconnected
+	if (vbGeneration != vbPosColor.getGeneration()) {
+		vbGeneration = vbPosColor.getGeneration();
+		particleArray.connectVertexAttrib(vbPosColor, prog, "vPos", 3, 7);
+		particleArray.connectVertexAttrib(vbPosColor, prog, "vColor", 4, 7, 3);
+	}
+
+	beginRender(v, p, blendMode);
 	particleArray.bind();
-	vbPosColor.setData(getData(),7,GL_DYNAMIC_DRAW);
+	glDrawArrays(GL_POINTS, first, GLsizei(count));
+	endRender(blendMode);
+	vbPosColor.nextFrame();
+}
+
+// maps floats to unsigned integers of the same order
+static uint32_t floatKey(float f) {
+    uint32_t u;
+    std::memcpy(&u, &f, sizeof(u));
+    return (u & 0x80000000u) ? ~u : (u | 0x80000000u);
+}
+
+// stable LSD radix sort of values by keys with 8 bit digits, every pass
+// counts and scatters fixed blocks in parallel
+static void radixSort(std::vector<uint32_t>& keys, std::vector<uint32_t>& values,
+                      std::vector<uint32_t>& keyScratch,
+                      std::vector<uint32_t>& valueScratch) {
+    const int64_t n = int64_t(keys.size());
+    const int64_t blockCount = 64;
+    const int64_t blockSize = (n+blockCount-1)/blockCount;
+    keyScratch.resize(keys.size());
+    valueScratch.resize(values.size());
+    std::vector<size_t> offsets(size_t(blockCount)*256);
+
+    for (uint32_t shift = 0;shift<32;shift+=8) {
+        std::fill(offsets.begin(), offsets.end(), 0);
+        #pragma omp parallel for
+        for (int64_t b = 0;b<blockCount;++b) {
+            size_t* histogram = offsets.data() + b*256;
+            const int64_t end = std::min(n, (b+1)*blockSize);
+            for (int64_t i = b*blockSize;i<end;++i)
+                ++histogram[(keys[size_t(i)] >> shift) & 0xFF];
+        }
+
+        // skip digits all keys share
+        size_t first = 0;
+        for (int64_t b = 0;b<blockCount;++b)
+            first += offsets[size_t(b)*256 + ((keys[0] >> shift) & 0xFF)];
+        if (first == size_t(n)) continue;
+
+        size_t sum = 0;
+        for (size_t d = 0;d<256;++d) {
+            for (int64_t b = 0;b<blockCount;++b) {
+                const size_t count = offsets[size_t(b)*256+d];
+                offsets[size_t(b)*256+d] = sum;
+                sum += count;
+            }
+        }
+
+        #pragma omp parallel for
+        for (int64_t b = 0;b<blockCount;++b) {
+            size_t* position = offsets.data() + b*256;
+            const int64_t end = std::min(n, (b+1)*blockSize);
+            for (int64_t i = b*blockSize;i<end;++i) {
+                const size_t target = position[(keys[size_t(i)] >> shift) & 0xFF]++;
+                keyScratch[target] = keys[size_t(i)];
+                valueScratch[target] = values[size_t(i)];
+            }
+        }
+        keys.swap(keyScratch);
+        values.swap(valueScratch);
+    }
+}
+
+// insertion sort for nearly sorted input, gives up after budget moves
+// leaving keys and values paired but only partially sorted
+static bool insertionSort(std::vector<uint32_t>& keys,
+                          std::vector<uint32_t>& values, size_t budget) {
+    size_t moves = 0;
+    for (size_t i = 1;i<keys.size();++i) {
+        const uint32_t key = keys[i];
+        const uint32_t value = values[i];
+        size_t j = i;
+        while (j > 0 && keys[j-1] > key) {
+            keys[j] = keys[j-1];
+            values[j] = values[j-1];
+            --j;
+            if (++moves > budget) {
+                keys[j] = key;
+                values[j] = value;
+                return false;
+            }
+        }
+        keys[j] = key;
+        values[j] = value;
+    }
+    return true;
+}
 
-	glDrawArrays(GL_POINTS, 0, GLsizei(getParticleCount()));
+void AbstractParticleSystem::sortByDepth(const Mat4& v, size_t count) {
+    // view space z, ascending order draws the farthest particles first
+    const float* m = v;
+    const Vec3 axis{m[8], m[9], m[10]};
+    const float* vertices = sortVertices.data();
+    auto depthKey = [&](size_t i) {
+        const float* p = vertices + i*7;
+        return floatKey(axis.x*p[0] + axis.y*p[1] + axis.z*p[2]);
+    };
 
-	glDisable(GL_BLEND);
-	glEnable(GL_CULL_FACE);
-	glDepthMask(GL_TRUE);
+    // moving the camera does not change the order, only turning it does, so
+    // while the view direction barely changes last frame's order is almost
+    // right and is only repaired
+    sortKeys.resize(count);
+    if (count == sortCount && Vec3::dot(axis, sortAxis) > 0.9995f) {
+        #pragma omp parallel for
+        for (int64_t i = 0;i<int64_t(count);++i)
+            sortKeys[size_t(i)] = depthKey(sortOrder[size_t(i)]);
+        if (insertionSort(sortKeys, sortOrder, count)) return;
+    } else {
+        sortOrder.resize(count);
+        #pragma omp parallel for
+        for (int64_t i = 0;i<int64_t(count);++i) {
+            sortOrder[size_t(i)] = uint32_t(i);
+            sortKeys[size_t(i)] = depthKey(size_t(i));
+        }
+    }
+    radixSort(sortKeys, sortOrder, sortKeyScratch, sortOrderScratch);
+    sortAxis = axis;
+    sortCount = count;
 }
 
 Vec3 AbstractParticleSystem::computeColor(const Vec3& c) {
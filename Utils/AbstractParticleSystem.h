@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+
 #include "Vec3.h"
 #include "Mat4.h"
 
@@ -7,10 +9,16 @@
 #include "GLBuffer.h"
 #include "GLArray.h"
 #include "GLTexture2D.h"
+#include "WeightedBlendedOIT.h"
 
 const Vec3 RANDOM_COLOR{-1.0f,-1.0f,-1.0f};
 const Vec3 RAINBOW_COLOR{-2.0f,-2.0f,-2.0f};
 
+// ADDITIVE needs no order, SORTED alpha blends the particles back to front
+// after sorting them by view depth, WEIGHTED_OIT approximates alpha blending
+// without any sorting
+enum class ParticleBlendMode {ADDITIVE, SORTED, WEIGHTED_OIT};
+
 class AbstractParticleSystem {
 public:
   AbstractParticleSystem(float pointSize, float refDepth=1.0f);
@@ -24,26 +32,57 @@ public:
     }
 	float getPointSize() const {return pointSize;}
     float getRefDepth() const {return refDepth;}
+    void setBlendMode(ParticleBlendMode blendMode) {this->blendMode = blendMode;}
+    ParticleBlendMode getBlendMode() const {return blendMode;}
 	virtual void setColor(const Vec3& color) = 0;
 	
-	void render(const Mat4& v, const Mat4& p);
+	virtual void render(const Mat4& v, const Mat4& p);
 	
 	virtual std::vector<float> getData() const = 0;
 	virtual size_t getParticleCount() const = 0;
 
+    // writes getParticleCount() interleaved position and color elements (7
+    // floats each) into the mapped vertex buffer, by default getData() is
+    // copied, subclasses can produce the data in place
+    virtual void writeData(float* target) const;
+
     static Vec3 computeColor(const Vec3& c);
+
+protected:
+    // sprite program and state shared by all particle systems, the array
+    // drawn in between has to provide vPos and vColor
+    const GLProgram& getProgram() const {return prog;}
+    void beginRender(const Mat4& v, const Mat4& p, ParticleBlendMode mode);
+    void endRender(ParticleBlendMode mode);
     
 private:
 	float pointSize;
     float refDepth;
+    ParticleBlendMode blendMode;
 	
 	GLProgram prog;
 	GLint mvpLocation;
     GLint ppLocation;
 	GLint texLocation;	
 	GLTexture2D sprite;	
+
+    GLProgram oitProg;
+    std::unique_ptr<WeightedBlendedOIT> oit;
 	
 	GLArray particleArray;
-	GLBuffer vbPosColor;
+	GLStreamBuffer vbPosColor;
+    uint64_t vbGeneration;
+
+    // depth sorting state, kept to sort incrementally while the view
+    // direction barely changes
+    std::vector<float> sortVertices;
+    std::vector<uint32_t> sortKeys;
+    std::vector<uint32_t> sortOrder;
+    std::vector<uint32_t> sortKeyScratch;
+    std::vector<uint32_t> sortOrderScratch;
+    Vec3 sortAxis;
+    size_t sortCount;
+
+    void sortByDepth(const Mat4& v, size_t count);
 
 };
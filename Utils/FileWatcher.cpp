@@ -0,0 +1,109 @@
+#include <algorithm>
+#include <chrono>
+
+#ifdef __linux__
+  #include <sys/inotify.h>
+  #include <poll.h>
+  #include <unistd.h>
+#endif
+
+#include "FileWatcher.h"
+
+FileWatcher::FileWatcher() :
+  running(false)
+#ifdef __linux__
+  , inotifyFd(inotify_init1(IN_NONBLOCK | IN_CLOEXEC))
+#endif
+{
+}
+
+FileWatcher::~FileWatcher() {
+  running = false;
+  if (thread.joinable()) thread.join();
+#ifdef __linux__
+  if (inotifyFd >= 0) close(inotifyFd);
+#endif
+}
+
+void FileWatcher::watch(const std::string& filename) {
+  std::error_code ec;
+  const std::filesystem::path path =
+    std::filesystem::absolute(filename, ec).lexically_normal();
+  if (ec) return;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  if (!files.emplace(path.string(), filename).second) return;
+
+#ifdef __linux__
+  // editors often replace the file instead of writing it, so the
+  // directory is watched and events are matched by name
+  if (inotifyFd < 0) return;
+  const std::string directory = path.parent_path().string();
+  const int wd = inotify_add_watch(inotifyFd, directory.c_str(),
+                                   IN_CLOSE_WRITE | IN_MOVED_TO);
+  if (wd >= 0) directories[wd] = directory;
+#else
+  times[path.string()] = std::filesystem::last_write_time(path, ec);
+#endif
+
+  if (!running) {
+    running = true;
+    thread = std::thread(&FileWatcher::run, this);
+  }
+}
+
+std::vector<std::string> FileWatcher::takeChanged() {
+  std::lock_guard<std::mutex> lock(mutex);
+  std::vector<std::string> result;
+  result.swap(changed);
+  return result;
+}
+
+void FileWatcher::addChanged(const std::string& path) {
+  const auto file = files.find(path);
+  if (file == files.end()) return;
+  if (std::find(changed.begin(), changed.end(), file->second) == changed.end())
+    changed.push_back(file->second);
+}
+
+#ifdef __linux__
+
+void FileWatcher::run() {
+  alignas(inotify_event) char buffer[4096];
+  while (running) {
+    // the timeout bounds how long the destructor waits
+    pollfd fd{inotifyFd, POLLIN, 0};
+    if (poll(&fd, 1, 100) <= 0) continue;
+    const ssize_t length = read(inotifyFd, buffer, sizeof(buffer));
+    if (length <= 0) continue;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (ssize_t offset = 0;offset<length;) {
+      const inotify_event* event =
+        reinterpret_cast<const inotify_event*>(buffer + offset);
+      offset += ssize_t(sizeof(inotify_event) + event->len);
+      if (event->len == 0) continue;
+      const auto directory = directories.find(event->wd);
+      if (directory == directories.end()) continue;
+      addChanged(directory->second + "/" + event->name);
+    }
+  }
+}
+
+#else
+
+void FileWatcher::run() {
+  while (running) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(250));
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto& entry : times) {
+      std::error_code ec;
+      const auto time = std::filesystem::last_write_time(entry.first, ec);
+      if (ec || time == entry.second) continue;
+      entry.second = time;
+      addChanged(entry.first);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <filesystem>
+
+// Reports files that were written since the last call to takeChanged.
+// A background thread waits for changes, with inotify on Linux and by
+// polling the modification times every few hundred milliseconds elsewhere.
+class FileWatcher {
+public:
+  FileWatcher();
+  ~FileWatcher();
+
+  FileWatcher(const FileWatcher&) = delete;
+  FileWatcher& operator=(const FileWatcher&) = delete;
+
+  // the name is reported as given here
+  void watch(const std::string& filename);
+
+  // every changed file once, in the order the changes were seen
+  std::vector<std::string> takeChanged();
+
+private:
+  std::mutex mutex;
+  std::map<std::string, std::string> files;   // absolute path to name
+  std::vector<std::string> changed;
+  std::atomic<bool> running;
+  std::thread thread;
+
+#ifdef __linux__
+  int inotifyFd;
+  std::map<int, std::string> directories;     // by watch descriptor
+#else
+  std::map<std::string, std::filesystem::file_time_type> times;
+#endif
+
+  void run();
+  void addChanged(const std::string& path);
+};
@@ -1,8 +1,13 @@
 #include <string>
 #include <fstream>
 #include <sstream>
+#include <algorithm>
+#include <array>
+#include <iomanip>
+#include <cstring>
 
 #include "FontRenderer.h"
+#include "MSDF.h"
 
 const CharPosition& FontRenderer::findElement(char c) const {
   for (size_t i = 0;i<positions.size();++i) {
@@ -103,9 +108,47 @@ std::string FontRenderer::toCode(const std::string& varName) const {
   return ss.str();
 }
 
-std::shared_ptr<FontEngine> FontRenderer::generateFontEngine() const {
-  std::shared_ptr<FontEngine> fe = std::make_shared<FontEngine>();
-  
+// shelf packing: sorted by decreasing height, rectangles are placed left to
+// right on rows as high as the first rectangle of the row, returns the size
+// of the atlas
+static Vec2ui packRects(const std::vector<Vec2ui>& sizes, uint32_t padding,
+                        std::vector<Vec2ui>& positions) {
+  uint64_t area = 0;
+  uint32_t maxWidth = 0;
+  std::vector<size_t> order(sizes.size());
+  for (size_t i = 0;i<sizes.size();++i) {
+    order[i] = i;
+    area += uint64_t(sizes[i].x+2*padding) * uint64_t(sizes[i].y+2*padding);
+    maxWidth = std::max(maxWidth, sizes[i].x+2*padding);
+  }
+  std::stable_sort(order.begin(), order.end(), [&sizes](size_t a, size_t b) {
+    return sizes[a].y > sizes[b].y;
+  });
+
+  uint32_t width = 1;
+  while (uint64_t(width)*uint64_t(width) < area) width *= 2;
+  width = std::max(width, maxWidth);
+
+  positions.resize(sizes.size());
+  uint32_t x = 0;
+  uint32_t y = 0;
+  uint32_t rowHeight = 0;
+  for (size_t i : order) {
+    const Vec2ui size{sizes[i].x+2*padding, sizes[i].y+2*padding};
+    if (x + size.x > width) {
+      x = 0;
+      y += rowHeight;
+      rowHeight = 0;
+    }
+    positions[i] = Vec2ui{x+padding, y+padding};
+    x += size.x;
+    rowHeight = std::max(rowHeight, size.y);
+  }
+  return {width, y+rowHeight};
+}
+
+void FontRenderer::bake(Image& atlas, DistanceAtlas& distanceAtlas,
+                        GlyphTable& glyphs) const {
   uint32_t maxWidth  = 0;
   uint32_t maxHeight = 0;
   
@@ -116,24 +159,180 @@ std::shared_ptr<FontEngine> FontRenderer::generateFontEngine() const {
     maxHeight = std::max(maxHeight, height);
   }
   
+  std::vector<Image> images;
+  std::vector<Grid2D> grids;
+  std::vector<Vec2ui> sizes;
   for (const CharPosition& c : positions) {
-    const Image i = render(std::string(1,c.c));
-    const float w=i.width/float(maxWidth);
-    const float h=i.height/float(maxHeight);
-    
-    const Mat4 s = Mat4::scaling(w,h,1.0f);
-    const Mat4 t = Mat4::translation(w,h,0.0f);
-    fe->chars[c.c] = CharTex{GLTexture2D(i),s,t,w,h};
-    fe->chars[c.c].tex.setFilter(GL_LINEAR, GL_LINEAR);
+    images.push_back(render(std::string(1,c.c)));
+    grids.push_back(Grid2D(images.back()));
+    sizes.push_back({images.back().width, images.back().height});
+  }
 
-    fe->sdChars[c.c] = CharTex{Grid2D(i).toSignedDistance(0.9f).toTexture(),s,t,w,h};
-    fe->sdChars[c.c].tex.setFilter(GL_LINEAR, GL_LINEAR);
+  // per glyph distances, interleaved by channel
+  const uint8_t channelCount = distanceFieldMode == DistanceFieldMode::Multi ? 3 : 1;
+  std::vector<std::vector<float>> distances;
+  if (distanceFieldMode == DistanceFieldMode::Multi) {
+    distances = MSDF::generate(grids, 0.5f);
+  } else {
+    for (const Grid2D& d : Grid2D::toSignedDistance(grids, 0.9f))
+      distances.push_back(d.getData());
   }
-  return fe;
+
+  // one texel of padding, filled with the glyph border, keeps bilinear
+  // filtering from picking up the neighbouring glyphs
+  const uint32_t padding = 1;
+  std::vector<Vec2ui> offsets;
+  const Vec2ui atlasSize = packRects(sizes, padding, offsets);
+  const uint8_t componentCount = fontImage.componentCount;
+  atlas = Image{atlasSize.x, atlasSize.y, componentCount,
+    std::vector<uint8_t>(size_t(atlasSize.x)*atlasSize.y*componentCount)};
+  distanceAtlas = DistanceAtlas{atlasSize.x, atlasSize.y, channelCount,
+    std::vector<float>(size_t(atlasSize.x)*atlasSize.y*channelCount,
+                       -float(std::max(maxWidth, maxHeight)))};
+
+  glyphs = GlyphTable{};
+  for (size_t j = 0;j<positions.size();++j) {
+    const Image& i = images[j];
+    const Vec2ui& o = offsets[j];
+
+    if (i.width > 0 && i.height > 0) {
+      for (uint32_t y = 0;y<i.height+2*padding;++y) {
+        const uint32_t sy = std::min(i.height-1, uint32_t(std::max(0, int32_t(y)-int32_t(padding))));
+        for (uint32_t x = 0;x<i.width+2*padding;++x) {
+          const uint32_t sx = std::min(i.width-1, uint32_t(std::max(0, int32_t(x)-int32_t(padding))));
+          for (uint8_t c = 0;c<componentCount;++c) {
+            atlas.setValue(o.x+x-padding, o.y+y-padding, c, i.getValue(sx, sy, c));
+          }
+          const size_t target = (size_t(o.y+y-padding)*atlasSize.x + o.x+x-padding)*channelCount;
+          const size_t source = (size_t(sy)*i.width + sx)*channelCount;
+          std::copy(distances[j].begin()+source, distances[j].begin()+source+channelCount,
+                    distanceAtlas.data.begin()+target);
+        }
+      }
+    }
+
+    Glyph& g = glyphs[uint8_t(positions[j].c)];
+    g.texMin = Vec2{o.x/float(atlasSize.x), o.y/float(atlasSize.y)};
+    g.texMax = Vec2{(o.x+i.width)/float(atlasSize.x), (o.y+i.height)/float(atlasSize.y)};
+    g.width  = i.width/float(maxWidth);
+    g.height = i.height/float(maxHeight);
+    g.valid  = true;
+  }
+}
+
+std::shared_ptr<FontEngine> FontRenderer::generateFontEngine() const {
+  Image atlas{0,0};
+  DistanceAtlas distanceAtlas;
+  GlyphTable glyphs;
+  bake(atlas, distanceAtlas, glyphs);
+  return std::make_shared<FontEngine>(atlas, distanceAtlas, glyphs);
+}
+
+// layout of the baked font blob, all values are in the byte order of the
+// host that baked it, fromBlob rejects blobs whose byteOrder reads wrong
+struct FontBlobHeader {
+  char magic[4];
+  uint32_t version;
+  uint32_t width;
+  uint32_t height;
+  uint32_t componentCount;
+  uint32_t glyphCount;
+  uint64_t atlasOffset;      // width*height*componentCount bytes
+  uint64_t distanceOffset;   // width*height*distanceChannels floats
+  uint64_t size;
+  uint32_t distanceChannels;
+  uint32_t byteOrder;        // fontBlobByteOrder
+};
+
+struct FontBlobGlyph {
+  float texMin[2];
+  float texMax[2];
+  float width;
+  float height;
+  uint32_t valid;
+  uint32_t reserved;
+};
+
+static_assert(sizeof(FontBlobHeader) == 56, "unexpected blob header size");
+static_assert(sizeof(FontBlobGlyph) == 32, "unexpected blob glyph size");
+
+static const char fontBlobMagic[4] = {'F','N','T','B'};
+static const uint32_t fontBlobVersion = 3;
+static const uint32_t fontBlobByteOrder = 0x01020304;
+
+std::vector<uint8_t> FontRenderer::toBlob() const {
+  Image atlas{0,0};
+  DistanceAtlas distanceAtlas;
+  GlyphTable glyphs;
+  bake(atlas, distanceAtlas, glyphs);
+
+  FontBlobHeader header;
+  std::copy(fontBlobMagic, fontBlobMagic+4, header.magic);
+  header.version = fontBlobVersion;
+  header.width = atlas.width;
+  header.height = atlas.height;
+  header.componentCount = atlas.componentCount;
+  header.glyphCount = uint32_t(glyphs.size());
+  header.atlasOffset = sizeof(FontBlobHeader) + glyphs.size()*sizeof(FontBlobGlyph);
+  header.distanceOffset = (header.atlasOffset + atlas.data.size() + 15) & ~uint64_t(15);
+  header.size = header.distanceOffset + distanceAtlas.data.size()*sizeof(float);
+  header.distanceChannels = distanceAtlas.channelCount;
+  header.byteOrder = fontBlobByteOrder;
+
+  std::vector<uint8_t> blob(header.size);
+  std::memcpy(blob.data(), &header, sizeof(header));
+  for (size_t i = 0;i<glyphs.size();++i) {
+    const Glyph& g = glyphs[i];
+    const FontBlobGlyph bg{{g.texMin.x, g.texMin.y}, {g.texMax.x, g.texMax.y},
+                           g.width, g.height, uint32_t(g.valid), 0};
+    std::memcpy(blob.data() + sizeof(header) + i*sizeof(bg), &bg, sizeof(bg));
+  }
+  std::memcpy(blob.data() + header.atlasOffset, atlas.data.data(), atlas.data.size());
+  std::memcpy(blob.data() + header.distanceOffset, distanceAtlas.data.data(),
+              distanceAtlas.data.size()*sizeof(float));
+  return blob;
 }
 
+std::string FontRenderer::toBlobCode(const std::string& varName) const {
+  std::vector<uint8_t> blob = toBlob();
+  const size_t size = blob.size();
+  blob.resize((size+7)/8*8);
 
-FontEngine::FontEngine() :
+  std::stringstream ss;
+  ss << "constexpr size_t " << varName << "Size = " << size << ";\n";
+  ss << "alignas(16) constexpr uint64_t " << varName << "[] = {";
+  ss << std::hex << std::setfill('0');
+  for (size_t i = 0;i<blob.size();i+=8) {
+    // native words, so the array holds the same bytes on this host
+    uint64_t word;
+    std::memcpy(&word, blob.data()+i, sizeof(word));
+    if (i % 64 == 0) ss << "\n  ";
+    ss << "0x" << std::setw(16) << word << "u";
+    if (i+8 < blob.size()) ss << ",";
+  }
+  ss << "\n};\n";
+  return ss.str();
+}
+
+
+TextLayout::TextLayout(const std::vector<float>& vertices,
+                       const GLProgram& program, const Vec2& size) :
+  array{},
+  buffer{GL_ARRAY_BUFFER},
+  vertexCount{GLsizei(vertices.size()/5)},
+  size{size}
+{
+  buffer.setData(vertices,5,GL_STATIC_DRAW);
+  array.connectVertexAttrib(buffer, program, "vPos", 3);
+  array.connectVertexAttrib(buffer, program, "vTexCoords", 2, 3);
+}
+
+void TextLayout::bind() const {
+  array.bind();
+}
+
+FontEngine::FontEngine(const Image& atlas, const DistanceAtlas& distanceAtlas,
+                       const GlyphTable& glyphs) :
   simpleProg{GLProgram::createFromString(
    "#version 410\n"
    "uniform mat4 MVP;\n"
@@ -174,75 +373,249 @@ FontEngine::FontEngine() :
    "    float val  = smoothstep(-3.0,1.0,dist);\n"
    "    FragColor  = globalColor*val;\n"
    "}\n")},
-  simpleArray{},
-  simpleVb{GL_ARRAY_BUFFER},
-  renderAsSignedDistanceField{false}
+  simpleMSDFProg{GLProgram::createFromString(
+   "#version 410\n"
+   "uniform mat4 MVP;\n"
+   "layout (location = 0) in vec3 vPos;\n"
+   "layout (location = 1) in vec2 vTexCoords;\n"
+   "out vec4 color;\n"
+   "out vec2 texCoords;\n"
+   "void main() {\n"
+   "    gl_Position = MVP * vec4(vPos, 1.0);\n"
+   "    texCoords = vTexCoords;\n"
+   "}\n",
+   "#version 410\n"
+   "uniform sampler2D raster;\n"
+   "uniform vec4 globalColor;\n"
+   "in vec2 texCoords;\n"
+   "out vec4 FragColor;\n"
+   "float median(vec3 v) {\n"
+   "    return max(min(v.r, v.g), min(max(v.r, v.g), v.b));\n"
+   "}\n"
+   "void main() {\n"
+   "    float dist = median(texture(raster, texCoords).rgb);\n"
+   "    float val  = clamp(dist/max(fwidth(dist),1e-4)+0.5,0.0,1.0);\n"
+   "    FragColor  = globalColor*val;\n"
+   "}\n")},
+  renderAsSignedDistanceField{false},
+  glyphs(glyphs),
+  atlas{atlas, GL_LINEAR, GL_LINEAR, GL_CLAMP_TO_EDGE, GL_CLAMP_TO_EDGE},
+  distanceAtlas{GL_LINEAR, GL_LINEAR, GL_CLAMP_TO_EDGE, GL_CLAMP_TO_EDGE},
+  distanceChannelCount{distanceAtlas.channelCount},
+  layoutCacheSize{64}
 {
-  simpleArray.bind();
-  std::vector<float> data = {
-    -1.0f,  1.0f, 0.0f, 0.0f, 1.0f,
-     1.0f, -1.0f, 0.0f, 1.0f, 0.0f,
-     1.0f,  1.0f, 0.0f, 1.0f, 1.0f,
-
-    -1.0f,  1.0f, 0.0f, 0.0f, 1.0f,
-    -1.0f, -1.0f, 0.0f, 0.0f, 0.0f,
-     1.0f, -1.0f, 0.0f, 1.0f, 0.0f
+  this->distanceAtlas.setData(distanceAtlas.data, distanceAtlas.width,
+                              distanceAtlas.height, distanceAtlas.channelCount);
+}
+
+std::shared_ptr<FontEngine> FontEngine::fromBlob(const void* blob, size_t size) {
+  const uint8_t* bytes = static_cast<const uint8_t*>(blob);
+  FontBlobHeader header;
+  if (size < sizeof(header)) throw FontException{"Font blob is truncated"};
+  std::memcpy(&header, bytes, sizeof(header));
+
+  if (!std::equal(fontBlobMagic, fontBlobMagic+4, header.magic))
+    throw FontException{"Data is not a font blob"};
+  if (header.byteOrder == 0x04030201)
+    throw FontException{"Font blob was baked with a different byte order"};
+  if (header.version != fontBlobVersion || header.byteOrder != fontBlobByteOrder)
+    throw FontException{"Unsupported font blob version"};
+
+  // offsets and counts are untrusted, each is checked against the space
+  // left after it so the sums below cannot overflow
+  const auto fits = [&header](uint64_t offset, uint64_t count, uint64_t elementSize) {
+    return offset <= header.size && count <= (header.size-offset)/elementSize;
   };
-  simpleVb.setData(data,5,GL_STATIC_DRAW);
+  const uint64_t texels = uint64_t(header.width)*header.height;
+  if (header.glyphCount != GlyphTable{}.size() || header.size > size ||
+      header.componentCount < 1 || header.componentCount > 4 ||
+      (header.distanceChannels != 1 && header.distanceChannels != 3) ||
+      !fits(sizeof(header), header.glyphCount, sizeof(FontBlobGlyph)) ||
+      header.atlasOffset < sizeof(header) + header.glyphCount*sizeof(FontBlobGlyph) ||
+      !fits(header.atlasOffset, texels, header.componentCount) ||
+      header.atlasOffset + texels*header.componentCount > header.distanceOffset ||
+      !fits(header.distanceOffset, texels, header.distanceChannels*sizeof(float)))
+    throw FontException{"Font blob is corrupt"};
+  const uint64_t distanceCount = texels*header.distanceChannels;
+
+  GlyphTable glyphs;
+  for (size_t i = 0;i<glyphs.size();++i) {
+    FontBlobGlyph bg;
+    std::memcpy(&bg, bytes + sizeof(header) + i*sizeof(bg), sizeof(bg));
+    glyphs[i] = Glyph{{bg.texMin[0], bg.texMin[1]}, {bg.texMax[0], bg.texMax[1]},
+                      bg.width, bg.height, bg.valid != 0};
+  }
+
+  const uint8_t* atlasData = bytes + header.atlasOffset;
+  const Image atlas{header.width, header.height, uint8_t(header.componentCount),
+                    std::vector<uint8_t>(atlasData, atlasData + texels*header.componentCount)};
+  DistanceAtlas distanceAtlas{header.width, header.height,
+    uint8_t(header.distanceChannels), std::vector<float>(distanceCount)};
+  std::memcpy(distanceAtlas.data.data(), bytes + header.distanceOffset,
+              distanceCount*sizeof(float));
+
+  return std::make_shared<FontEngine>(atlas, distanceAtlas, glyphs);
 }
 
-void FontEngine::render(const std::string& text, float winAspect,
-                        float height, const Vec2& pos, Alignment a, const Vec4& color) {
-  
-  GLProgram& activeShader = (renderAsSignedDistanceField) ? simpleDistProg : simpleProg;
-  std::map<char,CharTex>& activeFontMap = (renderAsSignedDistanceField) ? sdChars : chars;
-  
-  activeShader.enable();
-  activeShader.setUniform("globalColor", color);
-  simpleArray.bind();
-  simpleArray.connectVertexAttrib(simpleVb, activeShader, "vPos", 3);
-  simpleArray.connectVertexAttrib(simpleVb, activeShader, "vTexCoords", 2, 3);
-  
+const Glyph& FontEngine::getGlyph(char c) const {
+  const Glyph& g = glyphs[uint8_t(c)];
+  return g.valid ? g : glyphs[uint8_t('_')];
+}
+
+float FontEngine::totalWidth(const std::string& text) const {
   float totalWidth = 0;
+  for (char c : text) totalWidth += getGlyph(c).width;
+  return totalWidth;
+}
+
+std::shared_ptr<const TextLayout> FontEngine::createLayout(const std::string& text,
+                                                         float x, float scaleX,
+                                                         float scaleY,
+                                                         const Vec2& size) const {
+  // all glyphs are quads in the same atlas, so the text is a single draw
+  std::vector<float> vertices;
+  vertices.reserve(text.size()*30);
   for (char c : text) {
-    if (activeFontMap.find(c) == activeFontMap.end()) c = '_';
-    totalWidth += activeFontMap.at(c).width;
+    const Glyph& g = getGlyph(c);
+    const float l = x;
+    const float r = x+2.0f*scaleX*g.width;
+    const float b = -scaleY;
+    const float t = scaleY*(2.0f*g.height-1.0f);
+    vertices.insert(vertices.end(), {
+      l, t, 0.0f, g.texMin.x, g.texMax.y,
+      r, b, 0.0f, g.texMax.x, g.texMin.y,
+      r, t, 0.0f, g.texMax.x, g.texMax.y,
+
+      l, t, 0.0f, g.texMin.x, g.texMax.y,
+      l, b, 0.0f, g.texMin.x, g.texMin.y,
+      r, b, 0.0f, g.texMax.x, g.texMin.y
+    });
+    x = r;
   }
-  
-  Mat4 scale = Mat4::scaling(height/winAspect, height, 1.0f);
-  Mat4 trans;
-  switch (a) {
-    case Alignment::Center :
-      trans = Mat4::translation(pos.x-height*totalWidth/winAspect, pos.y, 0.0f);
-      break;
-    case Alignment::Right :
-      trans = Mat4::translation(pos.x-2.0f*height*totalWidth/winAspect, pos.y, 0.0f);
-      break;
-    default :
-      trans = Mat4::translation(pos.x, pos.y, 0.0f);
-      break;
+  return std::make_shared<const TextLayout>(vertices, simpleProg, size);
+}
+
+bool FontEngine::LayoutKey::operator==(const LayoutKey& other) const {
+  return text == other.text && size == other.size &&
+         winAspect == other.winAspect && alignment == other.alignment &&
+         fixedWidth == other.fixedWidth;
+}
+
+size_t FontEngine::LayoutKeyHash::operator()(const LayoutKey& key) const {
+  size_t h = std::hash<std::string>{}(key.text);
+  h = h * 31 + std::hash<float>{}(key.size);
+  h = h * 31 + std::hash<float>{}(key.winAspect);
+  h = h * 31 + size_t(key.alignment) * 2 + size_t(key.fixedWidth);
+  return h;
+}
+
+std::shared_ptr<const TextLayout> FontEngine::cachedLayout(const LayoutKey& key) {
+  const auto cached = layouts.find(key);
+  if (cached != layouts.end()) {
+    lru.splice(lru.begin(), lru, cached->second.lruPosition);
+    return cached->second.layout;
   }
-  
-  for (char c : text) {
-    if (activeFontMap.find(c) == activeFontMap.end()) c = '_';
-    activeShader.setUniform("MVP",
-                            trans *
-                            Mat4::translation(height*activeFontMap[c].width/winAspect,height*(activeFontMap[c].height-1.0f),0.0f) *
-                            activeFontMap[c].scale *
-                            scale);
-    activeShader.setTexture("raster",activeFontMap[c].tex,0);
-    GL(glDrawArrays(GL_TRIANGLES, 0, GLsizei(6)));
-    trans = Mat4::translation(2.0f*height*activeFontMap[c].width/winAspect,0.0f,0.0f) * trans;
+
+  const float width = totalWidth(key.text);
+  std::shared_ptr<const TextLayout> result;
+  if (key.fixedWidth) {
+    const float scaleX = key.size/width;
+    float x;
+    switch (key.alignment) {
+      case Alignment::Center :
+        x = -key.size;
+        break;
+      case Alignment::Right :
+        x = -2.0f*key.size;
+        break;
+      default :
+        x = 0.0f;
+        break;
+    }
+    result = createLayout(key.text, x, scaleX, scaleX*key.winAspect,
+                          getSizeFixedWidth(key.text, key.winAspect, key.size));
+  } else {
+    const float scaleX = key.size/key.winAspect;
+    float x;
+    switch (key.alignment) {
+      case Alignment::Center :
+        x = -scaleX*width;
+        break;
+      case Alignment::Right :
+        x = -2.0f*scaleX*width;
+        break;
+      default :
+        x = 0.0f;
+        break;
+    }
+    result = createLayout(key.text, x, scaleX, key.size,
+                          getSize(key.text, key.winAspect, key.size));
+  }
+
+  if (layoutCacheSize == 0) return result;
+  while (layouts.size() >= layoutCacheSize) {
+    layouts.erase(lru.back());
+    lru.pop_back();
   }
+  lru.push_front(key);
+  layouts[key] = CachedLayout{result, lru.begin()};
+  return result;
 }
 
-Vec2 FontEngine::getSize(const std::string& text, float winAspect, float height) const {
-  float totalWidth = 0;
-  for (char c : text) {
-    if (chars.find(c) == chars.end()) c = '_';
-    totalWidth += chars.at(c).width;
+std::shared_ptr<const TextLayout> FontEngine::layout(const std::string& text,
+                                                     float winAspect,
+                                                     float height,
+                                                     Alignment a) {
+  return cachedLayout({text, height, winAspect, a, false});
+}
+
+std::shared_ptr<const TextLayout> FontEngine::layoutFixedWidth(const std::string& text,
+                                                               float winAspect,
+                                                               float width,
+                                                               Alignment a) {
+  return cachedLayout({text, width, winAspect, a, true});
+}
+
+void FontEngine::setLayoutCacheSize(size_t count) {
+  layoutCacheSize = count;
+  while (layouts.size() > layoutCacheSize) {
+    layouts.erase(lru.back());
+    lru.pop_back();
   }
-  return {height*totalWidth/winAspect, height};
+}
+
+size_t FontEngine::getLayoutCacheSize() const {
+  return layoutCacheSize;
+}
+
+void FontEngine::render(const TextLayout& layout, const Vec2& pos,
+                        const Vec4& color) {
+  render(layout, pos, color, renderAsSignedDistanceField);
+}
+
+void FontEngine::render(const TextLayout& layout, const Vec2& pos,
+                        const Vec4& color, bool signedDistance) {
+  if (layout.getVertexCount() == 0) return;
+
+  GLProgram& activeShader = !signedDistance ? simpleProg :
+    (distanceChannelCount == 3 ? simpleMSDFProg : simpleDistProg);
+  const GLTexture2D& activeAtlas = (signedDistance) ? distanceAtlas : atlas;
+
+  activeShader.enable();
+  activeShader.setUniform("globalColor", color);
+  activeShader.setUniform("MVP", Mat4::translation(pos.x, pos.y, 0.0f));
+  activeShader.setTexture("raster",activeAtlas,0);
+  layout.bind();
+  GL(glDrawArrays(GL_TRIANGLES, 0, layout.getVertexCount()));
+}
+
+void FontEngine::render(const std::string& text, float winAspect,
+                        float height, const Vec2& pos, Alignment a, const Vec4& color) {
+  render(*layout(text, winAspect, height, a), pos, color);
+}
+
+Vec2 FontEngine::getSize(const std::string& text, float winAspect, float height) const {
+  return {height*totalWidth(text)/winAspect, height};
 }
 
 void FontEngine::render(uint32_t number, float winAspect, float height, const Vec2& pos,
@@ -264,60 +637,19 @@ Vec2 FontEngine::getSizeFixedWidth(uint32_t number, float winAspect, float width
 }
 
 Vec2 FontEngine::getSizeFixedWidth(const std::string& text, float winAspect, float width) const {
-  float totalWidth = 0;
-  for (char c : text) {
-    if (chars.find(c) == chars.end()) c = '_';
-    totalWidth += chars.at(c).width;
-  }
-  return {width, width*winAspect/totalWidth};
+  return {width, width*winAspect/totalWidth(text)};
 }
 
 
 void FontEngine::renderFixedWidth(const std::string& text, float winAspect, float width, const Vec2& pos, Alignment a, const Vec4& color) {
-  simpleProg.enable();
-  simpleProg.setUniform("globalColor", color);
-  simpleArray.bind();
-  simpleArray.connectVertexAttrib(simpleVb, simpleProg, "vPos", 3);
-  simpleArray.connectVertexAttrib(simpleVb, simpleProg, "vTexCoords", 2, 3);
-  
-  float totalWidth = 0;
-  for (char c : text) {
-    if (chars.find(c) == chars.end()) c = '_';
-    totalWidth += chars.at(c).width;
-  }
-  
-  Mat4 scale = Mat4::scaling(width/totalWidth, width/totalWidth*winAspect, 1.0f);
-  Mat4 trans;
-  switch (a) {
-    case Alignment::Center :
-      trans = Mat4::translation(pos.x-width, pos.y, 0.0f);
-      break;
-    case Alignment::Right :
-      trans = Mat4::translation(pos.x-2.0f*width, pos.y, 0.0f);
-      break;
-    default :
-      trans = Mat4::translation(pos.x, pos.y, 0.0f);
-      break;
-  }
-  
-  for (char c : text) {
-    if (chars.find(c) == chars.end()) c = '_';
-    simpleProg.setUniform("MVP", trans *
-                          Mat4::translation(width*chars[c].width/totalWidth, width/totalWidth*winAspect*(chars[c].height-1.0f),0.0f) *
-                          chars[c].scale *
-                          scale);
-
-    simpleProg.setTexture("raster",chars[c].tex,0);
-    GL(glDrawArrays(GL_TRIANGLES, 0, GLsizei(6)));
-    trans = Mat4::translation(2.0f* width*chars[c].width/totalWidth,0.0f,0.0f) * trans;
-  }
+  render(*layoutFixedWidth(text, winAspect, width, a), pos, color, false);
 }
 
 
 std::string FontEngine::getAllCharsString() const {
   std::stringstream ss;
-  for (const auto& c : chars) {
-    ss << c.first;
+  for (size_t c = 0;c<glyphs.size();++c) {
+    if (glyphs[c].valid) ss << char(c);
   }
   return ss.str();
 }
@@ -2,7 +2,9 @@
 
 #include <string>
 #include <vector>
-#include <map>
+#include <array>
+#include <list>
+#include <unordered_map>
 #include <utility>
 #include <memory>
 
@@ -13,18 +15,49 @@
 #include "GLBuffer.h"
 #include "Grid2D.h"
 
+class FontException : public std::exception {
+public:
+  FontException(const std::string& whatStr) : whatStr(whatStr) {}
+  virtual const char* what() const throw() {
+    return whatStr.c_str();
+  }
+private:
+  std::string whatStr;
+};
+
 struct CharPosition {
   char c;
   Vec2ui topLeft;
   Vec2ui bottomRight;
 };
 
-struct CharTex {
-  GLTexture2D tex;
-  Mat4 scale;
-  Mat4 trans;
-  float width;
-  float height;
+// placement of a glyph in the font atlas, width and height are relative to
+// the largest glyph of the font
+struct Glyph {
+  Vec2 texMin{0.0f,0.0f};
+  Vec2 texMax{0.0f,0.0f};
+  float width{0.0f};
+  float height{0.0f};
+  bool valid{false};
+};
+
+// glyphs indexed by the byte value of the character
+typedef std::array<Glyph, 256> GlyphTable;
+
+// signed distance fields of all glyphs at their atlas positions, in texels
+// of the glyph images, interleaved when there is more than one channel
+struct DistanceAtlas {
+  uint32_t width{0};
+  uint32_t height{0};
+  uint8_t channelCount{1};
+  std::vector<float> data;
+};
+
+// Single bakes one distance channel from the glyph raster, Multi bakes a
+// three channel field (see MSDF.h) that keeps corners sharp at small sizes
+enum class DistanceFieldMode {
+  Single,
+  Multi
 };
 
 enum class Alignment {
@@ -33,10 +66,38 @@ enum class Alignment {
   Center
 };
 
+// a string shaped into glyph quads once and kept in its own vertex buffer,
+// the quads are relative to the position the text is rendered at
+class TextLayout {
+public:
+  TextLayout(const std::vector<float>& vertices, const GLProgram& program,
+             const Vec2& size);
+
+  TextLayout(const TextLayout&) = delete;
+  TextLayout& operator=(const TextLayout&) = delete;
+
+  const Vec2& getSize() const {return size;}
+  GLsizei getVertexCount() const {return vertexCount;}
+  void bind() const;
+
+private:
+  GLArray array;
+  GLBuffer buffer;
+  GLsizei vertexCount;
+  Vec2 size;
+};
+
 class FontEngine {
 public:
-  FontEngine();
+  // atlas holds the glyph images, distanceAtlas their signed distance
+  // fields at the same positions
+  FontEngine(const Image& atlas, const DistanceAtlas& distanceAtlas,
+             const GlyphTable& glyphs);
   virtual ~FontEngine() {}
+
+  // creates an engine from a font baked by FontRenderer::toBlob, the atlas,
+  // distance field and glyph table are used as stored
+  static std::shared_ptr<FontEngine> fromBlob(const void* blob, size_t size);
   void render(const std::string& text, float winAspect, float height,
               const Vec2& pos, Alignment a = Alignment::Center, const Vec4& color=Vec4{1.0f,1.0f,1.0f,1.0f});
   void renderFixedWidth(const std::string& text, float winAspect, float width,
@@ -47,6 +108,21 @@ public:
   void renderFixedWidth(uint32_t number, float winAspect, float width,
                         const Vec2& pos, Alignment a = Alignment::Center, const Vec4& color=Vec4{1.0f,1.0f,1.0f,1.0f});
 
+  // layouts of recently rendered strings are cached, so rendering an
+  // unchanged string costs a single draw call
+  std::shared_ptr<const TextLayout> layout(const std::string& text,
+                                           float winAspect, float height,
+                                           Alignment a = Alignment::Center);
+  std::shared_ptr<const TextLayout> layoutFixedWidth(const std::string& text,
+                                                     float winAspect,
+                                                     float width,
+                                                     Alignment a = Alignment::Center);
+  void render(const TextLayout& layout, const Vec2& pos,
+              const Vec4& color=Vec4{1.0f,1.0f,1.0f,1.0f});
+
+  void setLayoutCacheSize(size_t count);
+  size_t getLayoutCacheSize() const;
+
   Vec2 getSize(const std::string& text, float winAspect, float height) const;
   Vec2 getSizeFixedWidth(const std::string& text, float winAspect, float width) const;
 
@@ -55,9 +131,9 @@ public:
 
   std::string getAllCharsString() const;
 
-  std::map<char,CharTex> chars;
-  std::map<char,CharTex> sdChars;
-  
+  // glyph used to render c, unknown characters are rendered as '_'
+  const Glyph& getGlyph(char c) const;
+
   void setRenderAsSignedDistanceField(bool renderAsSignedDistanceField) {
     this->renderAsSignedDistanceField = renderAsSignedDistanceField;
   }
@@ -69,9 +145,44 @@ public:
 private:
   GLProgram simpleProg;
   GLProgram simpleDistProg;
-  GLArray   simpleArray;
-  GLBuffer  simpleVb;
+  GLProgram simpleMSDFProg;
   bool renderAsSignedDistanceField;
+  GlyphTable glyphs;
+  GLTexture2D atlas;
+  GLTexture2D distanceAtlas;
+  uint8_t distanceChannelCount;
+
+  struct LayoutKey {
+    std::string text;
+    float size;
+    float winAspect;
+    Alignment alignment;
+    bool fixedWidth;
+
+    bool operator==(const LayoutKey& other) const;
+  };
+
+  struct LayoutKeyHash {
+    size_t operator()(const LayoutKey& key) const;
+  };
+
+  struct CachedLayout {
+    std::shared_ptr<const TextLayout> layout;
+    std::list<LayoutKey>::iterator lruPosition;
+  };
+
+  size_t layoutCacheSize;
+  std::list<LayoutKey> lru;
+  std::unordered_map<LayoutKey, CachedLayout, LayoutKeyHash> layouts;
+
+  float totalWidth(const std::string& text) const;
+  void render(const TextLayout& layout, const Vec2& pos, const Vec4& color,
+              bool signedDistance);
+  std::shared_ptr<const TextLayout> cachedLayout(const LayoutKey& key);
+  std::shared_ptr<const TextLayout> createLayout(const std::string& text,
+                                                 float x, float scaleX,
+                                                 float scaleY,
+                                                 const Vec2& size) const;
 
 };
 
@@ -94,10 +205,24 @@ public:
   std::string toCode(const std::string& varName) const;
 
   std::shared_ptr<FontEngine> generateFontEngine() const;
+
+  // kind of distance field baked by generateFontEngine and toBlob
+  void setDistanceFieldMode(DistanceFieldMode mode) {distanceFieldMode = mode;}
+  DistanceFieldMode getDistanceFieldMode() const {return distanceFieldMode;}
+
+  // the fully baked font (atlas, signed distance field and glyph table) as
+  // a binary blob for FontEngine::fromBlob, in the byte order of this host
+  std::vector<uint8_t> toBlob() const;
+  // the blob as a constexpr array of 64 bit words, which compiles much
+  // faster than a byte list, use FontEngine::fromBlob(varName, varNameSize)
+  // on a host with the same byte order
+  std::string toBlobCode(const std::string& varName) const;
   
 private:
   Image fontImage;
   std::vector<CharPosition> positions;
+  DistanceFieldMode distanceFieldMode{DistanceFieldMode::Single};
   
   const CharPosition& findElement(char c) const;
+  void bake(Image& atlas, DistanceAtlas& distanceAtlas, GlyphTable& glyphs) const;
 };
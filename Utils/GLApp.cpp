@@ -1,3 +1,6 @@
+#include <tuple>
+#include <iterator>
+
 #include "GLApp.h"
 
 GLApp* GLApp::staticAppPtr = nullptr;
@@ -105,12 +108,24 @@ GLApp::GLApp(uint32_t w, uint32_t h, uint32_t s,
      "    FragColor = color*abs(dot(nlightDir,nnormal));\n"
      "}\n")},
   simpleArray{},
+  simpleTexArray{},
+  simpleLightArray{},
   simpleVb{GL_ARRAY_BUFFER},
-  raster{GL_LINEAR, GL_LINEAR,GL_CLAMP_TO_EDGE,GL_CLAMP_TO_EDGE},
   pointSprite{GL_LINEAR, GL_LINEAR,GL_CLAMP_TO_EDGE,GL_CLAMP_TO_EDGE},
   pointSpriteHighlight{GL_LINEAR, GL_LINEAR,GL_CLAMP_TO_EDGE,GL_CLAMP_TO_EDGE},
   resumeTime{0},
-  animationActive{true}
+  animationActive{true},
+  lastTrisType{TrisDrawType::LIST},
+  lastTrisCount{0},
+  lastLighting{false},
+  simpleVbGeneration{0},
+  drawLayer{0},
+  drawBlendMode{DrawBlendMode::KEEP},
+  drawTransformChanged{true},
+  drawBatchCount{0},
+  rasterCount{0},
+  rasterMagFilter{GL_LINEAR},
+  rasterMinFilter{GL_LINEAR}
 {
   staticAppPtr = this;
   glEnv.setMouseCallbacks(cursorPositionCallback, mouseButtonCallback, scrollCallback);
@@ -124,7 +139,7 @@ GLApp::GLApp(uint32_t w, uint32_t h, uint32_t s,
   
   glfwSetTime(0);
   Dimensions dim{ glEnv.getFramebufferSize() };
-  glViewport(0, 0, GLsizei(dim.width), GLsizei(dim.height));
+  GLState::current().viewport(0, 0, GLsizei(dim.width), GLsizei(dim.height));
 }
 
 GLApp::~GLApp() {
@@ -169,17 +184,24 @@ void GLApp::run() {
   const Dimensions dim{ glEnv.getFramebufferSize() };
   resize(GLsizei(dim.width), GLsizei(dim.height));
   do {
+    // callbacks, animate and draw may change state with plain GL calls
+    GLState::current().invalidate();
     if (animationActive) {
       animate(glfwGetTime());
     }
     draw();
+    GLState::current().invalidate();
+    flushDraws();
+    simpleVb.nextFrame();
     glEnv.endOfFrame();
+    // swaps in shaders edited on disk between frames
+    GLProgram::reloadChanged();
   } while (!glEnv.shouldClose());
 }
  
 void GLApp::resize(int width, int height) {
   const Dimensions dim{ glEnv.getFramebufferSize() };
-  GL(glViewport(0, 0, GLsizei(dim.width), GLsizei(dim.height)));
+  GLState::current().viewport(0, 0, GLsizei(dim.width), GLsizei(dim.height));
 }
 
 
@@ -229,15 +251,206 @@ void GLApp::triangulate(const Vec3& p0,
 }
 
 
+static void appendVertex(std::vector<float>& target,
+                         const std::vector<float>& source,
+                         size_t index, size_t valuesPerElement) {
+  target.insert(target.end(),
+                source.begin() + std::ptrdiff_t(index*valuesPerElement),
+                source.begin() + std::ptrdiff_t((index+1)*valuesPerElement));
+}
+
+GLint GLApp::streamVertices(const float data[], size_t elemCount,
+                            size_t valuesPerElement) {
+  const GLint first = simpleVb.append(data, elemCount, valuesPerElement);
+
+  // the vertex arrays only need to be set up again if the stream buffer
+  // had to be replaced, draws select their data via the first vertex
+  if (simpleVbGeneration != simpleVb.getGeneration()) {
+    simpleArray.connectVertexAttrib(simpleVb, simpleProg, "vPos", 3, 7);
+    simpleArray.connectVertexAttrib(simpleVb, simpleProg, "vColor", 4, 7, 3);
+    simpleTexArray.connectVertexAttrib(simpleVb, simpleTexProg, "vPos", 3, 5);
+    simpleTexArray.connectVertexAttrib(simpleVb, simpleTexProg, "vTexCoords", 2, 5, 3);
+    simpleLightArray.connectVertexAttrib(simpleVb, simpleLightProg, "vPos", 3, 10);
+    simpleLightArray.connectVertexAttrib(simpleVb, simpleLightProg, "vColor", 4, 10, 3);
+    simpleLightArray.connectVertexAttrib(simpleVb, simpleLightProg, "vNormal", 3, 10, 7);
+    simpleVbGeneration = simpleVb.getGeneration();
+  }
+  return first;
+}
+
+bool GLApp::DrawState::operator<(const DrawState& other) const {
+  return std::tie(layer, program, primitive, wireframe, blend, pointSize,
+                  transform, texture) <
+         std::tie(other.layer, other.program, other.primitive,
+                  other.wireframe, other.blend, other.pointSize,
+                  other.transform, other.texture);
+}
+
+GLApp::DrawState GLApp::currentDrawState(DrawProgram program,
+                                         GLenum primitive) {
+  if (drawTransformChanged) {
+    drawTransforms.push_back({p*mv, mv, mvi});
+    drawTransformChanged = false;
+  }
+  return {drawLayer, program, primitive, false, drawBlendMode, 1.0f,
+          drawTransforms.size()-1, nullptr};
+}
+
+std::vector<float>& GLApp::drawBatch(const DrawState& state) {
+  const auto known = drawBatchIndex.find(state);
+  if (known != drawBatchIndex.end()) return drawBatches[known->second].data;
+
+  if (drawBatchCount == drawBatches.size()) drawBatches.emplace_back();
+  DrawBatch& batch = drawBatches[drawBatchCount];
+  batch.state = state;
+  batch.data.clear();
+  drawBatchIndex[state] = drawBatchCount++;
+  return batch.data;
+}
+
+GLProgram& GLApp::drawProgram(DrawProgram program) {
+  switch (program) {
+    case DrawProgram::SPRITE :
+      return simpleSpriteProg;
+    case DrawProgram::HL_SPRITE :
+      return simpleHLSpriteProg;
+    case DrawProgram::TEXTURE :
+      return simpleTexProg;
+    case DrawProgram::LIGHT :
+      return simpleLightProg;
+    default :
+      return simpleProg;
+  }
+}
+
+const GLArray& GLApp::drawArray(DrawProgram program) const {
+  switch (program) {
+    case DrawProgram::TEXTURE :
+      return simpleTexArray;
+    case DrawProgram::LIGHT :
+      return simpleLightArray;
+    default :
+      return simpleArray;
+  }
+}
+
+size_t GLApp::vertexSize(DrawProgram program) {
+  switch (program) {
+    case DrawProgram::TEXTURE :
+      return 5;
+    case DrawProgram::LIGHT :
+      return 10;
+    default :
+      return 7;
+  }
+}
+
+void GLApp::flushDraws() {
+  if (drawBatchCount == 0) return;
+
+  GLState& glState = GLState::current();
+  const bool blendEnabled = glState.isEnabled(GL_BLEND);
+  bool wireframe = false;
+  const DrawState* last = nullptr;
+
+  // the index is ordered by state, so every batch is a single draw call
+  // and state changes between consecutive batches are minimal
+  for (const auto& entry : drawBatchIndex) {
+    const DrawBatch& batch = drawBatches[entry.second];
+    const DrawState& state = batch.state;
+    const size_t valuesPerElement = vertexSize(state.program);
+    const GLsizei count = GLsizei(batch.data.size()/valuesPerElement);
+    if (count == 0) continue;
+
+    const GLint first = streamVertices(batch.data.data(), batch.data.size(),
+                                       valuesPerElement);
+    GLProgram& program = drawProgram(state.program);
+
+    if (!last || last->program != state.program ||
+        last->transform != state.transform) {
+      const DrawTransform& transform = drawTransforms[state.transform];
+      program.enable();
+      program.setUniform("MVP", transform.mvp);
+      switch (state.program) {
+        case DrawProgram::LIGHT :
+          program.setUniform("MV", transform.mv);
+          program.setUniform("MVit", transform.mvi, true);
+          break;
+        case DrawProgram::HL_SPRITE :
+          program.setTexture("pointSprite", pointSprite, 0);
+          program.setTexture("pointSpriteHighlight", pointSpriteHighlight, 1);
+          break;
+        case DrawProgram::SPRITE :
+          program.setTexture("pointSprite", pointSprite, 0);
+          break;
+        default :
+          break;
+      }
+    }
+    if (state.texture && (!last || last->texture != state.texture ||
+                          last->program != state.program))
+      program.setTexture("raster", *state.texture, 0);
+
+    if (!last || last->blend != state.blend) {
+      switch (state.blend) {
+        case DrawBlendMode::KEEP :
+          glState.setEnabled(GL_BLEND, blendEnabled);
+          break;
+        case DrawBlendMode::NONE :
+          glState.disable(GL_BLEND);
+          break;
+        case DrawBlendMode::ALPHA :
+          glState.enable(GL_BLEND);
+          glState.blendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+          break;
+      }
+    }
+
+    if (state.primitive == GL_TRIANGLES && state.wireframe != wireframe) {
+      wireframe = state.wireframe;
+      glState.polygonMode(wireframe ? GL_LINE : GL_FILL);
+    }
+    if (state.primitive == GL_POINTS) glState.pointSize(state.pointSize);
+
+    drawArray(state.program).bind();
+    GL(glDrawArrays(state.primitive, first, count));
+    last = &state;
+  }
+
+  if (wireframe) glState.polygonMode(GL_FILL);
+  glState.setEnabled(GL_BLEND, blendEnabled);
+
+  drawBatchCount = 0;
+  drawBatchIndex.clear();
+  drawTransforms.clear();
+  drawTransformChanged = true;
+  rasterCount = 0;
+}
+
+void GLApp::setDrawLayer(uint32_t layer) {
+  drawLayer = layer;
+}
+
+uint32_t GLApp::getDrawLayer() const {
+  return drawLayer;
+}
+
+void GLApp::setDrawBlendMode(DrawBlendMode mode) {
+  drawBlendMode = mode;
+}
+
+DrawBlendMode GLApp::getDrawBlendMode() const {
+  return drawBlendMode;
+}
+
 void GLApp::drawLines(const std::vector<float>& data, LineDrawType t, float lineThickness) {
-  shaderUpdate();
-  
-  simpleProg.enable();
-  simpleArray.bind();
+  const size_t count = data.size()/7;
 
+  // strips and loops are recorded as lists so they can share a batch
   if (lineThickness > 1.0f) {
-    std::vector<float> trisData;
-    
+    std::vector<float>& trisData =
+      drawBatch(currentDrawState(DrawProgram::COLOR, GL_TRIANGLES));
+
     switch (t) {
       case LineDrawType::LIST :
         for (size_t i = 0;i<data.size()/7;i+=2) {
@@ -303,107 +516,79 @@ void GLApp::drawLines(const std::vector<float>& data, LineDrawType t, float line
         }
         break;
     }
-    
-    GL(glPolygonMode( GL_FRONT_AND_BACK, GL_FILL ));
-
-    simpleVb.setData(trisData,7,GL_DYNAMIC_DRAW);
-    simpleArray.connectVertexAttrib(simpleVb, simpleProg, "vPos", 3);
-    simpleArray.connectVertexAttrib(simpleVb, simpleProg, "vColor", 4, 3);
-
-    GL(glDrawArrays(GL_TRIANGLES, 0, GLsizei(trisData.size()/7)));
   } else {
-    simpleVb.setData(data,7,GL_DYNAMIC_DRAW);
-    simpleArray.connectVertexAttrib(simpleVb, simpleProg, "vPos", 3);
-    simpleArray.connectVertexAttrib(simpleVb, simpleProg, "vColor", 4, 3);
+    std::vector<float>& lineData =
+      drawBatch(currentDrawState(DrawProgram::COLOR, GL_LINES));
     switch (t) {
       case LineDrawType::LIST :
-        GL(glDrawArrays(GL_LINES, 0, GLsizei(data.size()/7)));
+        lineData.insert(lineData.end(), data.begin(),
+                        data.begin() + std::ptrdiff_t((count/2)*2*7));
         break;
       case LineDrawType::STRIP :
-        GL(glDrawArrays(GL_LINE_STRIP, 0, GLsizei(data.size()/7)));
-        break;
       case LineDrawType::LOOP :
-        GL(glDrawArrays(GL_LINE_LOOP, 0, GLsizei(data.size()/7)));
+        for (size_t i = 0;i+1<count;++i) {
+          appendVertex(lineData, data, i, 7);
+          appendVertex(lineData, data, i+1, 7);
+        }
+        if (t == LineDrawType::LOOP && count > 1) {
+          appendVertex(lineData, data, count-1, 7);
+          appendVertex(lineData, data, 0, 7);
+        }
         break;
     }
   }
 }
 
 void GLApp::drawPoints(const std::vector<float>& data, float pointSize, bool useTex) {
-  shaderUpdate();
-  
+  DrawProgram program = DrawProgram::COLOR;
   if (useTex) {
-    if (pointSpriteHighlight.getHeight() > 0) {
-      simpleHLSpriteProg.enable();
-      simpleHLSpriteProg.setTexture("pointSprite", pointSprite, 0);
-      simpleHLSpriteProg.setTexture("pointSpriteHighlight", pointSpriteHighlight, 1);
-      simpleVb.setData(data,7,GL_DYNAMIC_DRAW);
-      simpleArray.bind();
-      simpleArray.connectVertexAttrib(simpleVb, simpleHLSpriteProg, "vPos", 3);
-      simpleArray.connectVertexAttrib(simpleVb, simpleHLSpriteProg, "vColor", 4, 3);
-    } else {
-      simpleSpriteProg.enable();
-      simpleSpriteProg.setTexture("pointSprite", pointSprite, 0);
-      simpleVb.setData(data,7,GL_DYNAMIC_DRAW);
-      simpleArray.bind();
-      simpleArray.connectVertexAttrib(simpleVb, simpleSpriteProg, "vPos", 3);
-      simpleArray.connectVertexAttrib(simpleVb, simpleSpriteProg, "vColor", 4, 3);
-    }
-    
-  } else {
-    simpleProg.enable();
-    simpleVb.setData(data,7,GL_DYNAMIC_DRAW);
-    simpleArray.bind();
-    simpleArray.connectVertexAttrib(simpleVb, simpleProg, "vPos", 3);
-    simpleArray.connectVertexAttrib(simpleVb, simpleProg, "vColor", 4, 3);
+    program = (pointSpriteHighlight.getHeight() > 0) ? DrawProgram::HL_SPRITE
+                                                     : DrawProgram::SPRITE;
   }
 
-
-  GL(glPointSize(pointSize));
-  GL(glDrawArrays(GL_POINTS, 0, GLsizei(data.size()/7)));
+  DrawState state = currentDrawState(program, GL_POINTS);
+  state.pointSize = pointSize;
+  std::vector<float>& pointData = drawBatch(state);
+  pointData.insert(pointData.end(), data.begin(),
+                   data.begin() + std::ptrdiff_t((data.size()/7)*7));
 }
 
 void GLApp::redrawTriangles(bool wireframe) {
-  shaderUpdate();
+  const DrawProgram program = lastLighting ? DrawProgram::LIGHT
+                                           : DrawProgram::COLOR;
+  const size_t compCount = vertexSize(program);
+  const size_t count = size_t(lastTrisCount);
 
-  if (lastLighting) {
-    simpleLightProg.enable();
-    simpleArray.bind();
-    simpleArray.connectVertexAttrib(simpleVb, simpleLightProg, "vPos", 3);
-    simpleArray.connectVertexAttrib(simpleVb, simpleLightProg, "vColor", 4, 3);
-    simpleArray.connectVertexAttrib(simpleVb, simpleLightProg, "vNormal", 3, 7);
-  } else {
-    simpleProg.enable();
-    simpleArray.bind();
-    simpleArray.connectVertexAttrib(simpleVb, simpleProg, "vPos", 3);
-    simpleArray.connectVertexAttrib(simpleVb, simpleProg, "vColor", 4, 3);
-  }
-  
-  if (wireframe)
-    GL(glPolygonMode( GL_FRONT_AND_BACK, GL_LINE ));
-  else
-    GL(glPolygonMode( GL_FRONT_AND_BACK, GL_FILL ));
+  DrawState state = currentDrawState(program, GL_TRIANGLES);
+  state.wireframe = wireframe;
+  std::vector<float>& trisData = drawBatch(state);
 
+  // strips and fans are recorded as lists so they can share a batch
   switch (lastTrisType) {
     case TrisDrawType::LIST :
-      GL(glDrawArrays(GL_TRIANGLES, 0, lastTrisCount));
+      trisData.insert(trisData.end(), lastTrisData.begin(),
+                      lastTrisData.begin() + std::ptrdiff_t((count/3)*3*compCount));
       break;
     case TrisDrawType::STRIP :
-      GL(glDrawArrays(GL_TRIANGLE_STRIP, 0, lastTrisCount));
+      for (size_t i = 0;i+2<count;++i) {
+        appendVertex(trisData, lastTrisData, (i%2) ? i+1 : i, compCount);
+        appendVertex(trisData, lastTrisData, (i%2) ? i : i+1, compCount);
+        appendVertex(trisData, lastTrisData, i+2, compCount);
+      }
       break;
     case TrisDrawType::FAN :
-      GL(glDrawArrays(GL_TRIANGLE_FAN, 0, lastTrisCount));
+      for (size_t i = 1;i+1<count;++i) {
+        appendVertex(trisData, lastTrisData, 0, compCount);
+        appendVertex(trisData, lastTrisData, i, compCount);
+        appendVertex(trisData, lastTrisData, i+1, compCount);
+      }
       break;
   }
 }
 
-
 void GLApp::drawTriangles(const std::vector<float>& data, TrisDrawType t, bool wireframe, bool lighting) {
-  shaderUpdate();
-  
   size_t compCount = lighting ? 10 : 7;
-  simpleVb.setData(data,compCount,GL_DYNAMIC_DRAW);
-
+  lastTrisData = data;
   lastLighting = lighting;
   lastTrisType = t;
   lastTrisCount = GLsizei(data.size()/compCount);
@@ -413,6 +598,7 @@ void GLApp::drawTriangles(const std::vector<float>& data, TrisDrawType t, bool w
 
 void GLApp::setDrawProjection(const Mat4& mat) {
   p = mat;
+  drawTransformChanged = true;
 }
 
 Mat4 GLApp::getDrawProjection() const {
@@ -426,6 +612,7 @@ Mat4 GLApp::getDrawTransform() const {
 void GLApp::setDrawTransform(const Mat4& mat) {
   mv = mat;
   mvi = Mat4::inverse(mv);
+  drawTransformChanged = true;
 }
 
 void GLApp::shaderUpdate() {
@@ -448,7 +635,9 @@ void GLApp::shaderUpdate() {
 }
 
 void GLApp::setImageFilter(GLint magFilter, GLint minFilter) {
-  raster.setFilter(magFilter, minFilter);
+  rasterMagFilter = magFilter;
+  rasterMinFilter = minFilter;
+  for (const auto& raster : rasters) raster->setFilter(magFilter, minFilter);
 }
 
 void GLApp::drawImage(const GLTexture2D& image, const Vec2& bl, const Vec2& tr) {
@@ -471,12 +660,7 @@ void GLApp::drawImage(const Image& image, const Vec2& bl, const Vec2& tr) {
 void GLApp::drawImage(const GLTexture2D& image, const Vec3& bl,
                       const Vec3& br, const Vec3& tl,
                       const Vec3& tr) {
-
-  shaderUpdate();
-  
-  simpleTexProg.enable();
-  
-  std::vector<float> data = {
+  const float data[] = {
     tr[0], tr[1], tr[2], 1.0f, 1.0f,
     br[0], br[1], br[2], 1.0f, 0.0f,
     tl[0], tl[1], tl[2], 0.0f, 1.0f,
@@ -484,21 +668,24 @@ void GLApp::drawImage(const GLTexture2D& image, const Vec3& bl,
     bl[0], bl[1], bl[2], 0.0f, 0.0f,
     br[0], br[1], br[2], 1.0f, 0.0f
   };
-  
-  simpleVb.setData(data,5,GL_DYNAMIC_DRAW);
-  
-  simpleArray.bind();
-  simpleArray.connectVertexAttrib(simpleVb, simpleTexProg, "vPos", 3);
-  simpleArray.connectVertexAttrib(simpleVb, simpleTexProg, "vTexCoords", 2, 3);
-  simpleTexProg.setTexture("raster",image,0);
 
-  GL(glDrawArrays(GL_TRIANGLES, 0, GLsizei(data.size()/5)));
+  DrawState state = currentDrawState(DrawProgram::TEXTURE, GL_TRIANGLES);
+  state.texture = &image;
+  std::vector<float>& trisData = drawBatch(state);
+  trisData.insert(trisData.end(), std::begin(data), std::end(data));
 }
 
 void GLApp::drawImage(const Image& image, const Vec3& bl,
                       const Vec3& br, const Vec3& tl,
                       const Vec3& tr) {
-
+  // every image needs its own texture until the batches are flushed
+  if (rasterCount == rasters.size()) {
+    rasters.push_back(std::make_unique<GLTexture2D>(rasterMagFilter,
+                                                    rasterMinFilter,
+                                                    GL_CLAMP_TO_EDGE,
+                                                    GL_CLAMP_TO_EDGE));
+  }
+  GLTexture2D& raster = *rasters[rasterCount++];
   raster.setData(image.data, image.width, image.height, image.componentCount);
   drawImage(raster, bl, br, tl, tr);
 }
@@ -513,7 +700,18 @@ void GLApp::drawRect(const Vec4& color, const Vec2& bl, const Vec2& tr) {
 
 void GLApp::drawRect(const Vec4& color, const Vec3& bl, const Vec3& br,
                      const Vec3& tl, const Vec3& tr) {
-  drawImage(Image{color}, bl, br, tl, tr);
+  const float data[] = {
+    tr[0], tr[1], tr[2], color[0], color[1], color[2], color[3],
+    br[0], br[1], br[2], color[0], color[1], color[2], color[3],
+    tl[0], tl[1], tl[2], color[0], color[1], color[2], color[3],
+    tl[0], tl[1], tl[2], color[0], color[1], color[2], color[3],
+    bl[0], bl[1], bl[2], color[0], color[1], color[2], color[3],
+    br[0], br[1], br[2], color[0], color[1], color[2], color[3]
+  };
+
+  std::vector<float>& trisData =
+    drawBatch(currentDrawState(DrawProgram::COLOR, GL_TRIANGLES));
+  trisData.insert(trisData.end(), std::begin(data), std::end(data));
 }
 
 Mat4 GLApp::computeImageTransform(const Vec2ui& imageSize) const {
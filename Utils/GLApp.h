@@ -1,11 +1,15 @@
 #pragma once
 
 #include <string>
+#include <vector>
+#include <map>
+#include <memory>
 
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
 
 #include "GLEnv.h"
+#include "GLState.h"
 #include "GLProgram.h"
 #include "GLArray.h"
 #include "GLBuffer.h"
@@ -24,6 +28,12 @@ enum class TrisDrawType {
   FAN
 };
 
+enum class DrawBlendMode {
+  KEEP,   // leave the blend state set by the application
+  NONE,
+  ALPHA
+};
+
 class GLApp {
 public:
   GLApp(uint32_t w=640, uint32_t h=480, uint32_t s=4,
@@ -90,6 +100,16 @@ public:
   void drawPoints(const std::vector<float>& data, float pointSize=1.0f, bool useTex=false);
   void setDrawProjection(const Mat4& mat);
   void setDrawTransform(const Mat4& mat);
+
+  // the draw calls above are recorded and merged into as few GL draws as
+  // possible when the frame ends or flushDraws is called, textures passed
+  // to drawImage have to stay alive until then. Primitives of different
+  // state within one layer may be reordered, lower layers are drawn first.
+  void flushDraws();
+  void setDrawLayer(uint32_t layer);
+  uint32_t getDrawLayer() const;
+  void setDrawBlendMode(DrawBlendMode mode);
+  DrawBlendMode getDrawBlendMode() const;
   
   Mat4 getDrawProjection() const;
   Mat4 getDrawTransform() const;
@@ -122,9 +142,10 @@ protected:
   GLProgram simpleHLSpriteProg;
   GLProgram simpleTexProg;
   GLProgram simpleLightProg;
-  GLArray simpleArray;
-  GLBuffer simpleVb;
-  GLTexture2D raster;
+  GLArray simpleArray;       // position and color
+  GLArray simpleTexArray;    // position and texture coordinates
+  GLArray simpleLightArray;  // position, color and normal
+  GLStreamBuffer simpleVb;
   GLTexture2D pointSprite;
   GLTexture2D pointSpriteHighlight;
   double resumeTime;
@@ -140,6 +161,63 @@ private:
   TrisDrawType lastTrisType;
   GLsizei lastTrisCount;
   bool lastLighting;
+  std::vector<float> lastTrisData;
+  uint64_t simpleVbGeneration;
+
+  enum class DrawProgram : uint8_t {
+    COLOR,
+    SPRITE,
+    HL_SPRITE,
+    TEXTURE,
+    LIGHT
+  };
+
+  struct DrawState {
+    uint32_t layer;
+    DrawProgram program;
+    GLenum primitive;           // GL_POINTS, GL_LINES or GL_TRIANGLES
+    bool wireframe;
+    DrawBlendMode blend;
+    float pointSize;
+    size_t transform;           // index into drawTransforms
+    const GLTexture2D* texture;
+
+    bool operator<(const DrawState& other) const;
+  };
+
+  struct DrawTransform {
+    Mat4 mvp;
+    Mat4 mv;
+    Mat4 mvi;
+  };
+
+  struct DrawBatch {
+    DrawState state;
+    std::vector<float> data;
+  };
+
+  uint32_t drawLayer;
+  DrawBlendMode drawBlendMode;
+  bool drawTransformChanged;
+  std::vector<DrawTransform> drawTransforms;
+  // batches are recycled across frames to keep their allocations
+  std::vector<DrawBatch> drawBatches;
+  size_t drawBatchCount;
+  std::map<DrawState, size_t> drawBatchIndex;
+  // textures for drawImage(const Image&), one per call and frame
+  std::vector<std::unique_ptr<GLTexture2D>> rasters;
+  size_t rasterCount;
+  GLint rasterMagFilter;
+  GLint rasterMinFilter;
+
+  DrawState currentDrawState(DrawProgram program, GLenum primitive);
+  std::vector<float>& drawBatch(const DrawState& state);
+  GLProgram& drawProgram(DrawProgram program);
+  const GLArray& drawArray(DrawProgram program) const;
+  static size_t vertexSize(DrawProgram program);
+
+  GLint streamVertices(const float data[], size_t elemCount,
+                       size_t valuesPerElement);
 
   static GLApp* staticAppPtr;
   static void sizeCallback(GLFWwindow* window, int width, int height) {
@@ -1,16 +1,18 @@
 #include "GLArray.h"
+#include "GLState.h"
 
 GLArray::GLArray() {
 	GL(glGenVertexArrays(1, &glId));
-	GL(glBindVertexArray(glId));
+	bind();
 }
 
 GLArray::~GLArray() {
 	GL(glDeleteVertexArrays(1, &glId));
+	GLState::current().vertexArrayDeleted(glId);
 }
 
 void GLArray::bind() const {
-	GL(glBindVertexArray(glId));
+	GLState::current().bindVertexArray(glId);
 }
 
 void GLArray::connectVertexAttrib(const GLBuffer& buffer,
@@ -24,6 +26,17 @@ void GLArray::connectVertexAttrib(const GLBuffer& buffer,
 	buffer.connectVertexAttrib(GLuint(location), elemCount, offset, divisor);
 }
 
+void GLArray::connectVertexAttrib(const GLStreamBuffer& buffer,
+                                  const GLProgram& program,
+                                  const std::string& variable,
+                                  size_t elemCount, size_t valuesPerElement,
+                                  size_t offset) const {
+	bind();
+	const GLint location = program.getAttributeLocation(variable.c_str());
+	buffer.connectVertexAttrib(GLuint(location), elemCount, valuesPerElement,
+                             offset);
+}
+
 void GLArray::connectIndexBuffer(const GLBuffer& buffer) const {
 	bind();
 	buffer.bind();	
@@ -1,7 +1,10 @@
 #include <sstream>
+#include <cstring>
+#include <algorithm>
 
 #include "GLBuffer.h"
 #include "GLEnv.h"
+#include "GLState.h"
 
 
 GLBuffer::GLBuffer(GLenum target) :
@@ -15,15 +18,15 @@ GLBuffer::GLBuffer(GLenum target) :
 }
 
 GLBuffer::~GLBuffer()  {
-	GL(glBindBuffer(target, 0));
 	GL(glDeleteBuffers(1, &bufferID));
+	GLState::current().bufferDeleted(bufferID);
 }
 
 void GLBuffer::setData(const std::vector<float>& data, size_t valuesPerElement, GLenum usage) {
 	elemSize = sizeof(data[0]);
 	stride = valuesPerElement*elemSize;
 	type = GL_FLOAT;
-	GL(glBindBuffer(target, bufferID));
+	GLState::current().bindBuffer(target, bufferID);
 	GL(glBufferData(target, GLsizeiptr(elemSize*data.size()), data.data(), usage));
 }
 
@@ -31,7 +34,16 @@ void GLBuffer::setData(const std::vector<GLuint>& data) {
 	elemSize = sizeof(data[0]);
 	stride = 1*elemSize;
 	type = GL_UNSIGNED_INT;
-	GL(glBindBuffer(target, bufferID));
+	GLState::current().bindBuffer(target, bufferID);
+	GL(glBufferData(target, GLsizeiptr(elemSize*data.size()), data.data(),
+                  GL_STATIC_DRAW));
+}
+
+void GLBuffer::setData(const std::vector<GLushort>& data) {
+	elemSize = sizeof(data[0]);
+	stride = 1*elemSize;
+	type = GL_UNSIGNED_SHORT;
+	GLState::current().bindBuffer(target, bufferID);
 	GL(glBufferData(target, GLsizeiptr(elemSize*data.size()), data.data(),
                   GL_STATIC_DRAW));
 }
@@ -41,7 +53,7 @@ void GLBuffer::setData(const float data[], size_t elemCount,
   elemSize = sizeof(data[0]);
   stride = valuesPerElement*elemSize;
   type = GL_FLOAT;
-  GL(glBindBuffer(target, bufferID));
+  GLState::current().bindBuffer(target, bufferID);
   GL(glBufferData(target, GLsizeiptr(elemSize*elemCount), data, usage));
 }
 
@@ -49,7 +61,7 @@ void GLBuffer::setData(const GLuint data[], size_t elemCount) {
   elemSize = sizeof(data[0]);
   stride = 1*elemSize;
   type = GL_UNSIGNED_INT;
-  GL(glBindBuffer(target, bufferID));
+  GLState::current().bindBuffer(target, bufferID);
   GL(glBufferData(target, GLsizeiptr(elemSize*elemCount), data, GL_STATIC_DRAW));
 }
 
@@ -60,13 +72,194 @@ void GLBuffer::connectVertexAttrib(GLuint location, size_t elemCount,
         throw GLException{"Need to call setData before connectVertexAttrib"};
     }
     
-	GL(glBindBuffer(target, bufferID));
+	GLState::current().bindBuffer(target, bufferID);
 	GL(glEnableVertexAttribArray(location));
 	GL(glVertexAttribPointer(location, GLsizei(elemCount), type, GL_FALSE, GLsizei(stride), (void*)(offset*elemSize)));
   if (divisor != 0) GL(glVertexAttribDivisor(location, divisor));
 }
 
 void GLBuffer::bind() const {
-	GL(glBindBuffer(target, bufferID));
+	GLState::current().bindBuffer(target, bufferID);
+}
+
+void GLBuffer::bindBase(GLenum indexedTarget, GLuint index) const {
+  GLState::current().bindBufferBase(indexedTarget, index, bufferID);
+}
+
+
+GLStreamBuffer::GLStreamBuffer(GLenum target, size_t regionSize,
+                               size_t regionCount) :
+  target(target),
+  bufferID(0),
+  persistent(GLEW_ARB_buffer_storage),
+  regionSize(regionSize),
+  regionCount(std::max<size_t>(1, regionCount)),
+  mapping(nullptr),
+  mappedRange(false),
+  region(0),
+  head(0),
+  frame(0),
+  generation(0),
+  fences(this->regionCount, nullptr)
+{
+  allocate();
+}
+
+GLStreamBuffer::~GLStreamBuffer() {
+  release();
+}
+
+void GLStreamBuffer::allocate() {
+  const size_t capacity = regionSize*regionCount;
+  GL(glGenBuffers(1, &bufferID));
+  GLState::current().bindBuffer(target, bufferID);
+  if (persistent) {
+    const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT |
+                             GL_MAP_COHERENT_BIT;
+    GL(glBufferStorage(target, GLsizeiptr(capacity), nullptr, flags));
+    GL(mapping = static_cast<uint8_t*>(glMapBufferRange(target, 0,
+                                                        GLsizeiptr(capacity),
+                                                        flags)));
+    if (!mapping) throw GLException{"Unable to map stream buffer"};
+  } else {
+    GL(glBufferData(target, GLsizeiptr(capacity), nullptr, GL_STREAM_DRAW));
+  }
+  region = 0;
+  head = 0;
+  ++generation;
+}
+
+void GLStreamBuffer::release() {
+  for (GLsync& fence : fences) {
+    if (fence) GL(glDeleteSync(fence));
+    fence = nullptr;
+  }
+  GLState::current().bindBuffer(target, bufferID);
+  if (mapping) GL(glUnmapBuffer(target));
+  mapping = nullptr;
+  GL(glDeleteBuffers(1, &bufferID));
+  GLState::current().bufferDeleted(bufferID);
+}
+
+void GLStreamBuffer::grow(size_t bytes) {
+  // commands already issued keep the old storage alive
+  release();
+  const size_t granularity = size_t(1) << 16;
+  regionSize = (bytes + granularity - 1) / granularity * granularity;
+  allocate();
+}
+
+GLint GLStreamBuffer::append(const std::vector<GLfloat>& data,
+                             size_t valuesPerElement) {
+  return append(data.data(), data.size(), valuesPerElement);
 }
 
+size_t GLStreamBuffer::reserve(size_t bytes, size_t stride) {
+  // data starts at a multiple of the stride so that it can be addressed
+  // by the first vertex index without reconnecting the attributes
+  size_t offset = ((head + stride - 1) / stride) * stride;
+
+  if (persistent) {
+    if (offset + bytes > (region+1)*regionSize) {
+      // a request larger than a region gets regions of its size, smaller
+      // ones overflowing the region double it so that a frame of many small
+      // appends does not reallocate every frame
+      grow(bytes + stride > regionSize ? bytes + stride : 2*regionSize);
+      offset = 0;
+    }
+  } else {
+    if (offset + bytes > regionSize*regionCount) {
+      if (bytes + stride > regionSize*regionCount) {
+        grow((bytes + stride + regionCount - 1) / regionCount);
+      } else {
+        GLState::current().bindBuffer(target, bufferID);
+        GL(glBufferData(target, GLsizeiptr(regionSize*regionCount), nullptr,
+                        GL_STREAM_DRAW));
+        ++generation;
+      }
+      offset = 0;
+    }
+  }
+
+  head = offset + bytes;
+  return offset;
+}
+
+GLint GLStreamBuffer::append(const float data[], size_t elemCount,
+                             size_t valuesPerElement) {
+  const size_t stride = valuesPerElement*sizeof(float);
+  const size_t bytes = elemCount*sizeof(float);
+  const size_t offset = reserve(bytes, stride);
+
+  if (persistent) {
+    std::memcpy(mapping + offset, data, bytes);
+  } else {
+    GLState::current().bindBuffer(target, bufferID);
+    GL(glBufferSubData(target, GLintptr(offset), GLsizeiptr(bytes), data));
+  }
+  return GLint(offset / stride);
+}
+
+float* GLStreamBuffer::map(size_t elemCount, size_t valuesPerElement,
+                           GLint& first) {
+  const size_t stride = valuesPerElement*sizeof(float);
+  const size_t bytes = elemCount*sizeof(float);
+  const size_t offset = reserve(bytes, stride);
+  first = GLint(offset / stride);
+
+  if (persistent) return reinterpret_cast<float*>(mapping + offset);
+
+  // the range has not been used since the buffer was last orphaned, so no
+  // synchronization with the GPU is needed
+  if (bytes == 0) return nullptr;
+  GLState::current().bindBuffer(target, bufferID);
+  void* range;
+  GL(range = glMapBufferRange(target, GLintptr(offset), GLsizeiptr(bytes),
+                              GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT |
+                              GL_MAP_UNSYNCHRONIZED_BIT));
+  if (!range) throw GLException{"Unable to map stream buffer range"};
+  mappedRange = true;
+  return static_cast<float*>(range);
+}
+
+void GLStreamBuffer::unmap() {
+  if (!mappedRange) return;
+  GLState::current().bindBuffer(target, bufferID);
+  GL(glUnmapBuffer(target));
+  mappedRange = false;
+}
+
+void GLStreamBuffer::nextFrame() {
+  ++frame;
+  if (!persistent) return;
+
+  GL(fences[region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+  region = (region + 1) % regionCount;
+  head = region*regionSize;
+
+  // wait until the GPU is done with the frame that last used this region
+  GLsync& fence = fences[region];
+  if (!fence) return;
+  GLenum result;
+  do {
+    result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+  } while (result == GL_TIMEOUT_EXPIRED);
+  GL(glDeleteSync(fence));
+  fence = nullptr;
+  if (result == GL_WAIT_FAILED)
+    throw GLException{"Waiting for stream buffer fence failed"};
+}
+
+void GLStreamBuffer::connectVertexAttrib(GLuint location, size_t elemCount,
+                                         size_t valuesPerElement,
+                                         size_t offset) const {
+  GLState::current().bindBuffer(target, bufferID);
+  GL(glEnableVertexAttribArray(location));
+  GL(glVertexAttribPointer(location, GLsizei(elemCount), GL_FLOAT, GL_FALSE,
+                           GLsizei(valuesPerElement*sizeof(float)),
+                           (void*)(offset*sizeof(float))));
+}
+
+void GLStreamBuffer::bind() const {
+  GLState::current().bindBuffer(target, bufferID);
+}
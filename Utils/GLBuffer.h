@@ -1,6 +1,7 @@
 #pragma once
 
 #include <vector>
+#include <cstdint>
 
 #include <GL/glew.h>  
 #include <GLFW/glfw3.h>
@@ -11,6 +12,7 @@ public:
 	~GLBuffer();
 	void setData(const std::vector<GLfloat>& data, size_t valuesPerElement,GLenum usage=GL_STATIC_DRAW);
 	void setData(const std::vector<GLuint>& data);
+	void setData(const std::vector<GLushort>& data);
 
   void setData(const float data[], size_t elemCount,
                size_t valuesPerElement,GLenum usage=GL_STATIC_DRAW);
@@ -19,6 +21,8 @@ public:
 	void connectVertexAttrib(GLuint location, size_t elemCount,
                            size_t offset=0, GLuint divisor = 0) const;
 	void bind() const;
+  // binds the buffer to an indexed target such as GL_TRANSFORM_FEEDBACK_BUFFER
+  void bindBase(GLenum indexedTarget, GLuint index) const;
   
 private:
 	GLenum target;
@@ -27,3 +31,62 @@ private:
 	size_t stride;
 	GLenum type;
 };
+
+// Streaming storage for vertex data that is rewritten every frame. With
+// ARB_buffer_storage the buffer is persistently mapped and split into
+// regionCount regions, one per frame in flight, each guarded by a fence so
+// appending is a plain memcpy. Without it data is appended with
+// glBufferSubData and the buffer is orphaned once it is full.
+class GLStreamBuffer {
+public:
+  GLStreamBuffer(GLenum target=GL_ARRAY_BUFFER,
+                 size_t regionSize=size_t(1) << 20, size_t regionCount=3);
+  ~GLStreamBuffer();
+
+  GLStreamBuffer(const GLStreamBuffer&) = delete;
+  GLStreamBuffer& operator=(const GLStreamBuffer&) = delete;
+
+  // copies elemCount floats into the buffer and returns the index of the
+  // first vertex for glDrawArrays, attributes have to be connected with a
+  // stride of valuesPerElement floats
+  GLint append(const float data[], size_t elemCount, size_t valuesPerElement);
+  GLint append(const std::vector<GLfloat>& data, size_t valuesPerElement);
+
+  // reserves elemCount floats and returns where to write them so data can be
+  // produced in place, first receives the index of the first vertex, the
+  // pointer stays valid until unmap which has to be called before drawing
+  float* map(size_t elemCount, size_t valuesPerElement, GLint& first);
+  void unmap();
+
+  // to be called once all draw calls of a frame have been issued
+  void nextFrame();
+
+  void connectVertexAttrib(GLuint location, size_t elemCount,
+                           size_t valuesPerElement, size_t offset=0) const;
+  void bind() const;
+
+  bool isPersistent() const {return persistent;}
+  uint64_t getFrame() const {return frame;}
+  // changes whenever previously appended data becomes invalid or the buffer
+  // object is replaced, vertex arrays then need to be reconnected
+  uint64_t getGeneration() const {return generation;}
+
+private:
+  GLenum target;
+  GLuint bufferID;
+  bool persistent;
+  size_t regionSize;
+  size_t regionCount;
+  uint8_t* mapping;
+  bool mappedRange;
+  size_t region;
+  size_t head;
+  uint64_t frame;
+  uint64_t generation;
+  std::vector<GLsync> fences;
+
+  void allocate();
+  void release();
+  void grow(size_t bytes);
+  size_t reserve(size_t bytes, size_t stride);
+};
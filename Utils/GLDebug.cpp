@@ -1,5 +1,10 @@
 #include <sstream>
 #include <vector>
+#include <mutex>
+#include <cstring>
+#include <cstdlib>
+#include <algorithm>
+#include <iterator>
 
 #include "GLEnv.h"
 #include "GLDebug.h"
@@ -16,10 +21,198 @@ std::string errorString(GLenum glerr) {
   }
 }
 
-void errorOut(const std::string& statement, const std::string& location,
-              uint32_t line, const std::string& file, uint32_t errnum) {
-  std::cerr << "GL error calling " << statement << " " << location <<  " " << line
-            << " (" << file << "):" <<  errorString(errnum) << " (" << errnum << ")" << std::endl;
+namespace {
+  void errorOut(const std::string& statement, const std::string& location,
+                uint32_t line, const std::string& file, uint32_t errnum) {
+    std::cerr << "GL error calling " << statement << " " << location <<  " " << line
+              << " (" << file << "):" <<  errorString(errnum) << " (" << errnum << ")" << std::endl;
+  }
+
+  // under some circumstances the glError loop below does not terminate,
+  // either glError itself causes an error or does not reset the error
+  // state. Neither should happen, but still do
+  constexpr uint32_t maxErrorCount = 10;
+  constexpr size_t debugMessageSlot = 8;
+
+#ifdef NDEBUG
+  constexpr GLValidation::Mode defaultMode = GLValidation::Mode::OFF;
+#else
+  constexpr GLValidation::Mode defaultMode = GLValidation::Mode::FULL;
+#endif
+
+  GLValidation::Mode mode = defaultMode;
+  uint32_t interval = 1;
+  uint64_t frame = 0;
+  GLCallSite* sites = nullptr;
+  // the debug callback may run on a driver thread
+  std::mutex sitesMutex;
+
+  // messages before the first call through the GL macro
+  GLCallSite unknownSite{"an unwrapped call", "unknown", 0, {}, nullptr};
+
+  size_t errorSlot(GLenum error) {
+    switch (error) {
+      case GL_INVALID_ENUM : return 0;
+      case GL_INVALID_VALUE : return 1;
+      case GL_INVALID_OPERATION : return 2;
+      case GL_STACK_OVERFLOW : return 3;
+      case GL_STACK_UNDERFLOW : return 4;
+      case GL_OUT_OF_MEMORY : return 5;
+      case GL_INVALID_FRAMEBUFFER_OPERATION : return 6;
+      default : return 7;
+    }
+  }
+
+  const char* slotName(size_t slot) {
+    switch (slot) {
+      case 0 : return "GL_INVALID_ENUM";
+      case 1 : return "GL_INVALID_VALUE";
+      case 2 : return "GL_INVALID_OPERATION";
+      case 3 : return "GL_STACK_OVERFLOW";
+      case 4 : return "GL_STACK_UNDERFLOW";
+      case 5 : return "GL_OUT_OF_MEMORY";
+      case 6 : return "GL_INVALID_FRAMEBUFFER_OPERATION";
+      case 7 : return "other";
+      default : return "debug message";
+    }
+  }
+
+  uint64_t siteErrors(const GLCallSite& site) {
+    uint64_t total = 0;
+    for (uint64_t count : site.errors) total += count;
+    return total;
+  }
+
+  // returns true for the first error of its kind at site
+  bool record(GLCallSite& site, size_t slot) {
+    std::lock_guard<std::mutex> lock(sitesMutex);
+    if (siteErrors(site) == 0) {
+      site.next = sites;
+      sites = &site;
+    }
+    return site.errors[slot]++ == 0;
+  }
+
+  void GLAPIENTRY debugCallback(GLenum, GLenum, GLuint, GLenum severity,
+                                GLsizei, const GLchar* message, const void*) {
+    if (severity == GL_DEBUG_SEVERITY_NOTIFICATION) return;
+    // the last call through the GL macro, which is the call causing the
+    // message unless the driver reports from another thread
+    GLCallSite& site = GLValidation::lastSite ?
+      const_cast<GLCallSite&>(*GLValidation::lastSite) : unknownSite;
+    if (record(site, debugMessageSlot)) {
+      std::cerr << "GL debug message after " << site.statement << " " << site.line
+                << " (" << site.file << "): " << message << std::endl;
+    }
+  }
+
+  void updateChecking() {
+    GLValidation::checking = mode == GLValidation::Mode::FULL ||
+      (mode == GLValidation::Mode::SAMPLED && frame % interval == 0);
+  }
+}
+
+namespace GLValidation {
+  bool checking = defaultMode == Mode::FULL;
+  const GLCallSite* lastSite = nullptr;
+
+  Mode environmentMode() {
+    const char* value = std::getenv("GL_VALIDATION");
+    if (!value) return defaultMode;
+    const std::string name{value};
+    if (name == "off") return Mode::OFF;
+    if (name == "callback") return Mode::DEBUG_OUTPUT;
+    if (name.compare(0, 7, "sampled") == 0) return Mode::SAMPLED;
+    if (name == "full") return Mode::FULL;
+    std::cerr << "Unknown GL_VALIDATION mode " << name << std::endl;
+    return defaultMode;
+  }
+
+  uint32_t environmentInterval() {
+    const char* value = std::getenv("GL_VALIDATION");
+    const char* colon = value ? std::strchr(value, ':') : nullptr;
+    if (!colon) return 60;
+    const long n = std::strtol(colon+1, nullptr, 10);
+    return n > 0 ? uint32_t(n) : 60;
+  }
+
+  void setMode(Mode newMode, uint32_t newInterval) {
+    if (newMode == Mode::DEBUG_OUTPUT && !GLEW_KHR_debug) {
+      std::cerr << "KHR_debug is not available, GL validation falls back to "
+                << (defaultMode == Mode::FULL ? "full" : "off") << std::endl;
+      newMode = defaultMode;
+    }
+    if (GLEW_KHR_debug) {
+      if (newMode == Mode::DEBUG_OUTPUT) {
+        glEnable(GL_DEBUG_OUTPUT);
+        glDebugMessageCallback(debugCallback, nullptr);
+      } else if (mode == Mode::DEBUG_OUTPUT) {
+        glDebugMessageCallback(nullptr, nullptr);
+        glDisable(GL_DEBUG_OUTPUT);
+      }
+    }
+    mode = newMode;
+    interval = std::max<uint32_t>(1, newInterval);
+    updateChecking();
+  }
+
+  Mode getMode() {
+    return mode;
+  }
+
+  void nextFrame() {
+    if (mode != Mode::SAMPLED) return;
+    ++frame;
+    updateChecking();
+  }
+
+  void check(GLCallSite& site, const char* location) {
+    lastSite = &site;
+    GLenum glerr;
+    uint32_t counter = 0;
+    while ((glerr = glGetError()) != GL_NO_ERROR) {
+      if (record(site, errorSlot(glerr)))
+        errorOut(site.statement, location, site.line, site.file, glerr);
+      if (++counter > maxErrorCount) break;
+    }
+  }
+
+  uint64_t getErrorCount() {
+    std::lock_guard<std::mutex> lock(sitesMutex);
+    uint64_t total = 0;
+    for (const GLCallSite* site = sites;site;site = site->next)
+      total += siteErrors(*site);
+    return total;
+  }
+
+  void report(std::ostream& out) {
+    std::lock_guard<std::mutex> lock(sitesMutex);
+    std::vector<const GLCallSite*> sorted;
+    for (const GLCallSite* site = sites;site;site = site->next)
+      sorted.push_back(site);
+    std::stable_sort(sorted.begin(), sorted.end(),
+                     [](const GLCallSite* a, const GLCallSite* b) {
+                       return siteErrors(*a) > siteErrors(*b);
+                     });
+    for (const GLCallSite* site : sorted) {
+      out << site->file << ":" << site->line << " " << site->statement << ":";
+      for (size_t slot = 0;slot<std::size(site->errors);++slot) {
+        if (site->errors[slot])
+          out << " " << site->errors[slot] << "x " << slotName(slot);
+      }
+      out << "\n";
+    }
+  }
+
+  void reset() {
+    std::lock_guard<std::mutex> lock(sitesMutex);
+    while (sites) {
+      GLCallSite* site = sites;
+      sites = site->next;
+      std::fill(std::begin(site->errors), std::end(site->errors), 0);
+      site->next = nullptr;
+    }
+  }
 }
 
 void checkAndThrow() {
@@ -2,6 +2,8 @@
 
 #include <iostream>
 #include <exception>
+#include <string>
+#include <cstdint>
 
 class GLException : public std::exception {
 public:
@@ -23,34 +25,65 @@ struct Dimensions {
 
 std::string errorString(GLenum glerr);
 
-#ifndef NDEBUG
+// a place in the code calling GL through the GL macro, errors are counted
+// per site and per error
+struct GLCallSite {
+  const char* statement;
+  const char* file;
+  uint32_t line;
+  uint64_t errors[9];     // the GL error codes in order, unknown codes, then
+                          // debug messages
+  GLCallSite* next;       // next site with errors
+};
+
+// Runtime selectable validation of GL calls. The environment variable
+// GL_VALIDATION picks the mode when GLEnv creates the context:
+//   off          no checks
+//   callback     GL reports errors to a KHR_debug callback, nothing waits
+//   sampled[:N]  glGetError around every call but only in every Nth frame
+//   full         glGetError around every call
+// Debug builds default to full, release builds compile the GL macro to the
+// bare statement, there only off and callback have an effect.
+namespace GLValidation {
+  enum class Mode {OFF, DEBUG_OUTPUT, SAMPLED, FULL};
+
+  // mode and interval requested by GL_VALIDATION, the build default if unset
+  Mode environmentMode();
+  uint32_t environmentInterval();
 
-// under some circumstances the glError loops below do not
-// terminate, either glError itself causes an erro or does
-// not reset the error state. Neither should happen, but
-// still do
-#define MAX_GL_ERROR_COUNT 10
+  // DEBUG_OUTPUT needs a current context and falls back to the build
+  // default without KHR_debug
+  void setMode(Mode mode, uint32_t interval=60);
+  Mode getMode();
+  // advances the frame counter of the sampled mode, called by GLEnv
+  void nextFrame();
 
-void errorOut(const std::string& statement, const std::string& location,
-              uint32_t line, const std::string& file, uint32_t errnum);
+  // errors of all call sites
+  uint64_t getErrorCount();
+  // call sites with errors, most errors first
+  void report(std::ostream& out);
+  void reset();
 
+  // used by the GL macro
+  extern bool checking;
+  extern const GLCallSite* lastSite;
+  void check(GLCallSite& site, const char* location);
+}
+
+#ifndef NDEBUG
+
+// the site is constant initialized, so it costs nothing until it records
+// an error, unchecked calls only remember the site for the debug callback
 # define GL(stmt)                                                      \
   do {                                                                 \
-    GLenum glerr;                                                      \
-    uint32_t counter = 0;                                              \
-    while((glerr = glGetError()) != GL_NO_ERROR) {                     \
-      errorOut(#stmt, "before", __LINE__, __FILE__,                    \
-              static_cast<uint32_t>(glerr));                           \
-      counter++;                                                       \
-      if (counter > MAX_GL_ERROR_COUNT) break;                         \
-    }                                                                  \
-    stmt;                                                              \
-    counter = 0;                                                       \
-    while((glerr = glGetError()) != GL_NO_ERROR) {                     \
-      errorOut(#stmt, "in", __LINE__, __FILE__,                        \
-              static_cast<uint32_t>(glerr));                           \
-      counter++;                                                       \
-      if (counter > MAX_GL_ERROR_COUNT) break;                         \
+    static GLCallSite glSite{#stmt, __FILE__, __LINE__, {}, nullptr};  \
+    if (GLValidation::checking) {                                      \
+      GLValidation::check(glSite, "before");                           \
+      stmt;                                                            \
+      GLValidation::check(glSite, "in");                               \
+    } else {                                                           \
+      GLValidation::lastSite = &glSite;                                \
+      stmt;                                                            \
     }                                                                  \
   } while(0)
 #else
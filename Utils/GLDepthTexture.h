@@ -3,6 +3,7 @@
 #include <vector>
 
 #include "GLEnv.h"
+#include "GLState.h"
 
 class GLDepthTexture {
 public:
@@ -14,7 +15,7 @@ public:
   dataType{ GLDepthDataType::DEPTH24 }
   {
     GL(glGenTextures(1, &id));
-    GL(glBindTexture(GL_TEXTURE_2D, id));
+    GLState::current().bindTexture(GL_TEXTURE_2D, id);
     GL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, wrapX));
     GL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, wrapY));
     GL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, magFilter));
@@ -25,6 +26,7 @@ public:
   
   ~GLDepthTexture() {
     GL(glDeleteTextures(1, &id));
+    GLState::current().textureDeleted(id);
   }
       
   const GLuint getId() const {return id;}
@@ -34,7 +36,7 @@ public:
     this->width = width;
     this->height = height;
 
-    GL(glBindTexture(GL_TEXTURE_2D, id));
+    GLState::current().bindTexture(GL_TEXTURE_2D, id);
     GL(glPixelStorei(GL_PACK_ALIGNMENT ,1));
     GL(glPixelStorei(GL_UNPACK_ALIGNMENT ,1));
 
@@ -60,7 +62,7 @@ public:
   GLDepthDataType getType() const {return dataType;}
     
   void setFilter(GLint magFilter, GLint minFilter) {
-    GL(glBindTexture(GL_TEXTURE_2D, id));
+    GLState::current().bindTexture(GL_TEXTURE_2D, id);
     GL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, magFilter));
     GL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, minFilter));
   }
@@ -48,6 +48,10 @@ GLEnv::GLEnv(uint32_t w, uint32_t h, uint32_t s, const std::string& title,
 
   glfwWindowHint(GLFW_SAMPLES, int(s));
 
+  const GLValidation::Mode validation = GLValidation::environmentMode();
+  if (validation == GLValidation::Mode::DEBUG_OUTPUT)
+    glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE);
+
   glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, major);
   glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, minor);
   
@@ -74,12 +78,15 @@ GLEnv::GLEnv(uint32_t w, uint32_t h, uint32_t s, const std::string& title,
     throw GLException{s.str()};
   }
   
+  GLValidation::setMode(validation, GLValidation::environmentInterval());
   setSync(sync);
-
-
 }
 
 GLEnv::~GLEnv() {
+  if (GLValidation::getErrorCount() > 0) {
+    std::cerr << "GL errors per call site:" << std::endl;
+    GLValidation::report(std::cerr);
+  }
   glfwDestroyWindow(window);
   glfwTerminate();
 }
@@ -99,6 +106,7 @@ void GLEnv::setFPSCounter(bool fpsCounter) {
 void GLEnv::endOfFrame() {
   glfwSwapBuffers(window);
   glfwPollEvents();
+  GLValidation::nextFrame();
   
   if (fpsCounter) {
     frameCount++;
@@ -1,4 +1,5 @@
 #include "GLFramebuffer.h"
+#include "GLState.h"
 
 
 GLFramebuffer::GLFramebuffer() :
@@ -243,5 +244,5 @@ void GLFramebuffer::setBuffers(size_t count, size_t width, size_t height) {
     }
   }
   
-  GL(glViewport(0, 0, GLint(width), GLint(height)));
+  GLState::current().viewport(0, 0, GLsizei(width), GLsizei(height));
 }
@@ -1,49 +1,92 @@
 #include <sstream>
 #include <fstream>
 #include <iostream>
+#include <cstring>
+#include <algorithm>
+#include <iomanip>
+#include <cstdlib>
+#include <filesystem>
 
 #include "GLProgram.h"
 #include "GLDebug.h"
-
-GLProgram::GLProgram(const GLProgram& other) :
-  GLProgram(other.vertexShaderStrings, other.fragmentShaderStrings, other.geometryShaderStrings)
-{
+#include "GLState.h"
+#include "FileWatcher.h"
+
+namespace {
+  const char CACHE_MAGIC[4] = {'G','L','P','B'};
+  const uint32_t CACHE_VERSION = 1;
+
+  struct CacheHeader {
+    char magic[4];
+    uint32_t version;
+    uint64_t key;
+    uint32_t format;
+    uint32_t size;
+  };
+
+  // off unless asked for, so that runs do not leave binaries behind in
+  // the working directory
+  std::string defaultCacheDirectory() {
+    const char* directory = std::getenv("GL_PROGRAM_CACHE");
+    return directory ? directory : "";
+  }
+
+#ifdef NDEBUG
+  constexpr bool defaultHotReload = false;
+#else
+  constexpr bool defaultHotReload = true;
+#endif
+
+  double millisecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(
+      std::chrono::steady_clock::now() - start).count();
+  }
+
+  bool parallelCompile() {
+    return GLEW_KHR_parallel_shader_compile || GLEW_ARB_parallel_shader_compile;
+  }
+
+  // FNV-1a, strings are terminated so that moving text from one string
+  // to the next changes the key
+  void hashString(uint64_t& hash, const char* s) {
+    do {
+      hash = (hash ^ uint8_t(*s)) * 1099511628211ull;
+    } while (*s++);
+  }
+}
+
+std::string GLProgram::binaryCacheDirectory = defaultCacheDirectory();
+bool GLProgram::hotReload = defaultHotReload;
+GLProgram::ReloadStats GLProgram::reloadStats;
+std::vector<std::weak_ptr<GLProgram::Shared>> GLProgram::watched;
+
+GLProgram::Shared::~Shared() {
+  for (GLuint shader : shaders) GL(glDeleteShader(shader));
+  GL(glDeleteProgram(glProgram));
+  GLState::current().programDeleted(glProgram);
 }
 
-GLProgram& GLProgram::operator=(const GLProgram& other) {
-  GL(glDeleteShader(glVertexShader));
-  GL(glDeleteShader(glFragmentShader));
-  GL(glDeleteShader(glGeometryShader));
-  GL(glDeleteProgram(glProgram));
-  programFromVectors(other.vertexShaderStrings, other.fragmentShaderStrings, other.geometryShaderStrings);
-  return *this;
+void GLProgram::setBinaryCacheDirectory(const std::string& directory) {
+  binaryCacheDirectory = directory;
 }
 
 GLuint GLProgram::createShader(GLenum type, const GLchar** src, GLsizei count) {
 	if (count==0) return 0;
 	GLuint s = glCreateShader(type); checkAndThrow();
 	glShaderSource(s, count, src, NULL); checkAndThrow();
-	glCompileShader(s); checkAndThrowShader(s);
+	glCompileShader(s); checkAndThrow();
 	return s;
 }
 
-GLProgram::GLProgram(std::vector<std::string> vertexShaderStrings, std::vector<std::string> fragmentShaderStrings, std::vector<std::string> geometryShaderStrings):
-  glVertexShader(0),
-  glFragmentShader(0),
-  glGeometryShader(0),
-  glProgram(0),
-  vertexShaderStrings(vertexShaderStrings),
-  fragmentShaderStrings(fragmentShaderStrings),
-  geometryShaderStrings(geometryShaderStrings)
+GLProgram::GLProgram(std::vector<std::string> vertexShaderStrings, std::vector<std::string> fragmentShaderStrings, std::vector<std::string> geometryShaderStrings,
+                     std::vector<std::string> feedbackVaryings):
+  shared{std::make_shared<Shared>()}
 {
-  programFromVectors(vertexShaderStrings, fragmentShaderStrings, geometryShaderStrings);
-}
-
-GLProgram::~GLProgram() {
-	GL(glDeleteShader(glVertexShader));
-	GL(glDeleteShader(glFragmentShader));
-  GL(glDeleteShader(glGeometryShader));
-	GL(glDeleteProgram(glProgram));
+  shared->vertexShaderStrings = vertexShaderStrings;
+  shared->fragmentShaderStrings = fragmentShaderStrings;
+  shared->geometryShaderStrings = geometryShaderStrings;
+  shared->feedbackVaryings = feedbackVaryings;
+  if (!loadBinary(*shared)) compileAndLink(*shared);
 }
 
 GLProgram GLProgram::createFromFiles(const std::vector<std::string>& vs, const std::vector<std::string>& fs, const std::vector<std::string>& gs) {
@@ -56,11 +99,21 @@ GLProgram GLProgram::createFromFiles(const std::vector<std::string>& vs, const s
 		fsTexts.push_back(loadFile(f));
 	}
 	std::vector<std::string> gsTexts;
+	std::vector<std::string> gsFiles;
 	for (const std::string& f : gs) {
-		if (!f.empty())		
+		if (!f.empty()) {
 			gsTexts.push_back(loadFile(f));
+			gsFiles.push_back(f);
+		}
+	}
+	GLProgram program = createFromStrings(vsTexts,fsTexts,gsTexts);
+	if (hotReload) {
+		program.shared->files = {vs, fs, gsFiles};
+		for (const auto& files : program.shared->files)
+			for (const std::string& f : files) fileWatcher().watch(f);
+		watched.push_back(program.shared);
 	}
-	return createFromStrings(vsTexts,fsTexts,gsTexts);
+	return program;
 }
 
 GLProgram GLProgram::createFromStrings(const std::vector<std::string>& vs, const std::vector<std::string>& fs, const std::vector<std::string>& gs) {
@@ -75,6 +128,10 @@ GLProgram GLProgram::createFromString(const std::string& vs, const std::string&
 	return createFromStrings(std::vector<std::string>{vs}, std::vector<std::string>{fs}, std::vector<std::string> {gs});
 }
 
+GLProgram GLProgram::createTransformFeedback(const std::string& vs, const std::vector<std::string>& varyings) {
+  return {std::vector<std::string>{vs}, std::vector<std::string>(), std::vector<std::string>(), varyings};
+}
+
 std::string GLProgram::loadFile(const std::string& filename) {
 	std::ifstream shaderFile{filename};
 	if (!shaderFile) {
@@ -89,7 +146,8 @@ std::string GLProgram::loadFile(const std::string& filename) {
 }
 
 GLint GLProgram::getAttributeLocation(const std::string& id) const {
-  const GLint l = glGetAttribLocation(glProgram, id.c_str());
+  finishLink(*shared);
+  const GLint l = glGetAttribLocation(shared->glProgram, id.c_str());
 	checkAndThrow();	
 	if(l == -1)
 		throw ProgramException{std::string("Can't find attribute ") +  id};	
@@ -97,54 +155,158 @@ GLint GLProgram::getAttributeLocation(const std::string& id) const {
 }
 
 GLint GLProgram::getUniformLocation(const std::string& id) const {
-	const GLint l = glGetUniformLocation(glProgram, id.c_str());
+  finishLink(*shared);
+  const auto known = shared->uniformLocations.find(id);
+  if (known != shared->uniformLocations.end()) return known->second;
+
+  // names the reflection does not list, e.g. members of array elements
+	const GLint l = glGetUniformLocation(shared->glProgram, id.c_str());
 	checkAndThrow();
 	if(l == -1)
 		throw ProgramException{std::string("Can't find uniform ") +  id};	
 	return l;
 }
 
+void GLProgram::setUniformBuffer(const std::string& blockName, const GLUniformBuffer& buffer) {
+  finishLink(*shared);
+  const auto block = shared->uniformBlocks.find(blockName);
+  if (block == shared->uniformBlocks.end())
+    throw ProgramException{std::string("Can't find uniform block ") + blockName};
+  std::vector<GLuint>& bindings = shared->uniformBlockBindings;
+  if (bindings[block->second] == buffer.getBinding()) return;
+  GL(glUniformBlockBinding(shared->glProgram, block->second, buffer.getBinding()));
+  bindings[block->second] = buffer.getBinding();
+}
+
+void GLProgram::invalidateUniformCache() const {
+  shared->uniformCache.clear();
+}
+
+bool GLProgram::uniformChanged(GLint id, GLenum type, const void* data,
+                               size_t size, bool transpose) const {
+  // GL ignores location -1, so there is nothing to set
+  if (id < 0) return false;
+  std::vector<UniformValue>& uniformCache = shared->uniformCache;
+  if (size_t(id) >= uniformCache.size()) uniformCache.resize(size_t(id)+1);
+  UniformValue& cached = uniformCache[size_t(id)];
+  if (cached.type == type && cached.transpose == transpose &&
+      std::memcmp(cached.data.data(), data, size) == 0) return false;
+  cached.type = type;
+  cached.transpose = transpose;
+  std::memcpy(cached.data.data(), data, size);
+  return true;
+}
+
+void GLProgram::uniformArraySet(GLint id, size_t count) const {
+  if (id < 0) return;
+  std::vector<UniformValue>& uniformCache = shared->uniformCache;
+  const size_t end = std::min(uniformCache.size(), size_t(id)+count);
+  for (size_t i = size_t(id);i<end;++i) uniformCache[i].type = GL_NONE;
+}
+
+void GLProgram::reflectUniforms(Shared& program) {
+  program.uniformLocations.clear();
+  program.uniformBlocks.clear();
+  program.uniformBlockBindings.clear();
+  program.uniformCache.clear();
+
+  GLint count = 0;
+  GLint maxLength = 0;
+  GL(glGetProgramiv(program.glProgram, GL_ACTIVE_UNIFORMS, &count));
+  GL(glGetProgramiv(program.glProgram, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength));
+  std::vector<GLchar> name(size_t(maxLength)+1);
+  for (GLint i = 0;i<count;++i) {
+    GLsizei length = 0;
+    GLint size = 0;
+    GLenum type = GL_NONE;
+    GL(glGetActiveUniform(program.glProgram, GLuint(i), GLsizei(name.size()), &length, &size, &type, name.data()));
+    const std::string uniform(name.data(), size_t(length));
+    const GLint location = glGetUniformLocation(program.glProgram, uniform.c_str());
+    // members of uniform blocks have no location
+    if (location == -1) continue;
+    program.uniformLocations[uniform] = location;
+
+    // arrays are listed as name[0], make the plain name and all elements
+    // known as well
+    if (uniform.size() > 3 && uniform.compare(uniform.size()-3, 3, "[0]") == 0) {
+      const std::string base = uniform.substr(0, uniform.size()-3);
+      program.uniformLocations[base] = location;
+      for (GLint e = 1;e<size;++e) {
+        const std::string element = base + "[" + std::to_string(e) + "]";
+        program.uniformLocations[element] = glGetUniformLocation(program.glProgram, element.c_str());
+      }
+    }
+  }
+
+  GL(glGetProgramiv(program.glProgram, GL_ACTIVE_UNIFORM_BLOCKS, &count));
+  GL(glGetProgramiv(program.glProgram, GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH, &maxLength));
+  name.resize(size_t(maxLength)+1);
+  for (GLint i = 0;i<count;++i) {
+    GLsizei length = 0;
+    GL(glGetActiveUniformBlockName(program.glProgram, GLuint(i), GLsizei(name.size()), &length, name.data()));
+    GLint binding = 0;
+    GL(glGetActiveUniformBlockiv(program.glProgram, GLuint(i), GL_UNIFORM_BLOCK_BINDING, &binding));
+    program.uniformBlocks[std::string(name.data(), size_t(length))] = GLuint(i);
+    program.uniformBlockBindings.push_back(GLuint(binding));
+  }
+}
+
 void GLProgram::enable() const {
-	GL(glUseProgram(glProgram));
+	finishLink(*shared);
+	GLState::current().useProgram(shared->glProgram);
 }
 
 void GLProgram::disable() const {
-	GL(glUseProgram(0));
+	GLState::current().useProgram(0);
 }
 
 void GLProgram::setUniform(GLint id, float value) const {
+  if (!uniformChanged(id, GL_FLOAT, &value, sizeof(value))) return;
 	GL(glUniform1f(id, value));
 }
 
 void GLProgram::setUniform(GLint id, const Vec2& value) const {
+  if (!uniformChanged(id, GL_FLOAT_VEC2, value, sizeof(value))) return;
   GL(glUniform2fv(id, 1, value));
 }
 
 void GLProgram::setUniform(GLint id, const Vec3& value) const {
+  if (!uniformChanged(id, GL_FLOAT_VEC3, value, sizeof(value))) return;
 	GL(glUniform3fv(id, 1, value));
 }
 
 void GLProgram::setUniform(GLint id, const Vec4& value) const {
+  if (!uniformChanged(id, GL_FLOAT_VEC4, value, sizeof(value))) return;
   GL(glUniform4fv(id, 1, value));
 }
 
 void GLProgram::setUniform(GLint id, int value) const {
+  if (!uniformChanged(id, GL_INT, &value, sizeof(value))) return;
   GL(glUniform1i(id, value));
 }
 
 void GLProgram::setUniform(GLint id, const Vec2i& value) const {
+  if (!uniformChanged(id, GL_INT_VEC2, value, sizeof(value))) return;
   GL(glUniform2iv(id, 1, value));
 }
 
 void GLProgram::setUniform(GLint id, const Vec3i& value) const {
+  if (!uniformChanged(id, GL_INT_VEC3, value, sizeof(value))) return;
   GL(glUniform3iv(id, 1, value));
 }
 
 void GLProgram::setUniform(GLint id, const Vec4i& value) const {
+  if (!uniformChanged(id, GL_INT_VEC4, value, sizeof(value))) return;
   GL(glUniform4iv(id, 1, value));
 }
 
+void GLProgram::setUniform(GLint id, const Mat3& value, bool transpose) const {
+  if (!uniformChanged(id, GL_FLOAT_MAT3, value, sizeof(GLfloat)*9, transpose)) return;
+  GL(glUniformMatrix3fv(id, 1, !transpose, value));
+}
+
 void GLProgram::setUniform(GLint id, const Mat4& value, bool transpose) const {
+  if (!uniformChanged(id, GL_FLOAT_MAT4, value, sizeof(GLfloat)*16, transpose)) return;
 	// since OpenGL matrices are usuall expected
   // column major but our matrices are row major
   // hence, we invert the transposition flag
@@ -152,38 +314,47 @@ void GLProgram::setUniform(GLint id, const Mat4& value, bool transpose) const {
 }
 
 void GLProgram::setUniform(GLint id, const std::vector<float>& value) const {
+  uniformArraySet(id, value.size());
   GL(glUniform1fv(id, GLsizei(value.size()), value.data()));
 }
 
 void GLProgram::setUniform(GLint id, const std::vector<Vec2>& value) const {
+  uniformArraySet(id, value.size());
   GL(glUniform2fv(id, GLsizei(value.size()), (GLfloat*)value.data()));
 }
 
 void GLProgram::setUniform(GLint id, const std::vector<Vec3>& value) const {
+  uniformArraySet(id, value.size());
   GL(glUniform3fv(id, GLsizei(value.size()), (GLfloat*)value.data()));
 }
 
 void GLProgram::setUniform(GLint id, const std::vector<Vec4>& value) const {
+  uniformArraySet(id, value.size());
   GL(glUniform4fv(id, GLsizei(value.size()), (GLfloat*)value.data()));
 }
 
 void GLProgram::setUniform(GLint id, const std::vector<int>& value) const {
+  uniformArraySet(id, value.size());
   GL(glUniform1iv(id, GLsizei(value.size()), (GLint*)value.data()));
 }
 
 void GLProgram::setUniform(GLint id, const std::vector<Vec2i>& value) const {
+  uniformArraySet(id, value.size());
   GL(glUniform2iv(id, GLsizei(value.size()), (GLint*)value.data()));
 }
 
 void GLProgram::setUniform(GLint id, const std::vector<Vec3i>& value) const {
+  uniformArraySet(id, value.size());
   GL(glUniform3iv(id, GLsizei(value.size()), (GLint*)value.data()));
 }
 
 void GLProgram::setUniform(GLint id, const std::vector<Vec4i>& value) const {
+  uniformArraySet(id, value.size());
   GL(glUniform4iv(id, GLsizei(value.size()), (GLint*)value.data()));
 }
 
 void GLProgram::setUniform(GLint id, const std::vector<Mat4>& value, bool transpose) const {
+  uniformArraySet(id, value.size());
   // since OpenGL matrices are usuall expected
   // column major but our matrices are row major
   // hence, we invert the transposition flag
@@ -191,77 +362,196 @@ void GLProgram::setUniform(GLint id, const std::vector<Mat4>& value, bool transp
 }
 
 void GLProgram::setTexture(GLint id, const GLDepthTexture& texture, GLenum unit) const {
-  GL(glActiveTexture(GL_TEXTURE0 + unit));
-  GL(glBindTexture(GL_TEXTURE_2D, texture.getId()));
-  GL(glUniform1i(id, GLint(unit)));
+  GLState::current().bindTexture(unit, GL_TEXTURE_2D, texture.getId());
+  setUniform(id, GLint(unit));
 }
 
 void GLProgram::setTexture(GLint id, const GLTexture1D& texture, GLenum unit) const {
-  GL(glActiveTexture(GL_TEXTURE0 + unit));
-  GL(glBindTexture(GL_TEXTURE_1D, texture.getId()));
-  GL(glUniform1i(id, GLint(unit)));
+  GLState::current().bindTexture(unit, GL_TEXTURE_1D, texture.getId());
+  setUniform(id, GLint(unit));
 }
 
 void GLProgram::setTexture(GLint id, const GLTexture2D& texture, GLenum unit) const {
-	GL(glActiveTexture(GL_TEXTURE0 + unit));
-	GL(glBindTexture(GL_TEXTURE_2D, texture.getId()));
-	GL(glUniform1i(id, GLint(unit)));
+	GLState::current().bindTexture(unit, GL_TEXTURE_2D, texture.getId());
+	setUniform(id, GLint(unit));
 }
 
 void GLProgram::setTexture(GLint id, const GLTexture3D& texture, GLenum unit) const {
-  GL(glActiveTexture(GL_TEXTURE0 + unit));
-  GL(glBindTexture(GL_TEXTURE_3D, texture.getId()));
-  GL(glUniform1i(id, GLint(unit)));
+  GLState::current().bindTexture(unit, GL_TEXTURE_3D, texture.getId());
+  setUniform(id, GLint(unit));
 }
 
 void GLProgram::setTexture(GLint id, const GLTextureCube& texture, GLenum unit) const {
-  GL(glActiveTexture(GL_TEXTURE0 + unit));
-  GL(glBindTexture(GL_TEXTURE_CUBE_MAP, texture.getId()));
-  GL(glUniform1i(id, GLint(unit)));
+  GLState::current().bindTexture(unit, GL_TEXTURE_CUBE_MAP, texture.getId());
+  setUniform(id, GLint(unit));
 }
 
 void GLProgram::unsetTexture1D(GLenum unit) const {
-  GL(glActiveTexture(GL_TEXTURE0 + unit));
-  GL(glBindTexture(GL_TEXTURE_1D, 0));
+  GLState::current().bindTexture(unit, GL_TEXTURE_1D, 0);
 }
 
 void GLProgram::unsetTexture2D(GLenum unit) const {
-  GL(glActiveTexture(GL_TEXTURE0 + unit));
-  GL(glBindTexture(GL_TEXTURE_2D, 0));
+  GLState::current().bindTexture(unit, GL_TEXTURE_2D, 0);
 }
 
 void GLProgram::unsetTexture3D(GLenum unit) const {
-  GL(glActiveTexture(GL_TEXTURE0 + unit));
-  GL(glBindTexture(GL_TEXTURE_3D, 0));
-}
-
-void GLProgram::programFromVectors(std::vector<std::string> vs, std::vector<std::string> fs, std::vector<std::string> gs) {
-  vertexShaderStrings   = vs;
-  fragmentShaderStrings = fs;
-  geometryShaderStrings = gs;
-
-  std::vector<const GLchar*> vertexShaderTexts;
-  for (const std::string& s : vertexShaderStrings)
-   vertexShaderTexts.push_back(s.c_str());
-
-  std::vector<const GLchar*> fragmentShaderTexts;
-  for (const std::string& s : fragmentShaderStrings)
-   fragmentShaderTexts.push_back(s.c_str());
-   
-  std::vector<const GLchar*> geometryShaderTexts;
-  for (const std::string& s : geometryShaderStrings)
-   if (!s.empty())
-     geometryShaderTexts.push_back(s.c_str());
-
-  glVertexShader = createShader(GL_VERTEX_SHADER, vertexShaderTexts.data(), GLsizei(vertexShaderTexts.size()));
-  glFragmentShader = createShader(GL_FRAGMENT_SHADER, fragmentShaderTexts.data(), GLsizei(fragmentShaderTexts.size()));
-  glGeometryShader = createShader(GL_GEOMETRY_SHADER, geometryShaderTexts.data(), GLsizei(geometryShaderTexts.size()));
-
-  glProgram = glCreateProgram(); checkAndThrow();
-  if (glVertexShader) {glAttachShader(glProgram, glVertexShader); checkAndThrow();}
-  if (glFragmentShader) {glAttachShader(glProgram, glFragmentShader); checkAndThrow();}
-  if (glGeometryShader) {glAttachShader(glProgram, glGeometryShader); checkAndThrow();}
-  glLinkProgram(glProgram); checkAndThrowProgram(glProgram);
+  GLState::current().bindTexture(unit, GL_TEXTURE_3D, 0);
+}
+
+void GLProgram::compileAndLink(Shared& program) {
+  static bool threadsSet = false;
+  if (!threadsSet && GLEW_KHR_parallel_shader_compile) {
+    GL(glMaxShaderCompilerThreadsKHR(0xFFFFFFFF));
+    threadsSet = true;
+  }
+
+  const std::vector<std::string>* sources[3] = {&program.vertexShaderStrings,
+                                                &program.fragmentShaderStrings,
+                                                &program.geometryShaderStrings};
+  const GLenum types[3] = {GL_VERTEX_SHADER, GL_FRAGMENT_SHADER, GL_GEOMETRY_SHADER};
+  for (size_t i = 0;i<3;++i) {
+    std::vector<const GLchar*> texts;
+    for (const std::string& s : *sources[i])
+      if (!s.empty()) texts.push_back(s.c_str());
+    program.shaders[i] = createShader(types[i], texts.data(), GLsizei(texts.size()));
+  }
+
+  program.glProgram = glCreateProgram(); checkAndThrow();
+  for (GLuint shader : program.shaders)
+    if (shader) {glAttachShader(program.glProgram, shader); checkAndThrow();}
+  if (!program.feedbackVaryings.empty()) {
+    std::vector<const GLchar*> names;
+    for (const std::string& s : program.feedbackVaryings)
+      names.push_back(s.c_str());
+    glTransformFeedbackVaryings(program.glProgram, GLsizei(names.size()), names.data(), GL_INTERLEAVED_ATTRIBS); checkAndThrow();
+  }
+  if (!program.binaryFile.empty())
+    GL(glProgramParameteri(program.glProgram, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE));
+  glLinkProgram(program.glProgram); checkAndThrow();
+}
+
+bool GLProgram::isReady() const {
+  return linkDone(*shared);
+}
+
+bool GLProgram::linkDone(const Shared& program) {
+  if (program.linked || program.fromBinary || !parallelCompile()) return true;
+  GLint done = GL_FALSE;
+  GL(glGetProgramiv(program.glProgram, GL_COMPLETION_STATUS_KHR, &done));
+  return done == GL_TRUE;
+}
+
+void GLProgram::finishLink(Shared& program) {
+  if (program.linked) return;
+
+  if (program.fromBinary) {
+    GLint linked = GL_FALSE;
+    GL(glGetProgramiv(program.glProgram, GL_LINK_STATUS, &linked));
+    if (linked != GL_TRUE) {
+      // e.g. the driver changed without changing its version string
+      GL(glDeleteProgram(program.glProgram));
+      program.fromBinary = false;
+      compileAndLink(program);
+    }
+  }
+  if (!program.fromBinary) {
+    for (GLuint shader : program.shaders)
+      if (shader) checkAndThrowShader(shader);
+    checkAndThrowProgram(program.glProgram);
+    saveBinary(program);
+  }
+
+  for (GLuint& shader : program.shaders) {
+    if (!shader) continue;
+    GL(glDetachShader(program.glProgram, shader));
+    GL(glDeleteShader(shader));
+    shader = 0;
+  }
+  reflectUniforms(program);
+  program.linked = true;
+}
+
+bool GLProgram::loadBinary(Shared& program) {
+  if (binaryCacheDirectory.empty() || !GLEW_ARB_get_program_binary) return false;
+  // some drivers support the calls but no format, e.g. Mesa without its
+  // own shader cache
+  static GLint formatCount = -1;
+  if (formatCount < 0) GL(glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount));
+  if (formatCount == 0) return false;
+
+  uint64_t key = 14695981039346656037ull;
+  for (GLenum name : {GL_VENDOR, GL_RENDERER, GL_VERSION}) {
+    const GLubyte* value = glGetString(name);
+    hashString(key, value ? (const char*)value : "");
+  }
+  for (const auto* strings : {&program.vertexShaderStrings,
+                              &program.fragmentShaderStrings,
+                              &program.geometryShaderStrings,
+                              &program.feedbackVaryings}) {
+    for (const std::string& s : *strings) hashString(key, s.c_str());
+    hashString(key, "");
+  }
+  std::stringstream filename;
+  filename << binaryCacheDirectory << "/" << std::hex << std::setw(16)
+           << std::setfill('0') << key << ".glbin";
+  program.binaryFile = filename.str();
+  program.binaryKey = key;
+
+  std::ifstream file(program.binaryFile, std::ifstream::binary);
+  if (!file.is_open()) return false;
+  CacheHeader header;
+  if (!file.read((char*)&header, sizeof(header)) ||
+      std::memcmp(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0 ||
+      header.version != CACHE_VERSION || header.key != key) return false;
+  std::vector<char> binary(header.size);
+  if (!file.read(binary.data(), std::streamsize(binary.size()))) return false;
+
+  program.glProgram = glCreateProgram(); checkAndThrow();
+  // a format the driver no longer accepts is an error, not a failed link
+  glProgramBinary(program.glProgram, header.format, binary.data(), GLsizei(binary.size()));
+  if (glGetError() != GL_NO_ERROR) {
+    GL(glDeleteProgram(program.glProgram));
+    program.glProgram = 0;
+    return false;
+  }
+  program.fromBinary = true;
+  return true;
+}
+
+// written to a temporary file first so concurrent loads never see a
+// partial binary, failures are ignored as the cache is only an optimization
+void GLProgram::saveBinary(const Shared& program) {
+  if (program.binaryFile.empty()) return;
+  GLint length = 0;
+  GL(glGetProgramiv(program.glProgram, GL_PROGRAM_BINARY_LENGTH, &length));
+  if (length <= 0) return;
+
+  std::vector<char> binary(static_cast<size_t>(length));
+  GLenum format = GL_NONE;
+  GL(glGetProgramBinary(program.glProgram, length, &length, &format, binary.data()));
+
+  std::error_code ec;
+  std::filesystem::create_directories(binaryCacheDirectory, ec);
+  const std::string tempFilename = program.binaryFile + ".tmp";
+  {
+    std::ofstream file(tempFilename, std::ofstream::binary);
+    if (!file.is_open()) return;
+    CacheHeader header;
+    std::memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+    header.version = CACHE_VERSION;
+    header.key = program.binaryKey;
+    header.format = format;
+    header.size = uint32_t(length);
+    file.write((const char*)&header, sizeof(header));
+    file.write(binary.data(), length);
+    if (!file) {
+      file.close();
+      std::filesystem::remove(tempFilename, ec);
+      return;
+    }
+  }
+  std::filesystem::rename(tempFilename, program.binaryFile, ec);
+  if (ec) std::filesystem::remove(tempFilename, ec);
 }
 
 
@@ -289,6 +579,10 @@ void GLProgram::setUniform(const std::string& id, const Vec2i& value) const {
   setUniform(getUniformLocation(id), value);
 }
 
+void GLProgram::setUniform(const std::string& id, const Mat3& value, bool transpose) const {
+  setUniform(getUniformLocation(id), value, transpose);
+}
+
 void GLProgram::setUniform(const std::string& id, const Mat4& value, bool transpose) const {
   setUniform(getUniformLocation(id), value, transpose);
 }
@@ -312,3 +606,124 @@ void GLProgram::setTexture(const std::string& id, const GLTexture3D& texture, GL
 void GLProgram::setTexture(const std::string& id, const GLTextureCube& texture, GLenum unit) const {
   setTexture(getUniformLocation(id), texture, unit);
 }
+
+FileWatcher& GLProgram::fileWatcher() {
+  static FileWatcher watcher;
+  return watcher;
+}
+
+void GLProgram::reloadChanged() {
+  if (watched.empty()) return;
+  const std::vector<std::string> changed = fileWatcher().takeChanged();
+
+  watched.erase(std::remove_if(watched.begin(), watched.end(),
+                               [](const std::weak_ptr<Shared>& p) {return p.expired();}),
+                watched.end());
+  for (const std::weak_ptr<Shared>& p : watched) {
+    const std::shared_ptr<Shared> program = p.lock();
+    bool uses = false;
+    for (const auto& files : program->files)
+      for (const std::string& f : files)
+        uses = uses || std::find(changed.begin(), changed.end(), f) != changed.end();
+    if (uses) startReload(*program);
+    if (program->pending && linkDone(*program->pending)) finishReload(*program);
+  }
+}
+
+void GLProgram::startReload(Shared& program) {
+  const auto start = std::chrono::steady_clock::now();
+  program.reloadStart = start;
+  // a newer edit replaces a rebuild still in progress
+  program.pending.reset();
+  try {
+    auto pending = std::make_shared<Shared>();
+    for (const std::string& f : program.files[0])
+      pending->vertexShaderStrings.push_back(loadFile(f));
+    for (const std::string& f : program.files[1])
+      pending->fragmentShaderStrings.push_back(loadFile(f));
+    for (const std::string& f : program.files[2])
+      pending->geometryShaderStrings.push_back(loadFile(f));
+    pending->feedbackVaryings = program.feedbackVaryings;
+    if (!loadBinary(*pending)) compileAndLink(*pending);
+    program.pending = pending;
+  } catch (const std::exception& e) {
+    ++reloadStats.failures;
+    std::cerr << "shader reload failed, keeping the old program: " << e.what() << std::endl;
+  }
+  reloadStats.lastStallMs = millisecondsSince(start);
+}
+
+void GLProgram::finishReload(Shared& program) {
+  const auto start = std::chrono::steady_clock::now();
+  const std::shared_ptr<Shared> pending = std::move(program.pending);
+  try {
+    finishLink(*pending);
+  } catch (const std::exception& e) {
+    ++reloadStats.failures;
+    reloadStats.lastStallMs = millisecondsSince(start);
+    std::cerr << "shader reload failed, keeping the old program: " << e.what() << std::endl;
+    return;
+  }
+
+  // carry over uniform values and block bindings by name, uniforms are set
+  // through the new program's cache so they are not set twice later
+  GLState::current().useProgram(pending->glProgram);
+  pending->uniformCache.resize(program.uniformCache.size());
+  for (const auto& uniform : program.uniformLocations) {
+    const size_t location = size_t(uniform.second);
+    if (location >= program.uniformCache.size()) continue;
+    const UniformValue& value = program.uniformCache[location];
+    const auto target = pending->uniformLocations.find(uniform.first);
+    if (value.type == GL_NONE || target == pending->uniformLocations.end()) continue;
+    restoreUniform(target->second, value);
+    if (size_t(target->second) >= pending->uniformCache.size())
+      pending->uniformCache.resize(size_t(target->second)+1);
+    pending->uniformCache[size_t(target->second)] = value;
+  }
+  for (const auto& block : program.uniformBlocks) {
+    const auto target = pending->uniformBlocks.find(block.first);
+    if (target == pending->uniformBlocks.end()) continue;
+    const GLuint binding = program.uniformBlockBindings[block.second];
+    GL(glUniformBlockBinding(pending->glProgram, target->second, binding));
+    pending->uniformBlockBindings[target->second] = binding;
+  }
+
+  // swap into the existing state so every copy sees the new program, the
+  // old one is deleted with pending
+  std::swap(program.glProgram, pending->glProgram);
+  std::swap(program.shaders, pending->shaders);
+  std::swap(program.fromBinary, pending->fromBinary);
+  std::swap(program.binaryFile, pending->binaryFile);
+  std::swap(program.binaryKey, pending->binaryKey);
+  std::swap(program.vertexShaderStrings, pending->vertexShaderStrings);
+  std::swap(program.fragmentShaderStrings, pending->fragmentShaderStrings);
+  std::swap(program.geometryShaderStrings, pending->geometryShaderStrings);
+  std::swap(program.uniformLocations, pending->uniformLocations);
+  std::swap(program.uniformBlocks, pending->uniformBlocks);
+  std::swap(program.uniformBlockBindings, pending->uniformBlockBindings);
+  std::swap(program.uniformCache, pending->uniformCache);
+  program.linked = true;
+
+  ++reloadStats.reloads;
+  reloadStats.lastReloadMs = millisecondsSince(program.reloadStart);
+  reloadStats.lastStallMs = millisecondsSince(start);
+}
+
+void GLProgram::restoreUniform(GLint location, const UniformValue& value) {
+  const GLfloat* f = value.data.data();
+  std::array<GLint, 4> i;
+  std::memcpy(i.data(), f, sizeof(i));
+  switch (value.type) {
+    case GL_FLOAT : GL(glUniform1fv(location, 1, f)); break;
+    case GL_FLOAT_VEC2 : GL(glUniform2fv(location, 1, f)); break;
+    case GL_FLOAT_VEC3 : GL(glUniform3fv(location, 1, f)); break;
+    case GL_FLOAT_VEC4 : GL(glUniform4fv(location, 1, f)); break;
+    case GL_INT : GL(glUniform1iv(location, 1, i.data())); break;
+    case GL_INT_VEC2 : GL(glUniform2iv(location, 1, i.data())); break;
+    case GL_INT_VEC3 : GL(glUniform3iv(location, 1, i.data())); break;
+    case GL_INT_VEC4 : GL(glUniform4iv(location, 1, i.data())); break;
+    case GL_FLOAT_MAT3 : GL(glUniformMatrix3fv(location, 1, !value.transpose, f)); break;
+    case GL_FLOAT_MAT4 : GL(glUniformMatrix4fv(location, 1, !value.transpose, f)); break;
+    default : break;
+  }
+}
@@ -2,6 +2,10 @@
 
 #include <vector>
 #include <string>
+#include <array>
+#include <memory>
+#include <chrono>
+#include <unordered_map>
 #include <exception>
 
 #include <GL/glew.h>
@@ -10,12 +14,16 @@
 #include "Vec2.h"
 #include "Vec3.h"
 #include "Vec4.h"
+#include "Mat3.h"
 #include "Mat4.h"
 #include "GLDepthTexture.h"
 #include "GLTexture1D.h"
 #include "GLTexture2D.h"
 #include "GLTexture3D.h"
 #include "GLTextureCube.h"
+#include "GLUniformBuffer.h"
+
+class FileWatcher;
 
 class ProgramException : public std::exception {
 	public:
@@ -27,9 +35,19 @@ class ProgramException : public std::exception {
 		std::string whatStr;
 };
 
+// Active uniforms are looked up once after linking, name based setters
+// only hash the name. The last value set for every location is kept so
+// that setting an unchanged value does not reach GL, this assumes uniforms
+// are only changed through this class and only while the program is
+// enabled.
+// Creating a program only starts compiling and linking, the result is
+// checked on first use, so drivers supporting KHR_parallel_shader_compile
+// build several programs at once. If a cache directory is set, linked
+// programs are stored there as binaries and later loaded instead of
+// compiled. Copies share the same GL program, uniforms set through one
+// copy are set for all.
 class GLProgram {
 public:
-	~GLProgram();
 	
 	static GLProgram createFromFiles(const std::vector<std::string>& vs, const std::vector<std::string>& fs,
                                    const std::vector<std::string>& gs = std::vector<std::string>());
@@ -38,19 +56,56 @@ public:
 
 	static GLProgram createFromFile(const std::string& vs, const std::string& fs, const std::string& gs="");
 	static GLProgram createFromString(const std::string& vs, const std::string& fs, const std::string& gs="");
+
+  // vertex shader only program whose outputs named in varyings are captured
+  // interleaved with transform feedback, draw with GL_RASTERIZER_DISCARD
+  static GLProgram createTransformFeedback(const std::string& vs, const std::vector<std::string>& varyings);
 	
-  GLProgram(const GLProgram& other);
-  GLProgram& operator=(const GLProgram& other);
+  // false while the driver is still compiling or linking in the background,
+  // using the program then blocks until it is done
+  bool isReady() const;
+
+  // binaries are cached in directory keyed by the sources and the driver,
+  // an empty name disables the cache, defaults to GL_PROGRAM_CACHE and is
+  // empty if that is not set
+  static void setBinaryCacheDirectory(const std::string& directory);
+  static const std::string& getBinaryCacheDirectory() {return binaryCacheDirectory;}
+
+  // Programs created from files are rebuilt when one of the files is
+  // written, on by default in debug builds. The rebuilt program replaces
+  // the old one in reloadChanged once the driver is done with it, values
+  // set through this class and block bindings are carried over by name.
+  // If the new sources fail to build the old program stays in use.
+  static void setHotReload(bool enabled) {hotReload = enabled;}
+  // starts rebuilding programs whose files changed and swaps in the ones
+  // that are ready, GLApp calls this between frames
+  static void reloadChanged();
+
+  struct ReloadStats {
+    uint64_t reloads{0};
+    uint64_t failures{0};
+    double lastReloadMs{0.0};   // from noticing the change to the swap
+    double lastStallMs{0.0};    // time the last reload step took in reloadChanged
+  };
+  static const ReloadStats& getReloadStats() {return reloadStats;}
   
   GLint getAttributeLocation(const std::string& id) const;
   GLint getUniformLocation(const std::string& id) const;
 
+  // connects the std140 uniform block blockName to the binding point of
+  // buffer
+  void setUniformBuffer(const std::string& blockName, const GLUniformBuffer& buffer);
+  // forgets the cached uniform values, needed if uniforms were changed
+  // directly with glUniform*
+  void invalidateUniformCache() const;
+
   void setUniform(const std::string& id, float value) const;
   void setUniform(const std::string& id, const Vec2& value) const;
   void setUniform(const std::string& id, const Vec3& value) const;
   void setUniform(const std::string& id, const Vec4& value) const;
   void setUniform(const std::string& id, int value) const;
   void setUniform(const std::string& id, const Vec2i& value) const;
+  void setUniform(const std::string& id, const Mat3& value, bool transpose=false) const;
   void setUniform(const std::string& id, const Mat4& value, bool transpose=false) const;
   
   void setTexture(const std::string& id, const GLDepthTexture& texture, GLenum unit=0) const;
@@ -67,6 +122,7 @@ public:
   void setUniform(GLint id, const Vec2i& value) const;
   void setUniform(GLint id, const Vec3i& value) const;
   void setUniform(GLint id, const Vec4i& value) const;
+  void setUniform(GLint id, const Mat3& value, bool transpose=false) const;
 	void setUniform(GLint id, const Mat4& value, bool transpose=false) const;
 
   void setUniform(GLint id, const std::vector<float>& value) const;
@@ -93,20 +149,69 @@ public:
 	void disable() const;
 
 private:
-	GLuint glVertexShader;
-	GLuint glFragmentShader;
-	GLuint glGeometryShader;
-	GLuint glProgram;
-  
-  std::vector<std::string> vertexShaderStrings;
-  std::vector<std::string> fragmentShaderStrings;
-  std::vector<std::string> geometryShaderStrings;
+  struct UniformValue {
+    GLenum type{GL_NONE};
+    bool transpose{false};
+    std::array<GLfloat, 16> data;   // integers are stored bit for bit
+  };
+
+  // the GL program and everything derived from it, owned by all copies
+  struct Shared {
+    GLuint glProgram{0};
+    std::array<GLuint, 3> shaders{};  // vertex, fragment, geometry until linked
+    bool linked{false};               // link checked and uniforms reflected
+    bool fromBinary{false};
+    std::string binaryFile;           // empty if not cached
+    uint64_t binaryKey{0};
+
+    std::vector<std::string> vertexShaderStrings;
+    std::vector<std::string> fragmentShaderStrings;
+    std::vector<std::string> geometryShaderStrings;
+    std::vector<std::string> feedbackVaryings;
+
+    std::unordered_map<std::string, GLint> uniformLocations;
+    std::unordered_map<std::string, GLuint> uniformBlocks;
+    std::vector<GLuint> uniformBlockBindings;
+    std::vector<UniformValue> uniformCache;   // by location
+
+    std::array<std::vector<std::string>, 3> files;  // empty unless from files
+    std::shared_ptr<Shared> pending;  // rebuilt program waiting to be swapped in
+    std::chrono::steady_clock::time_point reloadStart;
+
+    ~Shared();
+  };
+  std::shared_ptr<Shared> shared;
+
+  static std::string binaryCacheDirectory;
+  static bool hotReload;
+  static ReloadStats reloadStats;
+  static std::vector<std::weak_ptr<Shared>> watched;
+
+  // records the value and returns false if it is already set
+  bool uniformChanged(GLint id, GLenum type, const void* data, size_t size,
+                      bool transpose=false) const;
+  // arrays are not cached, forgets count locations starting at id
+  void uniformArraySet(GLint id, size_t count) const;
 	
 	static std::string loadFile(const std::string& filename);
 	
 	static GLuint createShader(GLenum type, const GLchar** src, GLsizei count);
 
-  GLProgram(std::vector<std::string> vertexShaderStrings, std::vector<std::string> fragmentShaderStrings, std::vector<std::string> geometryShaderStrings);
+  GLProgram(std::vector<std::string> vertexShaderStrings, std::vector<std::string> fragmentShaderStrings, std::vector<std::string> geometryShaderStrings,
+            std::vector<std::string> feedbackVaryings=std::vector<std::string>());
+
+  // starts compiling and linking without waiting for the result
+  static void compileAndLink(Shared& program);
+  static bool linkDone(const Shared& program);
+  // waits for the link, throws on errors and reflects the uniforms
+  static void finishLink(Shared& program);
+  static void reflectUniforms(Shared& program);
+  static bool loadBinary(Shared& program);
+  static void saveBinary(const Shared& program);
 
-  void programFromVectors(std::vector<std::string> vs, std::vector<std::string> fs, std::vector<std::string> gs);
+  static FileWatcher& fileWatcher();
+  static void startReload(Shared& program);
+  static void finishReload(Shared& program);
+  // sets value for the program in use
+  static void restoreUniform(GLint location, const UniformValue& value);
 };
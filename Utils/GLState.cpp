@@ -0,0 +1,220 @@
+#include <algorithm>
+
+#include "GLState.h"
+#include "GLDebug.h"
+
+GLState& GLState::current() {
+  static thread_local GLState state;
+  return state;
+}
+
+GLState::GLState() :
+  issued(0),
+  elided(0)
+{
+  invalidate();
+}
+
+template <typename T>
+bool GLState::change(T& cached, const T& value) {
+  if (cached == value) {
+    ++elided;
+    return false;
+  }
+  cached = value;
+  ++issued;
+  return true;
+}
+
+int64_t GLState::bufferSlot(GLenum target) {
+  switch (target) {
+    case GL_ARRAY_BUFFER : return 0;
+    case GL_ELEMENT_ARRAY_BUFFER : return 1;
+    case GL_UNIFORM_BUFFER : return 2;
+    case GL_TRANSFORM_FEEDBACK_BUFFER : return 3;
+    case GL_COPY_READ_BUFFER : return 4;
+    case GL_COPY_WRITE_BUFFER : return 5;
+    case GL_PIXEL_PACK_BUFFER : return 6;
+    case GL_PIXEL_UNPACK_BUFFER : return 7;
+    case GL_SHADER_STORAGE_BUFFER : return 8;
+    case GL_DRAW_INDIRECT_BUFFER : return 9;
+    case GL_TEXTURE_BUFFER : return 10;
+    default : return -1;
+  }
+}
+
+int64_t GLState::textureSlot(GLenum target) {
+  switch (target) {
+    case GL_TEXTURE_1D : return 0;
+    case GL_TEXTURE_2D : return 1;
+    case GL_TEXTURE_3D : return 2;
+    case GL_TEXTURE_CUBE_MAP : return 3;
+    case GL_TEXTURE_2D_ARRAY : return 4;
+    case GL_TEXTURE_RECTANGLE : return 5;
+    case GL_TEXTURE_2D_MULTISAMPLE : return 6;
+    default : return -1;
+  }
+}
+
+GLState::Cap* GLState::findCap(GLenum cap) {
+  for (Cap& c : caps) {
+    if (c.cap == cap) return &c;
+  }
+  return nullptr;
+}
+
+void GLState::useProgram(GLuint program) {
+  if (change(this->program, program)) GL(glUseProgram(program));
+}
+
+void GLState::bindVertexArray(GLuint vertexArray) {
+  if (!change(this->vertexArray, vertexArray)) return;
+  GL(glBindVertexArray(vertexArray));
+  // the index buffer binding belongs to the vertex array
+  buffers[size_t(bufferSlot(GL_ELEMENT_ARRAY_BUFFER))] = unknown;
+}
+
+void GLState::bindBuffer(GLenum target, GLuint buffer) {
+  const int64_t slot = bufferSlot(target);
+  if (slot < 0) {
+    ++issued;
+  } else if (!change(buffers[size_t(slot)], buffer)) {
+    return;
+  }
+  GL(glBindBuffer(target, buffer));
+}
+
+void GLState::bindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+  ++issued;
+  GL(glBindBufferBase(target, index, buffer));
+  const int64_t slot = bufferSlot(target);
+  if (slot >= 0) buffers[size_t(slot)] = buffer;
+}
+
+void GLState::activeTexture(GLuint unit) {
+  if (change(activeUnit, unit)) GL(glActiveTexture(GL_TEXTURE0 + unit));
+}
+
+void GLState::bindTexture(GLenum target, GLuint texture) {
+  if (activeUnit == unknown) {
+    GLint unit;
+    GL(glGetIntegerv(GL_ACTIVE_TEXTURE, &unit));
+    activeUnit = GLuint(unit) - GL_TEXTURE0;
+  }
+  const int64_t slot = textureSlot(target);
+  if (slot < 0 || activeUnit >= textureUnitCount) {
+    ++issued;
+  } else if (!change(textures[activeUnit][size_t(slot)], texture)) {
+    return;
+  }
+  GL(glBindTexture(target, texture));
+}
+
+void GLState::bindTexture(GLuint unit, GLenum target, GLuint texture) {
+  // skips the unit switch as well if the texture is already in place
+  const int64_t slot = textureSlot(target);
+  if (slot >= 0 && unit < textureUnitCount &&
+      textures[unit][size_t(slot)] == texture) {
+    ++elided;
+    return;
+  }
+  activeTexture(unit);
+  bindTexture(target, texture);
+}
+
+void GLState::setEnabled(GLenum cap, bool enabled) {
+  Cap* c = findCap(cap);
+  if (c) {
+    if (!change(c->enabled, enabled)) return;
+  } else {
+    caps.push_back({cap, enabled});
+    ++issued;
+  }
+  if (enabled) GL(glEnable(cap)); else GL(glDisable(cap));
+}
+
+bool GLState::isEnabled(GLenum cap) {
+  const Cap* c = findCap(cap);
+  if (c) return c->enabled;
+  GLboolean enabled;
+  GL(enabled = glIsEnabled(cap));
+  caps.push_back({cap, enabled == GL_TRUE});
+  return enabled == GL_TRUE;
+}
+
+void GLState::blendFunc(GLenum src, GLenum dst) {
+  if (change(blend, std::array<GLenum, 2>{src, dst})) GL(glBlendFunc(src, dst));
+}
+
+void GLState::blendFunc(GLuint drawBuffer, GLenum src, GLenum dst) {
+  ++issued;
+  GL(glBlendFunci(drawBuffer, src, dst));
+  blend = {unknown, unknown};
+}
+
+void GLState::blendEquation(GLenum mode) {
+  if (change(blendMode, mode)) GL(glBlendEquation(mode));
+}
+
+void GLState::depthMask(bool enabled) {
+  if (change(depthWrite, GLuint(enabled))) GL(glDepthMask(enabled ? GL_TRUE : GL_FALSE));
+}
+
+void GLState::depthFunc(GLenum func) {
+  if (change(depthTest, func)) GL(glDepthFunc(func));
+}
+
+void GLState::pointSize(float size) {
+  if (change(this->size, size)) GL(glPointSize(size));
+}
+
+void GLState::polygonMode(GLenum mode) {
+  if (change(polygon, mode)) GL(glPolygonMode(GL_FRONT_AND_BACK, mode));
+}
+
+void GLState::viewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+  if (change(view, std::array<GLint, 4>{x, y, width, height})) GL(glViewport(x, y, width, height));
+}
+
+void GLState::bufferDeleted(GLuint buffer) {
+  if (buffer == 0) return;
+  std::replace(buffers.begin(), buffers.end(), buffer, GLuint(0));
+}
+
+void GLState::textureDeleted(GLuint texture) {
+  if (texture == 0) return;
+  for (auto& unit : textures)
+    std::replace(unit.begin(), unit.end(), texture, GLuint(0));
+}
+
+void GLState::vertexArrayDeleted(GLuint vertexArray) {
+  if (vertexArray == 0 || this->vertexArray != vertexArray) return;
+  this->vertexArray = 0;
+  buffers[size_t(bufferSlot(GL_ELEMENT_ARRAY_BUFFER))] = unknown;
+}
+
+void GLState::programDeleted(GLuint program) {
+  // a program in use stays in use until another one is bound
+  if (program != 0 && this->program == program) this->program = unknown;
+}
+
+void GLState::invalidate() {
+  program = unknown;
+  vertexArray = unknown;
+  buffers.fill(unknown);
+  activeUnit = unknown;
+  for (auto& unit : textures) unit.fill(unknown);
+  caps.clear();
+  blend = {unknown, unknown};
+  blendMode = unknown;
+  depthWrite = unknown;
+  depthTest = unknown;
+  size = -1.0f;
+  polygon = unknown;
+  view = {0, 0, -1, -1};
+}
+
+void GLState::resetCounters() {
+  issued = 0;
+  elided = 0;
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include <cstdint>
+
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+
+// Shadow copy of the binding and fixed function state of the current GL
+// context. The Utils wrappers change state only through this class, so a
+// change to the value GL already has is skipped instead of issued. Every
+// entry starts out unknown and the first change is always issued. Code that
+// changes tracked state with plain GL calls has to call invalidate()
+// afterwards, GLApp does so before each frame and before flushing its
+// batched draws.
+class GLState {
+public:
+  // the state of the context current on the calling thread
+  static GLState& current();
+
+  void useProgram(GLuint program);
+  void bindVertexArray(GLuint vertexArray);
+  void bindBuffer(GLenum target, GLuint buffer);
+  // also replaces the generic binding of target
+  void bindBufferBase(GLenum target, GLuint index, GLuint buffer);
+  // unit is the index, not GL_TEXTURE0+index
+  void activeTexture(GLuint unit);
+  // binds to the active unit
+  void bindTexture(GLenum target, GLuint texture);
+  void bindTexture(GLuint unit, GLenum target, GLuint texture);
+
+  void enable(GLenum cap) {setEnabled(cap, true);}
+  void disable(GLenum cap) {setEnabled(cap, false);}
+  void setEnabled(GLenum cap, bool enabled);
+  // asks GL only if the state is unknown
+  bool isEnabled(GLenum cap);
+
+  void blendFunc(GLenum src, GLenum dst);
+  // blend function of a single draw buffer, leaves the common one unknown
+  void blendFunc(GLuint drawBuffer, GLenum src, GLenum dst);
+  void blendEquation(GLenum mode);
+  void depthMask(bool enabled);
+  void depthFunc(GLenum func);
+  void pointSize(float size);
+  void polygonMode(GLenum mode);
+  void viewport(GLint x, GLint y, GLsizei width, GLsizei height);
+
+  // deleting an object resets the bindings that refer to it
+  void bufferDeleted(GLuint buffer);
+  void textureDeleted(GLuint texture);
+  void vertexArrayDeleted(GLuint vertexArray);
+  void programDeleted(GLuint program);
+
+  // forgets everything, e.g. after changing state with plain GL calls
+  void invalidate();
+
+  // number of state changes passed on to GL and skipped
+  uint64_t getIssuedCount() const {return issued;}
+  uint64_t getElidedCount() const {return elided;}
+  void resetCounters();
+
+private:
+  static constexpr GLuint unknown = ~GLuint(0);
+  static constexpr size_t bufferTargetCount = 11;
+  static constexpr size_t textureTargetCount = 7;
+  static constexpr size_t textureUnitCount = 32;
+
+  struct Cap {
+    GLenum cap;
+    bool enabled;
+  };
+
+  GLuint program;
+  GLuint vertexArray;
+  std::array<GLuint, bufferTargetCount> buffers;
+  GLuint activeUnit;
+  std::array<std::array<GLuint, textureTargetCount>, textureUnitCount> textures;
+  std::vector<Cap> caps;              // only the caps with known state
+  std::array<GLenum, 2> blend;        // src, dst
+  GLenum blendMode;
+  GLuint depthWrite;                  // 0, 1 or unknown
+  GLenum depthTest;
+  float size;                         // negative while unknown
+  GLenum polygon;
+  std::array<GLint, 4> view;          // negative width while unknown
+
+  uint64_t issued;
+  uint64_t elided;
+
+  GLState();
+
+  // false and counted as elided if value is already current, otherwise
+  // value is stored and the caller issues the change
+  template <typename T>
+  bool change(T& cached, const T& value);
+
+  // index into the tracked targets, -1 for untracked ones
+  static int64_t bufferSlot(GLenum target);
+  static int64_t textureSlot(GLenum target);
+  Cap* findCap(GLenum cap);
+};
@@ -1,6 +1,7 @@
 #include <iostream>
 
 #include "GLTexture1D.h"
+#include "GLState.h"
 
 
 GLTexture1D::GLTexture1D(GLint magFilter, GLint minFilter, GLint wrapX) :
@@ -15,7 +16,7 @@ GLTexture1D::GLTexture1D(GLint magFilter, GLint minFilter, GLint wrapX) :
     componentCount(0)
 {
 	GL(glGenTextures(1, &id));
-	GL(glBindTexture(GL_TEXTURE_1D, id));
+	GLState::current().bindTexture(GL_TEXTURE_1D, id);
 	GL(glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_WRAP_S, wrapX));
 	GL(glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MAG_FILTER, magFilter));
 	GL(glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MIN_FILTER, minFilter));
@@ -32,7 +33,7 @@ GLTexture1D& GLTexture1D::operator=(GLTexture1D other) {
     minFilter = other.minFilter;
     wrapX = other.wrapX;
     
-    GL(glBindTexture(GL_TEXTURE_1D, id));
+    GLState::current().bindTexture(GL_TEXTURE_1D, id);
     GL(glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_WRAP_S, wrapX));
     GL(glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MAG_FILTER, magFilter));
     GL(glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MIN_FILTER, minFilter));
@@ -43,6 +44,7 @@ GLTexture1D& GLTexture1D::operator=(GLTexture1D other) {
 
 GLTexture1D::~GLTexture1D() {
 	GL(glDeleteTextures(1, &id));
+GLState::current().textureDeleted(id);
 }
 
 
@@ -60,7 +62,7 @@ void GLTexture1D::setData(const std::vector<GLubyte>& data, uint32_t size,
     this->size = size;
     this->componentCount = componentCount;
     
-	GL(glBindTexture(GL_TEXTURE_1D, id));
+	GLState::current().bindTexture(GL_TEXTURE_1D, id);
 
 	GL(glPixelStorei(GL_PACK_ALIGNMENT ,1));
 	GL(glPixelStorei(GL_UNPACK_ALIGNMENT ,1));
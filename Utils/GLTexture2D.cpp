@@ -2,6 +2,7 @@
 #include <sstream>
 
 #include "GLTexture2D.h"
+#include "GLState.h"
 
 GLTexture2D::GLTexture2D(GLint magFilter, GLint minFilter, GLint wrapX, GLint wrapY) :
   id(0),
@@ -18,7 +19,7 @@ GLTexture2D::GLTexture2D(GLint magFilter, GLint minFilter, GLint wrapX, GLint wr
   dataType(GLDataType::BYTE)
 {
   GL(glGenTextures(1, &id));
-  GL(glBindTexture(GL_TEXTURE_2D, id));
+  GLState::current().bindTexture(GL_TEXTURE_2D, id);
   GL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, wrapX));
   GL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, wrapY));
   GL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, magFilter));
@@ -37,13 +38,14 @@ void GLTexture2D::setFilter(GLint magFilter, GLint minFilter) {
   this->magFilter = magFilter;
   this->minFilter = minFilter;
   
-  GL(glBindTexture(GL_TEXTURE_2D, id));
+  GLState::current().bindTexture(GL_TEXTURE_2D, id);
   GL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, magFilter));
   GL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, minFilter));
 }
 
 GLTexture2D::~GLTexture2D() {
   GL(glDeleteTextures(1, &id));
+  GLState::current().textureDeleted(id);
 }
 
 GLTexture2D::GLTexture2D(const GLTexture2D& other) :
@@ -70,7 +72,7 @@ GLTexture2D& GLTexture2D::operator=(const GLTexture2D& other) {
   wrapX = other.wrapX;
   wrapY = other.wrapY;
 
-  GL(glBindTexture(GL_TEXTURE_2D, id));
+  GLState::current().bindTexture(GL_TEXTURE_2D, id);
   GL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, wrapX));
   GL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, wrapY));
   GL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, magFilter));
@@ -237,7 +239,7 @@ void GLTexture2D::setData(GLvoid* data, uint32_t width, uint32_t height, uint8_t
   this->height = height;
   this->componentCount = componentCount;
 
-  GL(glBindTexture(GL_TEXTURE_2D, id));
+  GLState::current().bindTexture(GL_TEXTURE_2D, id);
 
   GL(glPixelStorei(GL_PACK_ALIGNMENT ,1));
   GL(glPixelStorei(GL_UNPACK_ALIGNMENT ,1));
@@ -250,13 +252,13 @@ void GLTexture2D::setData(GLvoid* data, uint32_t width, uint32_t height, uint8_t
 
 void GLTexture2D::setPixel(const std::vector<GLubyte>& data, uint32_t x, uint32_t y) {  
   const GLTexInfo texInfo = dataTypeToGL(dataType, componentCount);
-  GL(glBindTexture(GL_TEXTURE_2D, id));
+  GLState::current().bindTexture(GL_TEXTURE_2D, id);
   glTexSubImage2D(GL_TEXTURE_2D,0,GLint(x),GLint(y),1,1, texInfo.format,
                   texInfo.type, data.data());
 }
 
 void GLTexture2D::generateMipmap() {
-  GL(glBindTexture(GL_TEXTURE_2D, id));
+  GLState::current().bindTexture(GL_TEXTURE_2D, id);
   GL(glGenerateMipmap(GL_TEXTURE_2D));
 }
 
@@ -267,7 +269,7 @@ Image GLTexture2D::getImage() {
 const std::vector<GLubyte>& GLTexture2D::getDataByte() {
   GL(glPixelStorei(GL_PACK_ALIGNMENT, 1));
   GL(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
-  GL(glBindTexture(GL_TEXTURE_2D, id));
+  GLState::current().bindTexture(GL_TEXTURE_2D, id);
   
   const GLTexInfo texInfo = dataTypeToGL(GLDataType::BYTE, componentCount);
   data.resize(componentCount*width*height);
@@ -278,7 +280,7 @@ const std::vector<GLubyte>& GLTexture2D::getDataByte() {
 const std::vector<GLhalf>& GLTexture2D::getDataHalf() {
   GL(glPixelStorei(GL_PACK_ALIGNMENT, 1));
   GL(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
-  GL(glBindTexture(GL_TEXTURE_2D, id));
+  GLState::current().bindTexture(GL_TEXTURE_2D, id);
 
   const GLTexInfo texInfo = dataTypeToGL(GLDataType::HALF, componentCount);
   hdata.resize(componentCount*width*height);
@@ -290,7 +292,7 @@ const std::vector<GLhalf>& GLTexture2D::getDataHalf() {
 const std::vector<GLfloat>& GLTexture2D::getDataFloat() {
   GL(glPixelStorei(GL_PACK_ALIGNMENT, 1));
   GL(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
-  GL(glBindTexture(GL_TEXTURE_2D, id));
+  GLState::current().bindTexture(GL_TEXTURE_2D, id);
 
   const GLTexInfo texInfo = dataTypeToGL(GLDataType::FLOAT, componentCount);
   hdata.resize(componentCount*width*height);
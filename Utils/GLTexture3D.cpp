@@ -1,4 +1,5 @@
 #include "GLTexture3D.h"
+#include "GLState.h"
 
 GLTexture3D::GLTexture3D(GLint magFilter, GLint minFilter, GLint wrapX, GLint wrapY, GLint wrapZ) :
   id(0),
@@ -17,7 +18,7 @@ GLTexture3D::GLTexture3D(GLint magFilter, GLint minFilter, GLint wrapX, GLint wr
   isFloat(false)
 {
   GL(glGenTextures(1, &id));
-  GL(glBindTexture(GL_TEXTURE_3D, id));
+  GLState::current().bindTexture(GL_TEXTURE_3D, id);
   GL(glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_S, wrapX));
   GL(glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_T, wrapY));
   GL(glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_R, wrapZ));
@@ -27,6 +28,7 @@ GLTexture3D::GLTexture3D(GLint magFilter, GLint minFilter, GLint wrapX, GLint wr
 
 GLTexture3D::~GLTexture3D() {
   GL(glDeleteTextures(1, &id));
+  GLState::current().textureDeleted(id);
 }
 
 GLTexture3D::GLTexture3D(const GLTexture3D& other) :
@@ -47,7 +49,7 @@ GLTexture3D& GLTexture3D::operator=(GLTexture3D other) {
     wrapY = other.wrapY;
     wrapZ = other.wrapZ;
 
-    GL(glBindTexture(GL_TEXTURE_3D, id));
+    GLState::current().bindTexture(GL_TEXTURE_3D, id);
     GL(glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_S, wrapX));
     GL(glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_T, wrapY));
     GL(glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MAG_FILTER, magFilter));
@@ -107,7 +109,7 @@ void GLTexture3D::setData(GLvoid* data, uint32_t width, uint32_t height,
   this->depth = depth;
   this->componentCount = componentCount;
 
-  GL(glBindTexture(GL_TEXTURE_3D, id));
+  GLState::current().bindTexture(GL_TEXTURE_3D, id);
 
   GL(glPixelStorei(GL_PACK_ALIGNMENT ,1));
   GL(glPixelStorei(GL_UNPACK_ALIGNMENT ,1));
@@ -138,7 +140,7 @@ void GLTexture3D::setData(GLvoid* data, uint32_t width, uint32_t height,
 const std::vector<GLubyte>& GLTexture3D::getDataByte() {
   GL(glPixelStorei(GL_PACK_ALIGNMENT, 1));
   GL(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
-  GL(glBindTexture(GL_TEXTURE_3D, id));
+  GLState::current().bindTexture(GL_TEXTURE_3D, id);
   GL(glGetTexImage(GL_TEXTURE_3D, 0, format, type, data.data()));
   return data;
 }
@@ -146,7 +148,7 @@ const std::vector<GLubyte>& GLTexture3D::getDataByte() {
 const std::vector<GLfloat>& GLTexture3D::getDataFloat() {
   GL(glPixelStorei(GL_PACK_ALIGNMENT, 1));
   GL(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
-  GL(glBindTexture(GL_TEXTURE_3D, id));
+  GLState::current().bindTexture(GL_TEXTURE_3D, id);
   GL(glGetTexImage(GL_TEXTURE_3D, 0, format, type, fdata.data()));
   return fdata;
 }
@@ -2,6 +2,7 @@
 #include <sstream>
 
 #include "GLTextureCube.h"
+#include "GLState.h"
 
 GLTextureCube::GLTextureCube(GLint magFilter, GLint minFilter, GLint wrapX, GLint wrapY, GLint wrapZ) :
   id(0),
@@ -19,7 +20,7 @@ GLTextureCube::GLTextureCube(GLint magFilter, GLint minFilter, GLint wrapX, GLin
   dataType(GLDataType::BYTE)
 {
   GL(glGenTextures(1, &id));
-  GL(glBindTexture(GL_TEXTURE_CUBE_MAP, id));
+  GLState::current().bindTexture(GL_TEXTURE_CUBE_MAP, id);
   GL(glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, wrapX));
   GL(glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, wrapY));
   GL(glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, wrapZ));
@@ -50,13 +51,14 @@ void GLTextureCube::setFilter(GLint magFilter, GLint minFilter) {
   this->magFilter = magFilter;
   this->minFilter = minFilter;
   
-  GL(glBindTexture(GL_TEXTURE_CUBE_MAP, id));
+  GLState::current().bindTexture(GL_TEXTURE_CUBE_MAP, id);
   GL(glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, magFilter));
   GL(glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, minFilter));
 }
 
 GLTextureCube::~GLTextureCube() {
   GL(glDeleteTextures(1, &id));
+  GLState::current().textureDeleted(id);
 }
 
 GLTextureCube::GLTextureCube(const GLTextureCube& other) :
@@ -86,7 +88,7 @@ GLTextureCube& GLTextureCube::operator=(const GLTextureCube& other) {
   wrapY = other.wrapY;
   wrapZ = other.wrapZ;
 
-  GL(glBindTexture(GL_TEXTURE_CUBE_MAP, id));
+  GLState::current().bindTexture(GL_TEXTURE_CUBE_MAP, id);
   GL(glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, wrapX));
   GL(glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, wrapY));
   GL(glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, wrapZ));
@@ -270,7 +272,7 @@ void GLTextureCube::setData(GLvoid* data, uint32_t width, uint32_t height,
   this->height = height;
   this->componentCount = componentCount;
 
-  GL(glBindTexture(GL_TEXTURE_CUBE_MAP, id));
+  GLState::current().bindTexture(GL_TEXTURE_CUBE_MAP, id);
 
   GL(glPixelStorei(GL_PACK_ALIGNMENT ,1));
   GL(glPixelStorei(GL_UNPACK_ALIGNMENT ,1));
@@ -283,6 +285,6 @@ void GLTextureCube::setData(GLvoid* data, uint32_t width, uint32_t height,
 }
 
 void GLTextureCube::generateMipmap() {
-  GL(glBindTexture(GL_TEXTURE_CUBE_MAP, id));
+  GLState::current().bindTexture(GL_TEXTURE_CUBE_MAP, id);
   GL(glGenerateMipmap(GL_TEXTURE_CUBE_MAP));
 }
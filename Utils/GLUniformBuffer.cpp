@@ -0,0 +1,104 @@
+#include <cstring>
+
+#include "GLUniformBuffer.h"
+#include "GLDebug.h"
+#include "GLState.h"
+
+GLUniformBuffer::GLUniformBuffer(GLuint binding) :
+  bufferID(0),
+  binding(binding)
+{
+  GL(glGenBuffers(1, &bufferID));
+}
+
+GLUniformBuffer::~GLUniformBuffer() {
+  GL(glDeleteBuffers(1, &bufferID));
+  GLState::current().bufferDeleted(bufferID);
+}
+
+void GLUniformBuffer::begin() {
+  data.clear();
+}
+
+void GLUniformBuffer::append(const void* value, size_t size, size_t alignment) {
+  data.resize((data.size()+alignment-1)/alignment*alignment, 0);
+  const uint8_t* bytes = static_cast<const uint8_t*>(value);
+  data.insert(data.end(), bytes, bytes+size);
+}
+
+void GLUniformBuffer::add(float value) {
+  append(&value, sizeof(value), 4);
+}
+
+void GLUniformBuffer::add(int value) {
+  append(&value, sizeof(value), 4);
+}
+
+void GLUniformBuffer::add(const Vec2& value) {
+  append(value, sizeof(value), 8);
+}
+
+void GLUniformBuffer::add(const Vec3& value) {
+  append(value, sizeof(value), 16);
+}
+
+void GLUniformBuffer::add(const Vec4& value) {
+  append(value, sizeof(value), 16);
+}
+
+void GLUniformBuffer::add(const Vec2i& value) {
+  append(value, sizeof(value), 8);
+}
+
+void GLUniformBuffer::add(const Vec4i& value) {
+  append(value, sizeof(value), 16);
+}
+
+void GLUniformBuffer::add(const Mat3& value) {
+  // column major, every column padded to a vec4
+  const float* m = value;
+  for (size_t c = 0;c<3;++c) add(Vec4{m[c], m[3+c], m[6+c], 0.0f});
+}
+
+void GLUniformBuffer::add(const Mat4& value) {
+  append(Mat4::transpose(value), sizeof(float)*16, 16);
+}
+
+void GLUniformBuffer::add(const std::vector<float>& value) {
+  // every array element takes up a vec4
+  for (const float v : value) add(Vec4{v, 0.0f, 0.0f, 0.0f});
+}
+
+void GLUniformBuffer::add(const std::vector<Vec4>& value) {
+  for (const Vec4& v : value) add(v);
+}
+
+void GLUniformBuffer::add(const std::vector<Mat4>& value) {
+  for (const Mat4& m : value) add(m);
+}
+
+void GLUniformBuffer::end() {
+  data.resize((data.size()+15)/16*16, 0);
+
+  if (data.size() != uploaded.size()) {
+    GLState::current().bindBuffer(GL_UNIFORM_BUFFER, bufferID);
+    GL(glBufferData(GL_UNIFORM_BUFFER, GLsizeiptr(data.size()), data.data(), GL_DYNAMIC_DRAW));
+    uploaded = data;
+  } else {
+    // only the range between the first and the last changed byte
+    size_t first = 0;
+    while (first < data.size() && data[first] == uploaded[first]) ++first;
+    if (first < data.size()) {
+      size_t last = data.size();
+      while (data[last-1] == uploaded[last-1]) --last;
+      GLState::current().bindBuffer(GL_UNIFORM_BUFFER, bufferID);
+      GL(glBufferSubData(GL_UNIFORM_BUFFER, GLintptr(first), GLsizeiptr(last-first), data.data()+first));
+      std::memcpy(uploaded.data()+first, data.data()+first, last-first);
+    }
+  }
+  bind();
+}
+
+void GLUniformBuffer::bind() const {
+  GLState::current().bindBufferBase(GL_UNIFORM_BUFFER, binding, bufferID);
+}
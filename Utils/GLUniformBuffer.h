@@ -0,0 +1,57 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+
+#include "Vec2.h"
+#include "Vec3.h"
+#include "Vec4.h"
+#include "Mat3.h"
+#include "Mat4.h"
+
+// Uniform buffer holding one std140 uniform block, for data such as camera
+// and light matrices that several programs share and that changes at most
+// once per frame. The members are added between begin and end in the order
+// of the block declaration and padded by the std140 rules, end uploads the
+// bytes that changed since the last upload. Programs are connected with
+// GLProgram::setUniformBuffer.
+class GLUniformBuffer {
+public:
+  GLUniformBuffer(GLuint binding);
+  ~GLUniformBuffer();
+
+  GLUniformBuffer(const GLUniformBuffer&) = delete;
+  GLUniformBuffer& operator=(const GLUniformBuffer&) = delete;
+
+  void begin();
+  void add(float value);
+  void add(int value);
+  void add(const Vec2& value);
+  void add(const Vec3& value);
+  void add(const Vec4& value);
+  void add(const Vec2i& value);
+  void add(const Vec4i& value);
+  void add(const Mat3& value);
+  void add(const Mat4& value);
+  void add(const std::vector<float>& value);
+  void add(const std::vector<Vec4>& value);
+  void add(const std::vector<Mat4>& value);
+  // uploads the block if it changed and binds it to its binding point
+  void end();
+
+  void bind() const;
+  GLuint getBinding() const {return binding;}
+  GLuint getId() const {return bufferID;}
+  size_t getSize() const {return uploaded.size();}
+
+private:
+  GLuint bufferID;
+  GLuint binding;
+  std::vector<uint8_t> data;
+  std::vector<uint8_t> uploaded;
+
+  void append(const void* value, size_t size, size_t alignment);
+};
@@ -0,0 +1,177 @@
+#include <cmath>
+#include <algorithm>
+
+#include "GPUParticleSystem.h"
+#include "GLDebug.h"
+#include "GLState.h"
+
+// floats per particle: position (3), color (4), velocity (3), remaining life
+// and lifetime (2), position and color come first so the state buffer can be
+// drawn directly
+static const size_t stateSize = 12;
+
+static std::string updateVsString{
+"#version 410\n"
+"uniform float dt;\n"
+"uniform vec3 acceleration;\n"
+"uniform float damping;\n"
+"uniform vec3 emitPosition;\n"
+"uniform vec3 emitColor;\n"
+"uniform float emitSpeed;\n"
+"uniform float emitLifetime;\n"
+"uniform int emitStart;\n"
+"uniform int emitCount;\n"
+"uniform int capacity;\n"
+"uniform int seed;\n"
+"in vec3 inPos;\n"
+"in vec4 inColor;\n"
+"in vec3 inVel;\n"
+"in vec2 inLife;\n"
+"out vec3 outPos;\n"
+"out vec4 outColor;\n"
+"out vec3 outVel;\n"
+"out vec2 outLife;\n"
+"uint hash(uint x) {\n"
+"    x ^= x >> 16; x *= 0x7feb352du;\n"
+"    x ^= x >> 15; x *= 0x846ca68bu;\n"
+"    return x ^ (x >> 16);\n"
+"}\n"
+"float random(inout uint state) {\n"
+"    state = hash(state);\n"
+"    return float(state >> 8) / 16777216.0;\n"
+"}\n"
+"void main() {\n"
+"    int slot = (gl_VertexID - emitStart + capacity) % capacity;\n"
+"    if (inLife.x <= 0.0 && slot < emitCount) {\n"
+"        uint state = hash(uint(gl_VertexID) ^ uint(seed));\n"
+"        float z = random(state)*2.0-1.0;\n"
+"        float phi = random(state)*6.2831853;\n"
+"        float r = sqrt(1.0-z*z);\n"
+"        vec3 color = emitColor;\n"
+"        if (emitColor.r < -1.5) {\n"
+"            float h = random(state)*6.0;\n"
+"            color = clamp(abs(mod(h+vec3(0.0,4.0,2.0),6.0)-3.0)-1.0,0.0,1.0);\n"
+"        } else if (emitColor.r < 0.0) {\n"
+"            color = vec3(random(state), random(state), random(state));\n"
+"        }\n"
+"        outPos = emitPosition;\n"
+"        outColor = vec4(color, 1.0);\n"
+"        outVel = vec3(r*cos(phi), r*sin(phi), z)*emitSpeed;\n"
+"        outLife = vec2(emitLifetime, emitLifetime);\n"
+"    } else if (inLife.x <= 0.0) {\n"
+"        outPos = inPos;\n"
+"        outColor = vec4(inColor.rgb, 0.0);\n"
+"        outVel = inVel;\n"
+"        outLife = inLife;\n"
+"    } else {\n"
+"        vec3 vel = inVel*damping + acceleration*dt;\n"
+"        float life = inLife.x - dt;\n"
+"        outPos = inPos + vel*dt;\n"
+"        outColor = vec4(inColor.rgb, max(0.0, life/max(inLife.y, 1e-6)));\n"
+"        outVel = vel;\n"
+"        outLife = vec2(life, inLife.y);\n"
+"    }\n"
+"}\n"};
+
+GPUParticleSystem::GPUParticleSystem(size_t capacity, float pointSize,
+                                     float refDepth) :
+  AbstractParticleSystem(pointSize, refDepth),
+  capacity(capacity),
+  updateProg{GLProgram::createTransformFeedback(updateVsString,
+                                                {"outPos", "outColor",
+                                                 "outVel", "outLife"})},
+  state{GLBuffer{GL_ARRAY_BUFFER}, GLBuffer{GL_ARRAY_BUFFER}},
+  current(0),
+  emitPosition{0.0f,0.0f,0.0f},
+  emitColor(RANDOM_COLOR),
+  emitSpeed(1.0f),
+  emitLifetime(1.0f),
+  emissionRate(0.0f),
+  acceleration{0.0f,0.0f,0.0f},
+  drag(0.0f),
+  emitAccumulator(0.0f),
+  pending(0),
+  emitCursor(0),
+  seed(0),
+  lastTime(0.0f),
+  started(false)
+{
+  // all particles start out dead
+  const std::vector<float> empty(capacity*stateSize, 0.0f);
+  for (size_t i = 0;i<state.size();++i) {
+    state[i].setData(empty, stateSize, GL_DYNAMIC_COPY);
+    updateArray[i].connectVertexAttrib(state[i], updateProg, "inPos", 3, 0);
+    updateArray[i].connectVertexAttrib(state[i], updateProg, "inColor", 4, 3);
+    updateArray[i].connectVertexAttrib(state[i], updateProg, "inVel", 3, 7);
+    updateArray[i].connectVertexAttrib(state[i], updateProg, "inLife", 2, 10);
+    renderArray[i].connectVertexAttrib(state[i], getProgram(), "vPos", 3, 0);
+    renderArray[i].connectVertexAttrib(state[i], getProgram(), "vColor", 4, 3);
+  }
+}
+
+void GPUParticleSystem::update(float t) {
+  const float dt = started ? t-lastTime : 0.0f;
+  lastTime = t;
+  started = true;
+  if (capacity == 0 || dt <= 0.0f) return;
+
+  emitAccumulator += emissionRate*dt;
+  const size_t emitCount = std::min(capacity, pending + size_t(emitAccumulator));
+  emitAccumulator -= std::floor(emitAccumulator);
+  pending = 0;
+
+  updateProg.enable();
+  updateProg.setUniform("dt", dt);
+  updateProg.setUniform("acceleration", acceleration);
+  updateProg.setUniform("damping", std::pow(std::max(0.0f, 1.0f-drag), dt));
+  updateProg.setUniform("emitPosition", emitPosition);
+  updateProg.setUniform("emitColor", emitColor);
+  updateProg.setUniform("emitSpeed", emitSpeed);
+  updateProg.setUniform("emitLifetime", emitLifetime);
+  updateProg.setUniform("emitStart", int(emitCursor));
+  updateProg.setUniform("emitCount", int(emitCount));
+  updateProg.setUniform("capacity", int(capacity));
+  updateProg.setUniform("seed", int(++seed * 2654435761u));
+
+  const size_t next = 1-current;
+  GLState::current().enable(GL_RASTERIZER_DISCARD);
+  updateArray[current].bind();
+  state[next].bindBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0);
+  GL(glBeginTransformFeedback(GL_POINTS));
+  GL(glDrawArrays(GL_POINTS, 0, GLsizei(capacity)));
+  GL(glEndTransformFeedback());
+  GLState::current().bindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, 0);
+  GLState::current().disable(GL_RASTERIZER_DISCARD);
+
+  emitCursor = (emitCursor + emitCount) % capacity;
+  current = next;
+}
+
+void GPUParticleSystem::render(const Mat4& v, const Mat4& p) {
+  if (capacity == 0) return;
+
+  // the particles never reach the CPU, so they cannot be sorted
+  const ParticleBlendMode mode = getBlendMode() == ParticleBlendMode::SORTED ?
+    ParticleBlendMode::WEIGHTED_OIT : getBlendMode();
+  beginRender(v, p, mode);
+  renderArray[current].bind();
+  GL(glDrawArrays(GL_POINTS, 0, GLsizei(capacity)));
+  endRender(mode);
+}
+
+std::vector<float> GPUParticleSystem::getData() const {
+  std::vector<float> particles(capacity*stateSize);
+  state[current].bind();
+  GL(glGetBufferSubData(GL_ARRAY_BUFFER, 0,
+                        GLsizeiptr(particles.size()*sizeof(float)),
+                        particles.data()));
+
+  // position and color of every particle like the CPU systems
+  std::vector<float> data(capacity*7);
+  for (size_t i = 0;i<capacity;++i) {
+    std::copy(particles.begin()+int64_t(i*stateSize),
+              particles.begin()+int64_t(i*stateSize+7),
+              data.begin()+int64_t(i*7));
+  }
+  return data;
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <array>
+
+#include "Vec3.h"
+#include "AbstractParticleSystem.h"
+
+// Particle system simulated entirely on the GPU. The particle state lives in
+// two buffers that are swapped every update, a vertex shader advances every
+// particle from one buffer into the other with transform feedback, so the
+// CPU never touches particle data. Dead particles are respawned by the
+// emitter, which walks over the slots as a ring.
+class GPUParticleSystem : public AbstractParticleSystem {
+public:
+  GPUParticleSystem(size_t capacity, float pointSize, float refDepth=1.0f);
+  virtual ~GPUParticleSystem() {}
+
+  // t is the absolute time in seconds, the first call only sets the clock
+  virtual void update(float t) override;
+  virtual void render(const Mat4& v, const Mat4& p) override;
+
+  // color of particles emitted from now on, RANDOM_COLOR and RAINBOW_COLOR
+  // pick a new color for every particle
+  virtual void setColor(const Vec3& color) override {emitColor = color;}
+
+  void setEmitterPosition(const Vec3& position) {emitPosition = position;}
+  const Vec3& getEmitterPosition() const {return emitPosition;}
+  // particles emitted per second
+  void setEmissionRate(float rate) {emissionRate = rate;}
+  float getEmissionRate() const {return emissionRate;}
+  void setSpeed(float speed) {emitSpeed = speed;}
+  float getSpeed() const {return emitSpeed;}
+  void setLifetime(float lifetime) {emitLifetime = lifetime;}
+  float getLifetime() const {return emitLifetime;}
+  void setAcceleration(const Vec3& acceleration) {this->acceleration = acceleration;}
+  const Vec3& getAcceleration() const {return acceleration;}
+  // fraction of the velocity lost per second
+  void setDrag(float drag) {this->drag = drag;}
+  float getDrag() const {return drag;}
+
+  // emits up to count additional particles with the next update
+  void emit(size_t count) {pending += count;}
+
+  // reads the particles back from the GPU, meant for debugging
+  virtual std::vector<float> getData() const override;
+  virtual size_t getParticleCount() const override {return capacity;}
+
+private:
+  size_t capacity;
+  GLProgram updateProg;
+  std::array<GLBuffer, 2> state;
+  std::array<GLArray, 2> updateArray;
+  std::array<GLArray, 2> renderArray;
+  size_t current;
+
+  Vec3 emitPosition;
+  Vec3 emitColor;
+  float emitSpeed;
+  float emitLifetime;
+  float emissionRate;
+  Vec3 acceleration;
+  float drag;
+
+  float emitAccumulator;
+  size_t pending;
+  size_t emitCursor;
+  uint32_t seed;
+  float lastTime;
+  bool started;
+};
@@ -112,6 +112,16 @@ float Grid2D::sample(float x, float y) const {
   return (va * (1.0f-alpha) + vb * alpha) * (1.0f-beta) + (vc * (1.0f-alpha) + vd * alpha) * beta;
 }
 
+// the average of the two triangle normals
+// cross((1/w,vb-va,0),(0,vc-va,1/h)) and cross((-1/w,vc-vd,0),(0,vb-vd,-1/h))
+// expanded so no cross products are needed
+Vec3 Grid2D::cellNormal(float va, float vb, float vc, float vd,
+                        float width, float height) {
+  return Vec3::normalize(Vec3(((vb-va) + (vd-vc)) / height,
+                              -2.0f / (width*height),
+                              ((vc-va) + (vd-vb)) / width));
+}
+
 Vec3 Grid2D::normal(const Vec2& pos) const {
   return normal(pos.x, pos.y);
 }
@@ -133,10 +143,99 @@ Vec3 Grid2D::normal(float x, float y) const {
   float vc = getValue(c.x, c.y);
   float vd = getValue(d.x, d.y);
 
-  Vec3 n1 = Vec3::cross(Vec3(1.0f/width,(vb-va), 0.0f), Vec3(0.0f,(vc-va), 1.0f/height ));
-  Vec3 n2 = Vec3::cross(Vec3(-1.0f/width,(vc - vd), 0.0f), Vec3(0.0f, (vb - vd), -1.0f/height));
+  return cellNormal(va, vb, vc, vd, float(width), float(height));
+}
+
+void Grid2D::sampleBatch(const Vec2* positions, float* values,
+                         size_t count) const {
+  const float* d = data.data();
+  const size_t w = width;
+  const float sw = float(width-1);
+  const float sh = float(height-1);
+  const int64_t n = int64_t(count);
+  #pragma omp parallel for simd schedule(static) if(n > 4096)
+  for (int64_t i = 0;i<n;++i) {
+    const float sx = std::max(std::min(positions[i].x,1.0f), 0.0f) * sw;
+    const float sy = std::max(std::min(positions[i].y,1.0f), 0.0f) * sh;
+    const float alpha = sx - floorf(sx);
+    const float beta  = sy - floorf(sy);
+    const size_t x0 = size_t(floorf(sx));
+    const size_t x1 = size_t(ceilf(sx));
+    const size_t r0 = size_t(floorf(sy))*w;
+    const size_t r1 = size_t(ceilf(sy))*w;
+    values[i] = (d[r0+x0] * (1.0f-alpha) + d[r0+x1] * alpha) * (1.0f-beta) +
+                (d[r1+x0] * (1.0f-alpha) + d[r1+x1] * alpha) * beta;
+  }
+}
+
+std::vector<float> Grid2D::sampleBatch(const std::vector<Vec2>& positions) const {
+  std::vector<float> values(positions.size());
+  sampleBatch(positions.data(), values.data(), positions.size());
+  return values;
+}
+
+void Grid2D::normalBatch(const Vec2* positions, Vec3* normals,
+                         size_t count) const {
+  const float* d = data.data();
+  const size_t w = width;
+  const float fw = float(width);
+  const float fh = float(height);
+  const int64_t n = int64_t(count);
+  #pragma omp parallel for schedule(static) if(n > 4096)
+  for (int64_t i = 0;i<n;++i) {
+    const float sx = std::max(std::min(positions[i].x,1.0f), 0.0f) * (fw-1);
+    const float sy = std::max(std::min(positions[i].y,1.0f), 0.0f) * (fh-1);
+    const size_t x0 = size_t(floorf(sx));
+    const size_t x1 = size_t(ceilf(sx));
+    const size_t r0 = size_t(floorf(sy))*w;
+    const size_t r1 = size_t(ceilf(sy))*w;
+    normals[i] = cellNormal(d[r0+x0], d[r0+x1], d[r1+x0], d[r1+x1], fw, fh);
+  }
+}
+
+std::vector<Vec3> Grid2D::normalBatch(const std::vector<Vec2>& positions) const {
+  std::vector<Vec3> normals(positions.size());
+  normalBatch(positions.data(), normals.data(), positions.size());
+  return normals;
+}
+
+std::vector<Vec3> Grid2D::normalMap() const {
+  std::vector<Vec3> normals(width*height);
+  const int64_t w = int64_t(width);
+  const int64_t h = int64_t(height);
+  const float scaleX = 1.0f/float(width);
+  const float scaleY = 1.0f/float(height);
+  #pragma omp parallel for schedule(static)
+  for (int64_t y = 0;y<h;++y) {
+    const float* row = data.data() + y*w;
+    const float* up = data.data() + std::max<int64_t>(y-1, 0)*w;
+    const float* down = data.data() + std::min<int64_t>(y+1, h-1)*w;
+    const float dy = (y > 0 && y < h-1) ? 0.5f : 1.0f;
+    for (int64_t x = 0;x<w;++x) {
+      const int64_t l = std::max<int64_t>(x-1, 0);
+      const int64_t r = std::min<int64_t>(x+1, w-1);
+      const float dx = (x > 0 && x < w-1) ? 0.5f : 1.0f;
+      const float gx = (row[r] - row[l]) * dx;
+      const float gy = (down[x] - up[x]) * dy;
+      normals[size_t(y*w+x)] = Vec3::normalize(Vec3(gx*scaleY,
+                                                    -scaleX*scaleY,
+                                                    gy*scaleX));
+    }
+  }
+  return normals;
+}
 
-  return Vec3::normalize((n1 + n2) / 2.0f);
+GLTexture2D Grid2D::toNormalTexture() const {
+  const std::vector<Vec3> normals = normalMap();
+  std::vector<float> rgb(normals.size()*3);
+  for (size_t i = 0;i<normals.size();++i) {
+    rgb[i*3+0] = normals[i].x;
+    rgb[i*3+1] = normals[i].y;
+    rgb[i*3+2] = normals[i].z;
+  }
+  GLTexture2D result;
+  result.setData(rgb, uint32_t(width), uint32_t(height), 3);
+  return result;
 }
 
 Grid2D Grid2D::genRandom(size_t x, size_t y, uint32_t seed) {
@@ -156,231 +255,6 @@ Grid2D Grid2D::genRandom(size_t x, size_t y) {
   return result;
 }
 
-Grid2D Grid2D::operator*(const float& value) const {
-  Grid2D result{width,height};
-  for (size_t i = 0;i<result.data.size();++i) {
-    result.data[i] = data[i]*value;
-  }
-  return result;
-}
-
-Grid2D Grid2D::operator+(const float& value) const {
-  Grid2D result{width,height};
-  for (size_t i = 0;i<result.data.size();++i) {
-    result.data[i] = data[i]+value;
-  }
-  return result;
-}
-
-Grid2D Grid2D::operator-(const float& value) const {
-  Grid2D result{width,height};
-  for (size_t i = 0;i<result.data.size();++i) {
-    result.data[i] = data[i]-value;
-  }
-  return result;
-}
-
-Grid2D Grid2D::operator/(const float& value) const {
-  return *this * (1.0f/value);
-}
-
-std::pair<size_t,size_t> Grid2D::findMaxSize(const Grid2D& other) const {
-  return std::make_pair(std::max(width, other.width),
-                        std::max(height, other.height));
-}
-
-
-Grid2D Grid2D::operator-(const Grid2D& other) const {
-  std::pair<size_t,size_t> maxDims = findMaxSize(other);
-  Grid2D result{maxDims.first,maxDims.second};
-  
-  if (other.width == width && other.height == height) {
-    for (size_t i = 0;i<result.data.size();++i) {
-      result.data[i] = data[i] - other.data[i];
-    }
-    return result;
-  }
-    
-  size_t i=0;
-
-  if (maxDims.first == width && maxDims.second == height) {
-    for (size_t y = 0;y<maxDims.second;++y) {
-      const float normY = y/float(maxDims.second-1.0f);
-      for (size_t x = 0;x<maxDims.first;++x) {
-        const float normX = x/float(maxDims.first-1.0f);
-        result.data[i] = data[i] - other.sample(normX,normY);
-        i++;
-      }
-    }
-    return result;
-  }
-  
-  if (maxDims.first == other.width && maxDims.second == other.height) {
-    for (size_t y = 0;y<maxDims.second;++y) {
-      const float normY = y/float(maxDims.second-1.0f);
-      for (size_t x = 0;x<maxDims.first;++x) {
-        const float normX = x/float(maxDims.first-1.0f);
-        result.data[i] = other.data[i] - sample(normX,normY);
-        i++;
-      }
-    }
-    return result;
-  }
-
-  for (size_t y = 0;y<maxDims.second;++y) {
-    const float normY = y/float(maxDims.second-1.0f);
-    for (size_t x = 0;x<maxDims.first;++x) {
-      const float normX = x/float(maxDims.first-1.0f);
-      result.data[i] = other.sample(normX, normY) - sample(normX,normY);
-      i++;
-    }
-  }
-  return result;
-}
-
-Grid2D Grid2D::operator*(const Grid2D& other) const {
-  std::pair<size_t,size_t> maxDims = findMaxSize(other);
-  Grid2D result{maxDims.first,maxDims.second};
-  
-  if (other.width == width && other.height == height) {
-    for (size_t i = 0;i<result.data.size();++i) {
-      result.data[i] = data[i] * other.data[i];
-    }
-    return result;
-  }
-    
-  size_t i=0;
-
-  if (maxDims.first == width && maxDims.second == height) {
-    for (size_t y = 0;y<maxDims.second;++y) {
-      const float normY = y/float(maxDims.second-1.0f);
-      for (size_t x = 0;x<maxDims.first;++x) {
-        const float normX = x/float(maxDims.first-1.0f);
-        result.data[i] = data[i] * other.sample(normX,normY);
-        i++;
-      }
-    }
-    return result;
-  }
-  
-  if (maxDims.first == other.width && maxDims.second == other.height) {
-    for (size_t y = 0;y<maxDims.second;++y) {
-      const float normY = y/float(maxDims.second-1.0f);
-      for (size_t x = 0;x<maxDims.first;++x) {
-        const float normX = x/float(maxDims.first-1.0f);
-        result.data[i] = other.data[i] * sample(normX,normY);
-        i++;
-      }
-    }
-    return result;
-  }
-
-  for (size_t y = 0;y<maxDims.second;++y) {
-    const float normY = y/float(maxDims.second-1.0f);
-    for (size_t x = 0;x<maxDims.first;++x) {
-      const float normX = x/float(maxDims.first-1.0f);
-      result.data[i] = other.sample(normX, normY) * sample(normX,normY);
-      i++;
-    }
-  }
-  return result;
-}
-
-Grid2D Grid2D::operator/(const Grid2D& other) const {
-  std::pair<size_t,size_t> maxDims = findMaxSize(other);
-  Grid2D result{maxDims.first,maxDims.second};
-  
-  if (other.width == width && other.height == height) {
-    for (size_t i = 0;i<result.data.size();++i) {
-      result.data[i] = data[i] / other.data[i];
-    }
-    return result;
-  }
-    
-  size_t i=0;
-
-  if (maxDims.first == width && maxDims.second == height) {
-    for (size_t y = 0;y<maxDims.second;++y) {
-      const float normY = y/float(maxDims.second-1.0f);
-      for (size_t x = 0;x<maxDims.first;++x) {
-        const float normX = x/float(maxDims.first-1.0f);
-        result.data[i] = data[i] / other.sample(normX,normY);
-        i++;
-      }
-    }
-    return result;
-  }
-  
-  if (maxDims.first == other.width && maxDims.second == other.height) {
-    for (size_t y = 0;y<maxDims.second;++y) {
-      const float normY = y/float(maxDims.second-1.0f);
-      for (size_t x = 0;x<maxDims.first;++x) {
-        const float normX = x/float(maxDims.first-1.0f);
-        result.data[i] = other.data[i] / sample(normX,normY);
-        i++;
-      }
-    }
-    return result;
-  }
-
-  for (size_t y = 0;y<maxDims.second;++y) {
-    const float normY = y/float(maxDims.second-1.0f);
-    for (size_t x = 0;x<maxDims.first;++x) {
-      const float normX = x/float(maxDims.first-1.0f);
-      result.data[i] = other.sample(normX, normY) / sample(normX,normY);
-      i++;
-    }
-  }
-  return result;
-}
-
-Grid2D Grid2D::operator+(const Grid2D& other) const {
-  std::pair<size_t,size_t> maxDims = findMaxSize(other);
-  Grid2D result{maxDims.first,maxDims.second};
-  
-  if (other.width == width && other.height == height) {
-    for (size_t i = 0;i<result.data.size();++i) {
-      result.data[i] = data[i] + other.data[i];
-    }
-    return result;
-  }
-    
-  size_t i=0;
-  if (maxDims.first == width && maxDims.second == height) {
-    for (size_t y = 0;y<maxDims.second;++y) {
-      const float normY = y/float(maxDims.second-1.0f);
-      for (size_t x = 0;x<maxDims.first;++x) {
-        const float normX = x/float(maxDims.first-1.0f);
-        result.data[i] = data[i] + other.sample(normX,normY);
-        i++;
-      }
-    }
-    return result;
-  }
-  
-  if (maxDims.first == other.width && maxDims.second == other.height) {
-    for (size_t y = 0;y<maxDims.second;++y) {
-      const float normY = y/float(maxDims.second-1.0f);
-      for (size_t x = 0;x<maxDims.first;++x) {
-        const float normX = x/float(maxDims.first-1.0f);
-        result.data[i] = other.data[i] + sample(normX,normY);
-        i++;
-      }
-    }
-    return result;
-  }
-
-  for (size_t y = 0;y<maxDims.second;++y) {
-    const float normY = y/float(maxDims.second-1.0f);
-    for (size_t x = 0;x<maxDims.first;++x) {
-      const float normX = x/float(maxDims.first-1.0f);
-      result.data[i] = other.sample(normX, normY) + sample(normX,normY);
-      i++;
-    }
-  }
-  return result;
-}
-    
 void Grid2D::normalize(const float maxVal) {
   if (data.empty()) return;
   
@@ -465,96 +339,102 @@ void Grid2D::save(std::ostream &os) const {
            uint32_t(height));
 }
 
-static const float d1{1.0f};
-static const float d2{1.4142135624f};
-
 static const float INV = std::numeric_limits<float>::max();
-static const Vec2ui NO_POS{std::numeric_limits<uint32_t>::max(),
-                    std::numeric_limits<uint32_t>::max()};
-static float dist(size_t x, size_t y, const Vec2ui& p) {
-  return sqrtf( (x-float(p.x))*(x-float(p.x)) +
-                (y-float(p.y))*(y-float(p.y)));
+static const float FAR = 1e20f;
+
+// exact 1D squared distance transform of the sampled function f, computed
+// as the lower envelope of parabolas (Felzenszwalb & Huttenlocher); v and z
+// are scratch buffers of size n and n+1
+static void distanceTransform1D(const float* f, float* d, int64_t n,
+                                int64_t* v, float* z) {
+  int64_t k = 0;
+  v[0] = 0;
+  z[0] = -std::numeric_limits<float>::infinity();
+  z[1] =  std::numeric_limits<float>::infinity();
+  for (int64_t q = 1;q<n;++q) {
+    float s = ((f[q]+float(q*q)) - (f[v[k]]+float(v[k]*v[k]))) / float(2*q-2*v[k]);
+    while (s <= z[k]) {
+      k--;
+      s = ((f[q]+float(q*q)) - (f[v[k]]+float(v[k]*v[k]))) / float(2*q-2*v[k]);
+    }
+    k++;
+    v[k] = q;
+    z[k] = s;
+    z[k+1] = std::numeric_limits<float>::infinity();
+  }
+  k = 0;
+  for (int64_t q = 0;q<n;++q) {
+    while (z[k+1] < float(q)) k++;
+    d[q] = float((q-v[k])*(q-v[k])) + f[v[k]];
+  }
 }
 
 Grid2D Grid2D::toSignedDistance(float threshold) const {
   Grid2D r(width, height);
-  
-  std::vector<bool> I(width*height);
-  std::vector<Vec2ui> p(width*height);
-  
+  if (data.empty()) return r;
+
+  const int64_t w = int64_t(width);
+  const int64_t h = int64_t(height);
+
+  std::vector<uint8_t> I(data.size());
   for (size_t i = 0;i<I.size();++i) {
     I[i] = data[i] >= threshold;
   }
 
-  for (size_t i = 0;i<I.size();++i) {
-    r.data[i] = INV;
-    p[i] = NO_POS;
-  }
-  
-  for (size_t y = 1; y<height-1; y++ ) {
-    for (size_t x = 1; x<width-1; x++ ) {
-      const size_t i = index(x,y);
-      if (I[index(x-1,y)] != I[i] ||
-          I[index(x+1,y)] != I[i] ||
-          I[index(x,y+1)] != I[i] ||
-          I[index(x,y-1)] != I[i]) {
-        r.data[i] = 0;
-        p[i] = Vec2ui(uint32_t(x),uint32_t(y));
-      }
+  // cells with a 4-neighbour of the other class form the zero set
+  #pragma omp parallel for schedule(static)
+  for (int64_t y = 0; y<h; y++ ) {
+    for (int64_t x = 0; x<w; x++ ) {
+      const size_t i = index(size_t(x),size_t(y));
+      const bool edge = (x > 0   && I[i-1] != I[i]) ||
+                        (x < w-1 && I[i+1] != I[i]) ||
+                        (y > 0   && I[i-width] != I[i]) ||
+                        (y < h-1 && I[i+width] != I[i]);
+      r.data[i] = edge ? 0.0f : FAR;
     }
   }
- 
-  for (size_t y = 1; y<height-1; y++ ) {
-    for (size_t x = 1; x<width-1; x++ ) {
-      const size_t i = index(x,y);
-      if (r.data[index(x-1,y-1)]+d2 < r.data[i]) {
-        p[i] = p[index(x-1,y-1)];
-        r.data[i] = dist(x, y, p[i]);
-      }
-      if (r.data[index(x,y-1)]+d1 < r.data[i]) {
-        p[i] = p[index(x,y-1)];
-        r.data[i] = dist(x, y, p[i]);
-      }
-      if (r.data[index(x+1,y-1)]+d2 < r.data[i]) {
-        p[i] = p[index(x+1,y-1)];
-        r.data[i] = dist(x, y, p[i]);
-      }
-      if (r.data[index(x-1,y)]+d1 < r.data[i]) {
-        p[i] = p[index(x-1,y)];
-        r.data[i] = dist(x, y, p[i]);
-      }
+
+  // separable squared EDT, first along the rows then along the columns
+  #pragma omp parallel
+  {
+    const size_t n = size_t(std::max(w,h));
+    std::vector<float> f(n), d(n), z(n+1);
+    std::vector<int64_t> v(n);
+
+    #pragma omp for schedule(static)
+    for (int64_t y = 0; y<h; y++ ) {
+      float* row = r.data.data() + y*w;
+      std::copy(row, row+w, f.begin());
+      distanceTransform1D(f.data(), row, w, v.data(), z.data());
     }
-  }
-  
-  for (size_t y = height-2; y>=1; y-- ) {
-    for (size_t x = width-2; x>=1; x--) {
-      const size_t i = index(x,y);
-      if (r.data[index(x+1,y)]+d1 < r.data[i]) {
-        p[i] = p[index(x+1,y)];
-        r.data[i] = dist(x, y, p[i]);
-      }
-      if (r.data[index(x-1,y+1)]+d2 < r.data[i]) {
-        p[i] = p[index(x-1,y+1)];
-        r.data[i] = dist(x, y, p[i]);
-      }
-      if (r.data[index(x,y+1)]+d1 < r.data[i]) {
-        p[i] = p[index(x,y+1)];
-        r.data[i] = dist(x, y, p[i]);
-      }
-      if (r.data[index(x+1,y+1)]+d2 < r.data[i]) {
-        p[i] = p[index(x+1,y+1)];
-        r.data[i] = dist(x, y, p[i]);
-      }
+
+    #pragma omp for schedule(static)
+    for (int64_t x = 0; x<w; x++ ) {
+      for (int64_t y = 0; y<h; y++ ) f[size_t(y)] = r.data[size_t(x+y*w)];
+      distanceTransform1D(f.data(), d.data(), h, v.data(), z.data());
+      for (int64_t y = 0; y<h; y++ ) r.data[size_t(x+y*w)] = d[size_t(y)];
     }
   }
-  
-  for (size_t i = 0;i<I.size();++i) {
-    if (!I[i]) r.data[i] = -r.data[i];
+
+  #pragma omp parallel for simd schedule(static)
+  for (int64_t i = 0;i<int64_t(I.size());++i) {
+    const float dist = (r.data[size_t(i)] >= FAR/2) ? INV : sqrtf(r.data[size_t(i)]);
+    r.data[size_t(i)] = I[size_t(i)] ? dist : -dist;
   }
-  
+
   return r;
 }
 
+std::vector<Grid2D> Grid2D::toSignedDistance(const std::vector<Grid2D>& grids,
+                                             float threshold) {
+  std::vector<Grid2D> result(grids.size(), Grid2D{0,0});
+  #pragma omp parallel for schedule(dynamic)
+  for (int64_t i = 0;i<int64_t(grids.size());++i) {
+    result[size_t(i)] = grids[size_t(i)].toSignedDistance(threshold);
+  }
+  return result;
+}
+
 GLTexture2D Grid2D::toTexture() const {
   GLTexture2D result;
   result.setData(data, uint32_t(width), uint32_t(height), 1);
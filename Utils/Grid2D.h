@@ -3,11 +3,13 @@
 #include <iostream>
 #include <string>
 #include <vector>
+#include <type_traits>
 
 #include "Vec2.h"
 #include "Vec3.h"
 #include "Image.h"
 #include "GLTexture2D.h"
+#include "Grid2DExpression.h"
 
 class Grid2D {
 public:
@@ -15,7 +17,14 @@ public:
   Grid2D(size_t width, size_t height, const std::vector<float> data);
   
   Grid2D(const Grid2D& other);
+  Grid2D(Grid2D&& other) = default;
+  Grid2D& operator=(const Grid2D& other) = default;
+  Grid2D& operator=(Grid2D&& other) = default;
   Grid2D(const Image& image);
+
+  // evaluates a lazy expression such as (a*b+c)/d in a single pass
+  template <typename E>
+  Grid2D(const GridExpression<E>& expression);
   
   Grid2D(std::istream &is);
   void save(std::ostream &os) const;
@@ -25,6 +34,8 @@ public:
   std::string toString() const;
   std::vector<uint8_t> toByteArray() const;
   Grid2D toSignedDistance(float threshold) const;
+  static std::vector<Grid2D> toSignedDistance(const std::vector<Grid2D>& grids,
+                                              float threshold);
   GLTexture2D toTexture() const;
 
   void setValue(size_t x, size_t y, float value);
@@ -36,17 +47,29 @@ public:
   Vec3 normal(float x, float y) const;
   Vec3 normal(const Vec2& pos) const;
 
+  // normal of a bilinear cell of size width x height with the corner values
+  // va (x0,y0), vb (x1,y0), vc (x0,y1) and vd (x1,y1)
+  static Vec3 cellNormal(float va, float vb, float vc, float vd,
+                         float width, float height);
+
+  // batch versions of sample/normal for count positions, evaluated in
+  // parallel, results are identical to the scalar calls
+  void sampleBatch(const Vec2* positions, float* values, size_t count) const;
+  std::vector<float> sampleBatch(const std::vector<Vec2>& positions) const;
+  void normalBatch(const Vec2* positions, Vec3* normals, size_t count) const;
+  std::vector<Vec3> normalBatch(const std::vector<Vec2>& positions) const;
+
+  // one normal per grid point from central differences, oriented like
+  // normal(), as a vector or as an RGB float texture
+  std::vector<Vec3> normalMap() const;
+  GLTexture2D toNormalTexture() const;
+
   static Grid2D genRandom(size_t x, size_t y);
   static Grid2D genRandom(size_t x, size_t y, uint32_t seed);
-  Grid2D operator*(const float& value) const;
-  Grid2D operator/(const float& value) const;
-  Grid2D operator+(const float& value) const;
-  Grid2D operator-(const float& value) const;
-
-  Grid2D operator+(const Grid2D& other) const;
-  Grid2D operator/(const Grid2D& other) const;
-  Grid2D operator*(const Grid2D& other) const;
-  Grid2D operator-(const Grid2D& other) const;
+
+  const std::vector<float>& getData() const {return data;}
+  GridTerm term() const {return {data.data(), width, height};}
+
   void normalize(const float maxVal = 1);
 
   Vec2t<size_t> maxValue() const;
@@ -63,6 +86,71 @@ private:
   size_t height;
   std::vector<float> data{};
   size_t index(size_t x, size_t y) const;
-  
-  std::pair<size_t,size_t> findMaxSize(const Grid2D& other) const;
 };
+
+template <typename E>
+Grid2D::Grid2D(const GridExpression<E>& expression) :
+  Grid2D(expression.self().getWidth(), expression.self().getHeight())
+{
+  E e{expression.self()};
+  e.prepare(width, height);
+
+  const int64_t w = int64_t(width);
+  const int64_t h = int64_t(height);
+  #pragma omp parallel for schedule(static)
+  for (int64_t y = 0;y<h;++y) {
+    const typename E::Row row = e.row(size_t(y));
+    float* target = data.data() + y*w;
+    #pragma omp simd
+    for (int64_t x = 0;x<w;++x) {
+      target[x] = row[size_t(x)];
+    }
+  }
+}
+
+template <typename T>
+constexpr bool isGridOperand = std::is_same_v<T, Grid2D> ||
+                               std::is_base_of_v<GridExpression<T>, T>;
+
+inline GridTerm toGridExpression(const Grid2D& grid) {return grid.term();}
+
+template <typename E>
+const E& toGridExpression(const GridExpression<E>& expression) {
+  return expression.self();
+}
+
+template <typename T>
+using GridExpressionType = std::decay_t<decltype(toGridExpression(std::declval<const T&>()))>;
+
+template <typename Op, typename L, typename R,
+          std::enable_if_t<isGridOperand<L> && isGridOperand<R>, int> = 0>
+GridBinary<Op, GridExpressionType<L>, GridExpressionType<R>>
+makeGridBinary(const L& l, const R& r) {
+  return {toGridExpression(l), toGridExpression(r)};
+}
+
+template <typename Op, typename L, std::enable_if_t<isGridOperand<L>, int> = 0>
+GridBinary<Op, GridExpressionType<L>, GridScalar>
+makeGridBinary(const L& l, float value) {
+  return {toGridExpression(l), GridScalar{value}};
+}
+
+template <typename L, typename R>
+auto operator+(const L& l, const R& r) -> decltype(makeGridBinary<GridAdd>(l, r)) {
+  return makeGridBinary<GridAdd>(l, r);
+}
+
+template <typename L, typename R>
+auto operator-(const L& l, const R& r) -> decltype(makeGridBinary<GridSub>(l, r)) {
+  return makeGridBinary<GridSub>(l, r);
+}
+
+template <typename L, typename R>
+auto operator*(const L& l, const R& r) -> decltype(makeGridBinary<GridMul>(l, r)) {
+  return makeGridBinary<GridMul>(l, r);
+}
+
+template <typename L, typename R>
+auto operator/(const L& l, const R& r) -> decltype(makeGridBinary<GridDiv>(l, r)) {
+  return makeGridBinary<GridDiv>(l, r);
+}
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+
+// Lazy arithmetic on Grid2D: the operators in Grid2D.h build a tree of the
+// nodes below and nothing is computed until the tree is converted into a
+// Grid2D, which then evaluates the whole expression in a single pass.
+
+template <typename E>
+class GridExpression {
+public:
+  const E& self() const {return static_cast<const E&>(*this);}
+};
+
+// leaf referencing the values of a grid, if its size differs from the size
+// of the result it is resampled bilinearly using per column/row stepping
+// tables that are computed once before the evaluation
+class GridTerm : public GridExpression<GridTerm> {
+public:
+  GridTerm(const float* data, size_t width, size_t height) :
+    data(data),
+    width(width),
+    height(height),
+    direct(true)
+  {}
+
+  size_t getWidth() const {return width;}
+  size_t getHeight() const {return height;}
+
+  void prepare(size_t targetWidth, size_t targetHeight) {
+    direct = targetWidth == width && targetHeight == height;
+    if (direct) return;
+    computeSteps(width, targetWidth, x0, x1, ax);
+    computeSteps(height, targetHeight, y0, y1, ay);
+  }
+
+  class Row {
+  public:
+    float operator[](size_t x) const {
+      if (!resample) return row0[x];
+      const float a = ax[x];
+      const float top    = row0[x0[x]] * (1.0f-a) + row0[x1[x]] * a;
+      const float bottom = row1[x0[x]] * (1.0f-a) + row1[x1[x]] * a;
+      return top * (1.0f-beta) + bottom * beta;
+    }
+
+    const float* row0;
+    const float* row1;
+    float beta;
+    bool resample;
+    const uint32_t* x0;
+    const uint32_t* x1;
+    const float* ax;
+  };
+
+  Row row(size_t y) const {
+    if (direct) return {data + y*width, nullptr, 0.0f, false,
+                        nullptr, nullptr, nullptr};
+    return {data + y0[y]*width, data + y1[y]*width, ay[y], true,
+            x0.data(), x1.data(), ax.data()};
+  }
+
+private:
+  const float* data;
+  size_t width;
+  size_t height;
+  bool direct;
+  std::vector<uint32_t> x0, x1, y0, y1;
+  std::vector<float> ax, ay;
+
+  // same sample positions as Grid2D::sample(x/(target-1), ...)
+  static void computeSteps(size_t source, size_t target,
+                           std::vector<uint32_t>& i0,
+                           std::vector<uint32_t>& i1,
+                           std::vector<float>& alpha) {
+    i0.resize(target);
+    i1.resize(target);
+    alpha.resize(target);
+    for (size_t i = 0;i<target;++i) {
+      const float norm = (target > 1) ? i/float(target-1.0f) : 0.0f;
+      const float s = norm*(source-1);
+      i0[i] = uint32_t(floorf(s));
+      i1[i] = uint32_t(std::min(ceilf(s), float(source-1)));
+      alpha[i] = s - floorf(s);
+    }
+  }
+};
+
+class GridScalar : public GridExpression<GridScalar> {
+public:
+  GridScalar(float value) : value(value) {}
+
+  size_t getWidth() const {return 0;}
+  size_t getHeight() const {return 0;}
+  void prepare(size_t, size_t) {}
+
+  class Row {
+  public:
+    float operator[](size_t) const {return value;}
+    float value;
+  };
+
+  Row row(size_t) const {return {value};}
+
+private:
+  float value;
+};
+
+struct GridAdd { static float apply(float a, float b) {return a+b;} };
+struct GridSub { static float apply(float a, float b) {return a-b;} };
+struct GridMul { static float apply(float a, float b) {return a*b;} };
+struct GridDiv { static float apply(float a, float b) {return a/b;} };
+
+template <typename Op, typename L, typename R>
+class GridBinary : public GridExpression<GridBinary<Op, L, R>> {
+public:
+  GridBinary(const L& l, const R& r) : l(l), r(r) {}
+
+  size_t getWidth() const {return std::max(l.getWidth(), r.getWidth());}
+  size_t getHeight() const {return std::max(l.getHeight(), r.getHeight());}
+
+  void prepare(size_t targetWidth, size_t targetHeight) {
+    l.prepare(targetWidth, targetHeight);
+    r.prepare(targetWidth, targetHeight);
+  }
+
+  class Row {
+  public:
+    float operator[](size_t x) const {return Op::apply(l[x], r[x]);}
+    typename L::Row l;
+    typename R::Row r;
+  };
+
+  Row row(size_t y) const {return {l.row(y), r.row(y)};}
+
+private:
+  L l;
+  R r;
+};
@@ -1,5 +1,7 @@
 #include <sstream>
 #include <iomanip>
+#include <algorithm>
+#include <cmath>
 
 #include "Image.h"
 #include "Grid2D.h"
@@ -158,26 +160,198 @@ uint8_t Image::getLumiValue(uint32_t x, uint32_t y) const {
   }
 }
 
-Image Image::filter(const Grid2D& filter) const {
+// maps a coordinate outside of [0,n) back into the image according to
+// the border mode, returns -1 if the sample should be treated as zero
+static int64_t borderIndex(int64_t p, int64_t n, BorderMode mode) {
+  if (p >= 0 && p < n) return p;
+  switch (mode) {
+    case BorderMode::Zero :
+      return -1;
+    case BorderMode::Clamp :
+      return std::clamp<int64_t>(p, 0, n-1);
+    case BorderMode::Repeat :
+      return ((p % n) + n) % n;
+    case BorderMode::Mirror : {
+      if (n == 1) return 0;
+      const int64_t period = 2*(n-1);
+      p = ((p % period) + period) % period;
+      return (p < n) ? p : period-p;
+    }
+  }
+  return -1;
+}
+
+// converts row y of the image into interleaved floats, padded by padLeft and
+// padRight pixels according to the border mode
+static void loadPaddedRow(const Image& image, int64_t y, int64_t padLeft,
+                          int64_t padRight, BorderMode mode,
+                          std::vector<float>& row) {
+  const int64_t cc = image.componentCount;
+  const int64_t w  = image.width;
+  row.resize(size_t((w+padLeft+padRight)*cc));
+  const int64_t sy = borderIndex(y, image.height, mode);
+  if (sy < 0) {
+    std::fill(row.begin(), row.end(), 0.0f);
+    return;
+  }
+  const uint8_t* src = image.data.data() + size_t(sy*w*cc);
+  float* dst = row.data() + padLeft*cc;
+  #pragma omp simd
+  for (int64_t i = 0;i<w*cc;++i) {
+    dst[i] = float(src[i]);
+  }
+  for (int64_t x = -padLeft;x<0;++x) {
+    const int64_t sx = borderIndex(x, w, mode);
+    for (int64_t c = 0;c<cc;++c)
+      dst[x*cc+c] = (sx < 0) ? 0.0f : float(src[sx*cc+c]);
+  }
+  for (int64_t x = w;x<w+padRight;++x) {
+    const int64_t sx = borderIndex(x, w, mode);
+    for (int64_t c = 0;c<cc;++c)
+      dst[x*cc+c] = (sx < 0) ? 0.0f : float(src[sx*cc+c]);
+  }
+}
+
+// tries to factor the kernel into an outer product col*row (i.e. checks if
+// the kernel has rank one)
+static bool separateKernel(const Grid2D& filter, std::vector<float>& row,
+                           std::vector<float>& col) {
+  const size_t kw = filter.getWidth();
+  const size_t kh = filter.getHeight();
+
+  size_t px = 0, py = 0;
+  float maxAbs = 0.0f;
+  for (size_t y = 0;y<kh;++y) {
+    for (size_t x = 0;x<kw;++x) {
+      if (fabsf(filter.getValue(x,y)) > maxAbs) {
+        maxAbs = fabsf(filter.getValue(x,y));
+        px = x;
+        py = y;
+      }
+    }
+  }
+
+  row.resize(kw);
+  col.resize(kh);
+  if (maxAbs == 0.0f) {
+    std::fill(row.begin(), row.end(), 0.0f);
+    std::fill(col.begin(), col.end(), 0.0f);
+    return true;
+  }
+
+  const float pivot = filter.getValue(px,py);
+  for (size_t x = 0;x<kw;++x) row[x] = filter.getValue(x,py);
+  for (size_t y = 0;y<kh;++y) col[y] = filter.getValue(px,y)/pivot;
+
+  const float eps = 1e-5f * maxAbs;
+  for (size_t y = 0;y<kh;++y) {
+    for (size_t x = 0;x<kw;++x) {
+      if (fabsf(filter.getValue(x,y) - col[y]*row[x]) > eps) return false;
+    }
+  }
+  return true;
+}
+
+static void storeRow(const float* values, int64_t count, uint8_t* target) {
+  #pragma omp simd
+  for (int64_t i = 0;i<count;++i) {
+    target[i] = uint8_t(std::min(255.0f, fabsf(values[i])));
+  }
+}
+
+Image Image::filter(const Grid2D& filter, BorderMode borderMode) const {
   Image filteredImage{width, height, componentCount};
-  
-  const uint32_t hw = uint32_t(filter.getWidth()/2);
-  const uint32_t hh = uint32_t(filter.getHeight()/2);
-  
-  for (uint32_t y = hh;y<height-hh;y+=1) {
-    for (uint32_t x = hw;x<width-hw;x+=1) {
-      for (uint8_t c = 0;c<componentCount;c+=1) {
-        float conv = 0.0f;
-        for (uint32_t u = 0;u<filter.getHeight();u+=1) {
-          for (uint32_t v = 0;v<filter.getWidth();v+=1) {
-            conv += float(getValue((x+u-hw),(y+v-hh),c)) * filter.getValue(u, v);
+
+  const int64_t kw = int64_t(filter.getWidth());
+  const int64_t kh = int64_t(filter.getHeight());
+  if (kw == 0 || kh == 0 || filteredImage.data.empty()) return filteredImage;
+
+  const int64_t hw = kw/2;
+  const int64_t hh = kh/2;
+  const int64_t cc = componentCount;
+  const int64_t h  = height;
+  const int64_t rowSize = int64_t(width)*cc;
+
+  std::vector<float> kernelRow, kernelCol;
+  if (separateKernel(filter, kernelRow, kernelCol)) {
+    // horizontal pass into a float buffer, followed by a vertical pass
+    std::vector<float> tmp(size_t(h*rowSize));
+
+    #pragma omp parallel
+    {
+      std::vector<float> padded;
+      #pragma omp for schedule(static)
+      for (int64_t y = 0;y<h;++y) {
+        loadPaddedRow(*this, y, hw, kw-1-hw, borderMode, padded);
+        float* acc = tmp.data() + y*rowSize;
+        std::fill(acc, acc+rowSize, 0.0f);
+        for (int64_t i = 0;i<kw;++i) {
+          const float weight = kernelRow[size_t(i)];
+          if (weight == 0.0f) continue;
+          const float* src = padded.data() + i*cc;
+          #pragma omp simd
+          for (int64_t j = 0;j<rowSize;++j) {
+            acc[j] += src[j] * weight;
           }
         }
-        filteredImage.setValue(x,y,c,uint8_t(fabs(conv)));
+      }
+
+      std::vector<float> acc(static_cast<size_t>(rowSize));
+      #pragma omp for schedule(static)
+      for (int64_t y = 0;y<h;++y) {
+        std::fill(acc.begin(), acc.end(), 0.0f);
+        for (int64_t t = 0;t<kh;++t) {
+          const float weight = kernelCol[size_t(t)];
+          const int64_t sy = borderIndex(y+t-hh, h, borderMode);
+          if (weight == 0.0f || sy < 0) continue;
+          const float* src = tmp.data() + sy*rowSize;
+          float* a = acc.data();
+          #pragma omp simd
+          for (int64_t j = 0;j<rowSize;++j) {
+            a[j] += src[j] * weight;
+          }
+        }
+        storeRow(acc.data(), rowSize, filteredImage.data.data() + y*rowSize);
+      }
+    }
+  } else {
+    // general 2D kernel, convert the (padded) image to float once and
+    // accumulate one kernel tap at a time over a full row
+    const int64_t paddedSize = (int64_t(width)+kw-1)*cc;
+    std::vector<float> src(size_t(h*paddedSize));
+
+    #pragma omp parallel
+    {
+      std::vector<float> padded;
+      #pragma omp for schedule(static)
+      for (int64_t y = 0;y<h;++y) {
+        loadPaddedRow(*this, y, hw, kw-1-hw, borderMode, padded);
+        std::copy(padded.begin(), padded.end(), src.begin()+y*paddedSize);
+      }
+
+      std::vector<float> acc(static_cast<size_t>(rowSize));
+      #pragma omp for schedule(static)
+      for (int64_t y = 0;y<h;++y) {
+        std::fill(acc.begin(), acc.end(), 0.0f);
+        for (int64_t t = 0;t<kh;++t) {
+          const int64_t sy = borderIndex(y+t-hh, h, borderMode);
+          if (sy < 0) continue;
+          for (int64_t i = 0;i<kw;++i) {
+            const float weight = filter.getValue(size_t(i), size_t(t));
+            if (weight == 0.0f) continue;
+            const float* s = src.data() + sy*paddedSize + i*cc;
+            float* a = acc.data();
+            #pragma omp simd
+            for (int64_t j = 0;j<rowSize;++j) {
+              a[j] += s[j] * weight;
+            }
+          }
+        }
+        storeRow(acc.data(), rowSize, filteredImage.data.data() + y*rowSize);
       }
     }
   }
-  
+
   return filteredImage;
 }
 
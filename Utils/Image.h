@@ -8,6 +8,13 @@
 
 class Grid2D;
 
+enum class BorderMode {
+  Zero,
+  Clamp,
+  Repeat,
+  Mirror
+};
+
 class Image {
 public:
   uint32_t width;
@@ -39,7 +46,7 @@ public:
   void setNormalizedValue(uint32_t x, uint32_t y, uint8_t component, float value);
   std::string toCode(const std::string& varName="myImage", bool padding=false) const;
   std::string toACIIArt(bool bSmallTable=true) const;
-  Image filter(const Grid2D& filter) const;
+  Image filter(const Grid2D& filter, BorderMode borderMode=BorderMode::Clamp) const;
   Image toGrayscale() const;
 
   static Image genTestImage(uint32_t width,
@@ -0,0 +1,299 @@
+#include <cmath>
+#include <algorithm>
+#include <limits>
+
+#include "MSDF.h"
+
+namespace {
+  enum EdgeColor : uint8_t {
+    RED = 1,
+    GREEN = 2,
+    BLUE = 4,
+    YELLOW = RED | GREEN,
+    MAGENTA = RED | BLUE,
+    CYAN = GREEN | BLUE,
+    WHITE = RED | GREEN | BLUE
+  };
+
+  struct Edge {
+    std::vector<Vec2> points;
+    uint8_t color;
+    bool closed;  // a whole contour without corners, has no end points
+  };
+
+  // direction change above which a contour point is treated as a corner,
+  // measured over cornerSpan points on either side to ignore pixel noise
+  constexpr float cornerAngle = 0.9f;
+  constexpr size_t cornerSpan = 2;
+
+  float dot(const Vec2& a, const Vec2& b) {
+    return a.x*b.x + a.y*b.y;
+  }
+
+  float cross(const Vec2& a, const Vec2& b) {
+    return a.x*b.y - a.y*b.x;
+  }
+
+  // marching squares at threshold over the grid padded by one cell of
+  // outside values, returns closed contours with the inside on the left
+  std::vector<std::vector<Vec2>> traceContours(const Grid2D& grid,
+                                               float threshold) {
+    const int64_t w = int64_t(grid.getWidth());
+    const int64_t h = int64_t(grid.getHeight());
+    const float outside = threshold - 1.0f;
+    auto value = [&](int64_t x, int64_t y) {
+      if (x < 0 || y < 0 || x >= w || y >= h) return outside;
+      return grid.getValue(size_t(x), size_t(y));
+    };
+
+    // crossings are identified by the grid edge they lie on
+    auto edgeId = [w](int64_t x, int64_t y, bool vertical) {
+      return size_t(((y+1)*(w+2) + (x+1))*2 + (vertical ? 1 : 0));
+    };
+
+    struct Segment {
+      size_t end;
+      Vec2 start;
+    };
+    const size_t none = std::numeric_limits<size_t>::max();
+    std::vector<size_t> segmentAt(size_t((w+2)*(h+2)*2), none);
+    std::vector<Segment> segments;
+
+    for (int64_t y = -1;y<h;++y) {
+      for (int64_t x = -1;x<w;++x) {
+        const Vec2 p[4] = {{float(x),float(y)}, {float(x+1),float(y)},
+                           {float(x+1),float(y+1)}, {float(x),float(y+1)}};
+        const float v[4] = {value(x,y), value(x+1,y),
+                            value(x+1,y+1), value(x,y+1)};
+        const bool in[4] = {v[0] >= threshold, v[1] >= threshold,
+                            v[2] >= threshold, v[3] >= threshold};
+        if (in[0] == in[1] && in[1] == in[2] && in[2] == in[3]) continue;
+
+        // cell edge k runs from corner k to corner k+1
+        const size_t ids[4] = {edgeId(x,y,false), edgeId(x+1,y,true),
+                               edgeId(x,y+1,false), edgeId(x,y,true)};
+        Vec2 crossing[4];
+        for (size_t k = 0;k<4;++k) {
+          const size_t l = (k+1)%4;
+          if (in[k] == in[l]) continue;
+          const float t = (threshold - v[k]) / (v[l] - v[k]);
+          crossing[k] = p[k] + (p[l] - p[k]) * t;
+        }
+
+        auto addSegment = [&](size_t a, size_t b) {
+          // orient with the inside on the left, judged by the corner
+          // farthest from the segment
+          const Vec2 dir = crossing[b] - crossing[a];
+          size_t reference = 0;
+          for (size_t k = 1;k<4;++k) {
+            if (std::fabs(cross(dir, p[k]-crossing[a])) >
+                std::fabs(cross(dir, p[reference]-crossing[a])))
+              reference = k;
+          }
+          const bool left = cross(dir, p[reference]-crossing[a]) > 0;
+          if (left != in[reference]) std::swap(a, b);
+          segmentAt[ids[a]] = segments.size();
+          segments.push_back({ids[b], crossing[a]});
+        };
+
+        if (in[0] == in[2] && in[1] == in[3]) {
+          // saddle, decided by the value at the cell center, every corner
+          // on the other side than the center is cut off separately
+          const bool center = (v[0]+v[1]+v[2]+v[3])/4.0f >= threshold;
+          for (size_t k = 0;k<4;++k) {
+            if (in[k] != center) addSegment((k+3)%4, k);
+          }
+        } else {
+          size_t a = 4;
+          size_t b = 4;
+          for (size_t k = 0;k<4;++k) {
+            if (in[k] == in[(k+1)%4]) continue;
+            if (a == 4) a = k; else b = k;
+          }
+          addSegment(a, b);
+        }
+      }
+    }
+
+    // every crossing starts exactly one segment, so following the end
+    // points links the segments into closed loops
+    std::vector<std::vector<Vec2>> contours;
+    std::vector<bool> used(segments.size(), false);
+    for (size_t s = 0;s<segments.size();++s) {
+      if (used[s]) continue;
+      std::vector<Vec2> contour;
+      size_t current = s;
+      while (current != none && !used[current]) {
+        used[current] = true;
+        const Vec2& point = segments[current].start;
+        if (contour.empty() || (point - contour.back()).sqlength() > 1e-12f)
+          contour.push_back(point);
+        current = segmentAt[segments[current].end];
+      }
+      if (contour.size() > 1 &&
+          (contour.front() - contour.back()).sqlength() <= 1e-12f)
+        contour.pop_back();
+      if (contour.size() >= 3) contours.push_back(std::move(contour));
+    }
+    return contours;
+  }
+
+  std::vector<size_t> findCorners(const std::vector<Vec2>& contour) {
+    const size_t n = contour.size();
+    const size_t span = std::min(cornerSpan, (n-1)/2);
+    if (span == 0) return {};
+
+    std::vector<float> angle(n);
+    for (size_t i = 0;i<n;++i) {
+      const Vec2 in = Vec2::normalize(contour[i] - contour[(i+n-span)%n]);
+      const Vec2 out = Vec2::normalize(contour[(i+span)%n] - contour[i]);
+      angle[i] = std::acos(std::clamp(dot(in, out), -1.0f, 1.0f));
+    }
+
+    std::vector<size_t> corners;
+    for (size_t i = 0;i<n;++i) {
+      if (angle[i] < cornerAngle) continue;
+      bool maximum = true;
+      for (size_t k = 1;k<=span && maximum;++k) {
+        maximum = angle[(i+n-k)%n] < angle[i] && angle[(i+k)%n] <= angle[i];
+      }
+      if (maximum) corners.push_back(i);
+    }
+    return corners;
+  }
+
+  // splits the contour at its corners and colors the edges so that two
+  // edges meeting at a corner never share more than one channel
+  void colorEdges(const std::vector<Vec2>& contour, std::vector<Edge>& edges) {
+    const size_t n = contour.size();
+    std::vector<size_t> splits = findCorners(contour);
+
+    if (splits.empty()) {
+      Edge edge{contour, WHITE, true};
+      edge.points.push_back(contour.front());
+      edges.push_back(std::move(edge));
+      return;
+    }
+
+    std::vector<uint8_t> colors;
+    if (splits.size() == 1) {
+      // a single corner (teardrop), split the contour in three
+      splits = {splits[0], (splits[0]+n/3)%n, (splits[0]+2*n/3)%n};
+      colors = {MAGENTA, WHITE, YELLOW};
+    } else {
+      for (size_t i = 0;i<splits.size();++i)
+        colors.push_back(i%2 ? MAGENTA : CYAN);
+      if (splits.size()%2) colors.back() = YELLOW;
+    }
+
+    for (size_t i = 0;i<splits.size();++i) {
+      const size_t first = splits[i];
+      const size_t last = splits[(i+1)%splits.size()];
+      Edge edge{{}, colors[i], false};
+      for (size_t j = first;;j=(j+1)%n) {
+        edge.points.push_back(contour[j]);
+        if (j == last && edge.points.size() > 1) break;
+      }
+      edges.push_back(std::move(edge));
+    }
+  }
+
+  struct Nearest {
+    float distance{std::numeric_limits<float>::max()};
+    float orthogonality{0.0f};
+    const Edge* edge{nullptr};
+    size_t segment{0};
+    float t{0.0f};
+  };
+
+  // signed distance to the nearest edge, beyond the end points of an edge
+  // the distance to the extended end segment is used, which keeps the
+  // channel fields straight across corners
+  float pseudoDistance(const Nearest& nearest, const Vec2& p) {
+    const Edge& edge = *nearest.edge;
+    const Vec2& a = edge.points[nearest.segment];
+    const Vec2& b = edge.points[nearest.segment+1];
+    const Vec2 dir = b - a;
+    const float side = cross(dir, p - a);
+    const float sign = side >= 0.0f ? 1.0f : -1.0f;
+    const size_t lastSegment = edge.points.size()-2;
+    if (!edge.closed && ((nearest.segment == 0 && nearest.t < 0.0f) ||
+                         (nearest.segment == lastSegment && nearest.t > 1.0f))) {
+      return side / dir.length();
+    }
+    return sign * nearest.distance;
+  }
+
+  float median(float a, float b, float c) {
+    return std::max(std::min(a, b), std::min(std::max(a, b), c));
+  }
+}
+
+std::vector<float> MSDF::generate(const Grid2D& grid, float threshold) {
+  const int64_t w = int64_t(grid.getWidth());
+  const int64_t h = int64_t(grid.getHeight());
+  std::vector<float> result(size_t(w*h*3));
+
+  std::vector<Edge> edges;
+  for (const std::vector<Vec2>& contour : traceContours(grid, threshold))
+    colorEdges(contour, edges);
+
+  const float far = float(w+h);
+  #pragma omp parallel for schedule(dynamic)
+  for (int64_t y = 0;y<h;++y) {
+    for (int64_t x = 0;x<w;++x) {
+      const Vec2 p{float(x), float(y)};
+      const bool inside = grid.getValue(size_t(x), size_t(y)) >= threshold;
+      float* texel = result.data() + size_t(x+y*w)*3;
+
+      Nearest nearest[3];
+      float trueDistance = far;
+      for (const Edge& edge : edges) {
+        for (size_t s = 0;s+1<edge.points.size();++s) {
+          const Vec2& a = edge.points[s];
+          const Vec2 dir = edge.points[s+1] - a;
+          const float len2 = dir.sqlength();
+          if (len2 <= 0.0f) continue;
+          const float t = dot(p - a, dir) / len2;
+          const Vec2 q = a + dir * std::clamp(t, 0.0f, 1.0f);
+          const float d = (p - q).length();
+          const float orthogonality = d > 0.0f ?
+            std::fabs(cross(dir, p - q)) / (std::sqrt(len2) * d) : 1.0f;
+          trueDistance = std::min(trueDistance, d);
+
+          for (size_t c = 0;c<3;++c) {
+            if (!(edge.color & (1 << c))) continue;
+            Nearest& n = nearest[c];
+            if (d < n.distance - 1e-5f ||
+                (d < n.distance + 1e-5f && orthogonality > n.orthogonality)) {
+              n = Nearest{d, orthogonality, &edge, s, t};
+            }
+          }
+        }
+      }
+
+      const float signedDistance = inside ? trueDistance : -trueDistance;
+      for (size_t c = 0;c<3;++c) {
+        texel[c] = nearest[c].edge ? pseudoDistance(nearest[c], p)
+                                   : signedDistance;
+      }
+
+      // where the channels disagree with the actual inside test (e.g. far
+      // from edges of one color) fall back to a plain distance field
+      if ((median(texel[0], texel[1], texel[2]) >= 0.0f) != inside) {
+        texel[0] = texel[1] = texel[2] = signedDistance;
+      }
+    }
+  }
+  return result;
+}
+
+std::vector<std::vector<float>> MSDF::generate(const std::vector<Grid2D>& grids,
+                                               float threshold) {
+  std::vector<std::vector<float>> result(grids.size());
+  #pragma omp parallel for schedule(dynamic)
+  for (int64_t i = 0;i<int64_t(grids.size());++i) {
+    result[size_t(i)] = generate(grids[size_t(i)], threshold);
+  }
+  return result;
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <vector>
+
+#include "Grid2D.h"
+
+// Multi-channel signed distance fields (Chlumsky 2015) for bitmaps. The
+// outline is traced at threshold with marching squares, split into edges at
+// corners and the edges are colored so that the two edges meeting at a
+// corner share only one of the three channels. The median of the channels
+// then reproduces sharp corners that a single channel field rounds off.
+namespace MSDF {
+  // interleaved RGB distances for every grid point in grid units, positive
+  // where the grid value is at least threshold
+  std::vector<float> generate(const Grid2D& grid, float threshold);
+
+  // generates the fields of all grids in parallel
+  std::vector<std::vector<float>> generate(const std::vector<Grid2D>& grids,
+                                           float threshold);
+}
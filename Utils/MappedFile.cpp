@@ -0,0 +1,115 @@
+#include <sstream>
+
+#ifdef _WIN32
+  #ifndef NOMINMAX
+    #define NOMINMAX
+  #endif
+  #include <windows.h>
+#else
+  #include <fcntl.h>
+  #include <unistd.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+#endif
+
+#include "MappedFile.h"
+
+MappedFile::MappedFile(const std::string& filename) {
+  std::stringstream error;
+#ifdef _WIN32
+  fileHandle = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                           nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                           nullptr);
+  if (fileHandle == INVALID_HANDLE_VALUE) {
+    fileHandle = nullptr;
+    error << "Can't open file " << filename;
+    throw MappedFileException(error.str());
+  }
+  LARGE_INTEGER size;
+  GetFileSizeEx(fileHandle, &size);
+  mappingSize = size_t(size.QuadPart);
+  if (mappingSize == 0) return;
+  mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY,
+                                     0, 0, nullptr);
+  if (mappingHandle)
+    mapping = (const uint8_t*)MapViewOfFile(mappingHandle, FILE_MAP_READ,
+                                            0, 0, 0);
+  if (!mapping) {
+    unmap();
+    error << "Can't map file " << filename;
+    throw MappedFileException(error.str());
+  }
+#else
+  fileDescriptor = open(filename.c_str(), O_RDONLY);
+  if (fileDescriptor < 0) {
+    error << "Can't open file " << filename;
+    throw MappedFileException(error.str());
+  }
+  struct stat info;
+  fstat(fileDescriptor, &info);
+  mappingSize = size_t(info.st_size);
+  if (mappingSize == 0) return;
+  void* m = mmap(nullptr, mappingSize, PROT_READ, MAP_SHARED,
+                 fileDescriptor, 0);
+  if (m == MAP_FAILED) {
+    unmap();
+    error << "Can't map file " << filename;
+    throw MappedFileException(error.str());
+  }
+  mapping = (const uint8_t*)m;
+#endif
+}
+
+MappedFile::~MappedFile() {
+  unmap();
+}
+
+void MappedFile::unmap() {
+#ifdef _WIN32
+  if (mapping) UnmapViewOfFile(mapping);
+  if (mappingHandle) CloseHandle(mappingHandle);
+  if (fileHandle) CloseHandle(fileHandle);
+  mappingHandle = nullptr;
+  fileHandle = nullptr;
+#else
+  if (mapping) munmap((void*)mapping, mappingSize);
+  if (fileDescriptor >= 0) close(fileDescriptor);
+  fileDescriptor = -1;
+#endif
+  mapping = nullptr;
+}
+
+void MappedFile::adviseRandom() const {
+#ifndef _WIN32
+  if (mapping) madvise((void*)mapping, mappingSize, MADV_RANDOM);
+#endif
+}
+
+void MappedFile::adviseSequential() const {
+#ifndef _WIN32
+  if (mapping) madvise((void*)mapping, mappingSize, MADV_SEQUENTIAL);
+#endif
+}
+
+#ifndef _WIN32
+static const uintptr_t pageSize = uintptr_t(sysconf(_SC_PAGESIZE));
+#endif
+
+void MappedFile::willNeed(const void* begin, size_t length) const {
+#ifndef _WIN32
+  const uintptr_t first = uintptr_t(begin) / pageSize * pageSize;
+  madvise((void*)first, uintptr_t(begin) + length - first, MADV_WILLNEED);
+#endif
+}
+
+void MappedFile::release(const void* begin, size_t length) const {
+#ifdef _WIN32
+  // removes the pages from the working set
+  VirtualUnlock((void*)begin, length);
+#else
+  // only whole pages inside the range, neighbours may still be in use
+  const uintptr_t first = (uintptr_t(begin) + pageSize - 1) / pageSize * pageSize;
+  const uintptr_t last = (uintptr_t(begin) + length) / pageSize * pageSize;
+  if (last > first) madvise((void*)first, last-first, MADV_DONTNEED);
+#endif
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <string>
+#include <exception>
+#include <cstdint>
+
+class MappedFileException : public std::exception {
+public:
+  MappedFileException(const std::string& whatStr) : whatStr(whatStr) {}
+  virtual const char* what() const throw() {
+    return whatStr.c_str();
+  }
+private:
+  std::string whatStr;
+};
+
+// read-only memory mapping of a whole file, pages are loaded by the OS on
+// first access
+class MappedFile {
+public:
+  MappedFile(const std::string& filename);
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  const uint8_t* data() const {return mapping;}
+  size_t size() const {return mappingSize;}
+
+  // access pattern hints, no-ops where the platform has no equivalent
+  void adviseRandom() const;
+  void adviseSequential() const;
+  void willNeed(const void* begin, size_t length) const;
+  // drops the pages of a range from memory, they are read from the file
+  // again on the next access
+  void release(const void* begin, size_t length) const;
+
+private:
+  const uint8_t* mapping{nullptr};
+  size_t mappingSize{0};
+#ifdef _WIN32
+  void* fileHandle{nullptr};
+  void* mappingHandle{nullptr};
+#else
+  int fileDescriptor{-1};
+#endif
+
+  void unmap();
+};
@@ -0,0 +1,81 @@
+#include "Mat4.h"
+
+namespace {
+  // m is the row major matrix, every element is x*column0 + y*column1 +
+  // z*column2 + w*column3 with w from the input (Stride 4), 1 or 0
+  template <size_t Stride, bool Project, bool Direction>
+  void transformFloats(const float* m, const float* in, float* out,
+                       size_t count) {
+    const int64_t n = int64_t(count);
+#ifdef MAT4_SIMD
+    using namespace Mat4SIMD;
+    alignas(16) const float c[16] = {m[0],m[4],m[8],m[12],
+                                     m[1],m[5],m[9],m[13],
+                                     m[2],m[6],m[10],m[14],
+                                     m[3],m[7],m[11],m[15]};
+    const Reg c0 = load(c), c1 = load(c+4), c2 = load(c+8), c3 = load(c+12);
+    #pragma omp parallel for schedule(static) if(n > 65536)
+    for (int64_t i = 0;i<n;++i) {
+      const float* v = in + size_t(i)*Stride;
+      Reg r;
+      if constexpr (Stride == 4)
+        r = madd(splat(v[0]), c0, mul(splat(v[3]), c3));
+      else if constexpr (Direction)
+        r = mul(splat(v[0]), c0);
+      else
+        r = madd(splat(v[0]), c0, c3);
+      r = madd(splat(v[1]), c1, r);
+      r = madd(splat(v[2]), c2, r);
+
+      float* target = out + size_t(i)*Stride;
+      if constexpr (Stride == 4) {
+        store(target, r);
+      } else {
+        alignas(16) float t[4];
+        store(t, r);
+        const float s = Project ? 1.0f/t[3] : 1.0f;
+        target[0] = Project ? t[0]*s : t[0];
+        target[1] = Project ? t[1]*s : t[1];
+        target[2] = Project ? t[2]*s : t[2];
+      }
+    }
+#else
+    #pragma omp parallel for simd schedule(static) if(n > 65536)
+    for (int64_t i = 0;i<n;++i) {
+      const float* v = in + size_t(i)*Stride;
+      const float w = Stride == 4 ? v[3] : (Direction ? 0.0f : 1.0f);
+      float r[4];
+      for (size_t row = 0;row<4;++row)
+        r[row] = v[0]*m[row*4]+v[1]*m[row*4+1]+v[2]*m[row*4+2]+w*m[row*4+3];
+
+      float* target = out + size_t(i)*Stride;
+      for (size_t row = 0;row<Stride;++row)
+        target[row] = Project ? r[row]/r[3] : r[row];
+    }
+#endif
+  }
+}
+
+template <> template <>
+void Mat4t<float>::transformBatch<Mat4t<float>::BatchMode::Point>(
+  const float* in, float* out, size_t count) const {
+  transformFloats<3, false, false>(e.data(), in, out, count);
+}
+
+template <> template <>
+void Mat4t<float>::transformBatch<Mat4t<float>::BatchMode::ProjectedPoint>(
+  const float* in, float* out, size_t count) const {
+  transformFloats<3, true, false>(e.data(), in, out, count);
+}
+
+template <> template <>
+void Mat4t<float>::transformBatch<Mat4t<float>::BatchMode::Vector>(
+  const float* in, float* out, size_t count) const {
+  transformFloats<3, false, true>(e.data(), in, out, count);
+}
+
+template <> template <>
+void Mat4t<float>::transformBatch<Mat4t<float>::BatchMode::Homogeneous>(
+  const float* in, float* out, size_t count) const {
+  transformFloats<4, false, false>(e.data(), in, out, count);
+}
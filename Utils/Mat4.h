@@ -5,9 +5,44 @@
 #include <array>
 #include <sstream>
 #include <cmath>
+#include <vector>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+  #include <xmmintrin.h>
+  #define MAT4_SSE
+#elif defined(__ARM_NEON)
+  #include <arm_neon.h>
+  #define MAT4_NEON
+#endif
 
 #include "Vec4.h"
 #include "Vec3.h"
+#include "Mat3.h"
+
+// the few 4 wide float operations the Mat4t<float> code paths need, a
+// matrix row or a transformed vector fits one register
+#if defined(MAT4_SSE) || defined(MAT4_NEON)
+namespace Mat4SIMD {
+#if defined(MAT4_SSE)
+  typedef __m128 Reg;
+  inline Reg load(const float* p) {return _mm_load_ps(p);}
+  inline Reg splat(float v) {return _mm_set1_ps(v);}
+  inline Reg madd(Reg a, Reg b, Reg c) {return _mm_add_ps(_mm_mul_ps(a, b), c);}
+  inline Reg mul(Reg a, Reg b) {return _mm_mul_ps(a, b);}
+  inline void store(float* p, Reg v) {_mm_store_ps(p, v);}
+#else
+  typedef float32x4_t Reg;
+  inline Reg load(const float* p) {return vld1q_f32(p);}
+  inline Reg splat(float v) {return vdupq_n_f32(v);}
+  inline Reg madd(Reg a, Reg b, Reg c) {return vmlaq_f32(c, a, b);}
+  inline Reg mul(Reg a, Reg b) {return vmulq_f32(a, b);}
+  inline void store(float* p, Reg v) {vst1q_f32(p, v);}
+#endif
+}
+#define MAT4_SIMD
+#endif
 
 template <typename T>
 class Mat4t {
@@ -51,10 +86,8 @@ public:
        e4.x,e4.y,e4.z,e44)
   {
   }
-  Mat4t(const Mat4t& other):
-  e{other.e}
-  {
-  }
+  Mat4t(const Mat4t& other) = default;
+  Mat4t& operator=(const Mat4t& other) = default;
   
   const std::string toString() const{
     std::stringstream s;
@@ -105,6 +138,22 @@ public:
 
   Mat4t operator * ( const Mat4t& other ) const{
     Mat4t result;
+#ifdef MAT4_SIMD
+    if constexpr (std::is_same_v<T, float>) {
+      // every row of the result is a combination of the rows of other
+      using namespace Mat4SIMD;
+      const Reg rows[4] = {load(&other.e[0]), load(&other.e[4]),
+                           load(&other.e[8]), load(&other.e[12])};
+      for (uint8_t x = 0;x<16;x+=4) {
+        Reg r = mul(splat(e[x]), rows[0]);
+        r = madd(splat(e[x+1]), rows[1], r);
+        r = madd(splat(e[x+2]), rows[2], r);
+        r = madd(splat(e[x+3]), rows[3], r);
+        store(&result.e[x], r);
+      }
+      return result;
+    }
+#endif
     for (uint8_t x = 0;x<16;x+=4)
       for (uint8_t y = 0;y<4;y++)
         result.e[x+y] = e[0+x] * other.e[0+y]+
@@ -130,6 +179,60 @@ public:
                 (other.x*e[8]+other.y*e[9]+other.z*e[10]+other.w*e[11]),
                 (other.x*e[12]+other.y*e[13]+other.z*e[14]+other.w*e[15])};
   }
+
+  // transforms without the perspective divide of operator*, for matrices
+  // whose bottom row is (0,0,0,1), vectors are directions (w = 0)
+  Vec3t<T> transformPoint(const Vec3t<T>& p) const {
+    return {p.x*e[0]+p.y*e[1]+p.z*e[2]+e[3],
+            p.x*e[4]+p.y*e[5]+p.z*e[6]+e[7],
+            p.x*e[8]+p.y*e[9]+p.z*e[10]+e[11]};
+  }
+  Vec3t<T> transformVector(const Vec3t<T>& v) const {
+    return {v.x*e[0]+v.y*e[1]+v.z*e[2],
+            v.x*e[4]+v.y*e[5]+v.z*e[6],
+            v.x*e[8]+v.y*e[9]+v.z*e[10]};
+  }
+
+  // batch transforms for large arrays, vectorized and spread over all
+  // cores, result may be the input array. transformPoints gives the results
+  // of operator* but skips the perspective divide if the bottom row is
+  // (0,0,0,1), transformVectors uses w = 0 and never divides
+  void transformPoints(const Vec3t<T>* points, Vec3t<T>* result, size_t count) const {
+    const T* in = reinterpret_cast<const T*>(points);
+    T* out = reinterpret_cast<T*>(result);
+    if (isAffine())
+      transformBatch<BatchMode::Point>(in, out, count);
+    else
+      transformBatch<BatchMode::ProjectedPoint>(in, out, count);
+  }
+  void transformVectors(const Vec3t<T>* vectors, Vec3t<T>* result, size_t count) const {
+    transformBatch<BatchMode::Vector>(reinterpret_cast<const T*>(vectors),
+                                   reinterpret_cast<T*>(result), count);
+  }
+  void transform(const Vec4t<T>* vectors, Vec4t<T>* result, size_t count) const {
+    transformBatch<BatchMode::Homogeneous>(reinterpret_cast<const T*>(vectors),
+                                   reinterpret_cast<T*>(result), count);
+  }
+
+  std::vector<Vec3t<T>> transformPoints(const std::vector<Vec3t<T>>& points) const {
+    std::vector<Vec3t<T>> result(points.size());
+    transformPoints(points.data(), result.data(), points.size());
+    return result;
+  }
+  std::vector<Vec3t<T>> transformVectors(const std::vector<Vec3t<T>>& vectors) const {
+    std::vector<Vec3t<T>> result(vectors.size());
+    transformVectors(vectors.data(), result.data(), vectors.size());
+    return result;
+  }
+  std::vector<Vec4t<T>> transform(const std::vector<Vec4t<T>>& vectors) const {
+    std::vector<Vec4t<T>> result(vectors.size());
+    transform(vectors.data(), result.data(), vectors.size());
+    return result;
+  }
+
+  bool isAffine() const {
+    return e[12] == 0 && e[13] == 0 && e[14] == 0 && e[15] == 1;
+  }
   
   static Mat4t scaling(T scale) {
     return scaling(scale,scale,scale);
@@ -222,9 +325,41 @@ public:
             m.e[5] *( m.e[8] * m.e[14] - m.e[12] * m.e[10]));
  }
 
+  // takes the cheaper affine path if the bottom row is (0,0,0,1)
   static Mat4t inverse(const Mat4t& m) {
+    if (m.isAffine()) return Mat4t::inverseAffine(m);
     return Mat4t::inverse(m, Mat4t::det(m));
   }
+
+  // inverse of a matrix with bottom row (0,0,0,1), i.e. any combination of
+  // translations, rotations, scalings and shears
+  static Mat4t inverseAffine(const Mat4t& m) {
+    T c[9];
+    const T Q = T(1)/cofactors(m, c);
+    const Mat3t<T> r{c[0]*Q, c[3]*Q, c[6]*Q,
+                     c[1]*Q, c[4]*Q, c[7]*Q,
+                     c[2]*Q, c[5]*Q, c[8]*Q};
+    return fromLinear(r, r * Vec3t<T>{-m.e[3], -m.e[7], -m.e[11]});
+  }
+
+  // inverse of a rotation followed by a translation, e.g. a view matrix
+  // from lookAt, the upper 3x3 must be orthonormal
+  static Mat4t inverseRigid(const Mat4t& m) {
+    const Mat3t<T> r{m.e[0], m.e[4], m.e[8],
+                     m.e[1], m.e[5], m.e[9],
+                     m.e[2], m.e[6], m.e[10]};
+    return fromLinear(r, r * Vec3t<T>{-m.e[3], -m.e[7], -m.e[11]});
+  }
+
+  // inverse transpose of the upper 3x3, transforms normals for a model
+  // view matrix m
+  static Mat3t<T> normalMatrix(const Mat4t& m) {
+    T c[9];
+    const T Q = T(1)/cofactors(m, c);
+    return {c[0]*Q, c[1]*Q, c[2]*Q,
+            c[3]*Q, c[4]*Q, c[5]*Q,
+            c[6]*Q, c[7]*Q, c[8]*Q};
+  }
   
   static Mat4t inverse(const Mat4t& m, T det) {
     T Q = T(1.0/det);
@@ -415,11 +550,76 @@ public:
   }
 
 private:
-  std::array<T, 16> e;
-  
+  alignas(16) std::array<T, 16> e;
+
+  enum class BatchMode {Point, ProjectedPoint, Vector, Homogeneous};
+
+  // the float versions are vectorized and parallel, see Mat4.cpp
+  template <BatchMode mode>
+  void transformBatch(const T* in, T* out, size_t count) const;
+
   static T deg2Rad(const T d) {
     return T(3.14159265358979323846)*d/T(180);
   }
+
+  // cofactor matrix of the upper 3x3 in c (row major), returns its
+  // determinant
+  static T cofactors(const Mat4t& m, T c[9]) {
+    c[0] = m.e[5]*m.e[10] - m.e[6]*m.e[9];
+    c[1] = m.e[6]*m.e[8]  - m.e[4]*m.e[10];
+    c[2] = m.e[4]*m.e[9]  - m.e[5]*m.e[8];
+    c[3] = m.e[2]*m.e[9]  - m.e[1]*m.e[10];
+    c[4] = m.e[0]*m.e[10] - m.e[2]*m.e[8];
+    c[5] = m.e[1]*m.e[8]  - m.e[0]*m.e[9];
+    c[6] = m.e[1]*m.e[6]  - m.e[2]*m.e[5];
+    c[7] = m.e[2]*m.e[4]  - m.e[0]*m.e[6];
+    c[8] = m.e[0]*m.e[5]  - m.e[1]*m.e[4];
+    return m.e[0]*c[0] + m.e[1]*c[1] + m.e[2]*c[2];
+  }
+
+  static Mat4t fromLinear(const Mat3t<T>& r, const Vec3t<T>& t) {
+    const T* l = r;
+    return {l[0], l[1], l[2], t.x,
+            l[3], l[4], l[5], t.y,
+            l[6], l[7], l[8], t.z,
+            0, 0, 0, 1};
+  }
 };
 
+template <typename T>
+template <typename Mat4t<T>::BatchMode mode>
+void Mat4t<T>::transformBatch(const T* in, T* out, size_t count) const {
+  constexpr size_t stride = (mode == BatchMode::Homogeneous) ? 4 : 3;
+  for (size_t i = 0;i<count;++i) {
+    const T* v = in + i*stride;
+    const T w = (mode == BatchMode::Homogeneous) ? v[3] :
+                (mode == BatchMode::Vector ? T(0) : T(1));
+    T r[4];
+    for (uint8_t row = 0;row<4;++row)
+      r[row] = v[0]*e[row*4]+v[1]*e[row*4+1]+v[2]*e[row*4+2]+w*e[row*4+3];
+
+    T* target = out + i*stride;
+    if constexpr (mode == BatchMode::Homogeneous) {
+      for (uint8_t row = 0;row<4;++row) target[row] = r[row];
+    } else if constexpr (mode == BatchMode::ProjectedPoint) {
+      for (uint8_t row = 0;row<3;++row) target[row] = r[row]/r[3];
+    } else {
+      for (uint8_t row = 0;row<3;++row) target[row] = r[row];
+    }
+  }
+}
+
+template <> template <>
+void Mat4t<float>::transformBatch<Mat4t<float>::BatchMode::Point>(
+  const float* in, float* out, size_t count) const;
+template <> template <>
+void Mat4t<float>::transformBatch<Mat4t<float>::BatchMode::ProjectedPoint>(
+  const float* in, float* out, size_t count) const;
+template <> template <>
+void Mat4t<float>::transformBatch<Mat4t<float>::BatchMode::Vector>(
+  const float* in, float* out, size_t count) const;
+template <> template <>
+void Mat4t<float>::transformBatch<Mat4t<float>::BatchMode::Homogeneous>(
+  const float* in, float* out, size_t count) const;
+
 typedef Mat4t<float> Mat4;
@@ -0,0 +1,331 @@
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include "MeshOptimizer.h"
+
+namespace MeshOptimizer {
+
+  size_t Mesh::vertexSize() const {
+    size_t size = 0;
+    for (size_t components : layout) size += components;
+    return size;
+  }
+
+  size_t Mesh::vertexCount() const {
+    const size_t size = vertexSize();
+    return (size > 0) ? vertices.size() / size : 0;
+  }
+
+  size_t Mesh::attributeOffset(size_t attribute) const {
+    size_t offset = 0;
+    for (size_t i = 0;i<attribute;++i) offset += layout[i];
+    return offset;
+  }
+
+  Mesh interleave(const std::vector<Attribute>& attributes,
+                  size_t vertexCount, const std::vector<Triangle>& triangles) {
+    Mesh mesh;
+    for (const Attribute& a : attributes) mesh.layout.push_back(a.componentCount);
+    mesh.triangles = triangles;
+
+    const size_t vertexSize = mesh.vertexSize();
+    mesh.vertices.resize(vertexCount*vertexSize);
+    size_t offset = 0;
+    for (const Attribute& a : attributes) {
+      const size_t stride = (a.stride > 0) ? a.stride : a.componentCount;
+      for (size_t i = 0;i<vertexCount;++i) {
+        std::copy(a.data + i*stride, a.data + i*stride + a.componentCount,
+                  mesh.vertices.begin() + i*vertexSize + offset);
+      }
+      offset += a.componentCount;
+    }
+    return mesh;
+  }
+
+  // applies a vertex remap table, vertices mapped to the same target must
+  // be identical, unused vertices are marked with INVALID
+  static const size_t INVALID = std::numeric_limits<size_t>::max();
+
+  static void remapVertices(Mesh& mesh, const std::vector<size_t>& remap,
+                            size_t newVertexCount) {
+    const size_t vertexSize = mesh.vertexSize();
+    std::vector<float> vertices(newVertexCount*vertexSize);
+    for (size_t i = 0;i<remap.size();++i) {
+      if (remap[i] == INVALID) continue;
+      std::copy(mesh.vertices.begin() + i*vertexSize,
+                mesh.vertices.begin() + (i+1)*vertexSize,
+                vertices.begin() + remap[i]*vertexSize);
+    }
+    mesh.vertices.swap(vertices);
+    for (Triangle& t : mesh.triangles) {
+      for (size_t k = 0;k<3;++k) t[k] = remap[t[k]];
+    }
+  }
+
+  void weld(Mesh& mesh) {
+    const size_t vertexSize = mesh.vertexSize();
+    const size_t vertexCount = mesh.vertexCount();
+    const size_t vertexBytes = vertexSize*sizeof(float);
+
+    // open addressing hash table over the raw vertex bytes
+    size_t tableSize = 1;
+    while (tableSize < vertexCount*2) tableSize *= 2;
+    std::vector<size_t> table(tableSize, INVALID);
+
+    std::vector<size_t> remap(vertexCount);
+    size_t uniqueCount = 0;
+    for (size_t i = 0;i<vertexCount;++i) {
+      const uint8_t* bytes = (const uint8_t*)(mesh.vertices.data() + i*vertexSize);
+      uint64_t hash = 14695981039346656037ull;
+      for (size_t b = 0;b<vertexBytes;++b) {
+        hash = (hash ^ bytes[b]) * 1099511628211ull;
+      }
+
+      size_t slot = size_t(hash) & (tableSize-1);
+      while (table[slot] != INVALID &&
+             std::memcmp(bytes, mesh.vertices.data() + table[slot]*vertexSize,
+                         vertexBytes) != 0) {
+        slot = (slot+1) & (tableSize-1);
+      }
+      if (table[slot] == INVALID) {
+        table[slot] = i;
+        remap[i] = uniqueCount++;
+      } else {
+        remap[i] = remap[table[slot]];
+      }
+    }
+    if (uniqueCount == vertexCount) return;
+    remapVertices(mesh, remap, uniqueCount);
+  }
+
+  // Tipsify: fans around the most recently cached vertex that still has
+  // unemitted triangles and whose fan likely fits into the cache, falls
+  // back to recently referenced vertices and finally to the next vertex in
+  // input order; every such fallback starts a new cluster
+  static std::vector<size_t> tipsify(const std::vector<Triangle>& triangles,
+                                     size_t vertexCount, size_t cacheSize,
+                                     std::vector<size_t>& clusters) {
+    const MeshProcessing::Adjacency adjacency =
+      MeshProcessing::buildAdjacency(vertexCount, triangles);
+
+    std::vector<int64_t> live(vertexCount);
+    for (size_t v = 0;v<vertexCount;++v) {
+      live[v] = int64_t(adjacency.offsets[v+1] - adjacency.offsets[v]);
+    }
+    std::vector<int64_t> cacheTime(vertexCount, 0);
+    std::vector<bool> emitted(triangles.size(), false);
+    std::vector<size_t> deadEnd;
+    std::vector<size_t> candidates;
+    std::vector<size_t> order;
+    order.reserve(triangles.size());
+    clusters.clear();
+
+    const int64_t cache = int64_t(cacheSize);
+    int64_t time = cache+1;
+    size_t cursor = 0;
+    size_t fanning = INVALID;
+
+    while (true) {
+      if (fanning == INVALID) {
+        while (!deadEnd.empty() && fanning == INVALID) {
+          if (live[deadEnd.back()] > 0) fanning = deadEnd.back();
+          deadEnd.pop_back();
+        }
+        while (fanning == INVALID && cursor < vertexCount) {
+          if (live[cursor] > 0) fanning = cursor;
+          cursor++;
+        }
+        if (fanning == INVALID) break;
+        if (clusters.empty() || clusters.back() != order.size())
+          clusters.push_back(order.size());
+      }
+
+      candidates.clear();
+      for (size_t c = adjacency.offsets[fanning];c<adjacency.offsets[fanning+1];++c) {
+        const size_t t = adjacency.corners[c] / 3;
+        if (emitted[t]) continue;
+        for (size_t v : triangles[t]) {
+          deadEnd.push_back(v);
+          candidates.push_back(v);
+          live[v]--;
+          if (time - cacheTime[v] > cache) cacheTime[v] = time++;
+        }
+        emitted[t] = true;
+        order.push_back(t);
+      }
+
+      fanning = INVALID;
+      int64_t bestPriority = -1;
+      for (size_t v : candidates) {
+        if (live[v] <= 0) continue;
+        int64_t priority = 0;
+        if (time - cacheTime[v] + 2*live[v] <= cache) priority = time - cacheTime[v];
+        if (priority > bestPriority) {
+          bestPriority = priority;
+          fanning = v;
+        }
+      }
+    }
+    return order;
+  }
+
+  static void applyOrder(Mesh& mesh, const std::vector<size_t>& order) {
+    std::vector<Triangle> triangles(order.size());
+    for (size_t i = 0;i<order.size();++i) triangles[i] = mesh.triangles[order[i]];
+    mesh.triangles.swap(triangles);
+  }
+
+  // Tipsify is a greedy heuristic, input that is already well ordered is
+  // kept as is
+  static void applyIfBetter(Mesh& mesh, const std::vector<size_t>& order,
+                            size_t cacheSize) {
+    std::vector<Triangle> triangles(order.size());
+    for (size_t i = 0;i<order.size();++i) triangles[i] = mesh.triangles[order[i]];
+    const size_t vertexCount = mesh.vertexCount();
+    if (analyzeVertexCache(triangles, vertexCount, cacheSize).acmr <
+        analyzeVertexCache(mesh.triangles, vertexCount, cacheSize).acmr)
+      mesh.triangles.swap(triangles);
+  }
+
+  void optimizeVertexCache(Mesh& mesh, size_t cacheSize) {
+    std::vector<size_t> clusters;
+    applyIfBetter(mesh, tipsify(mesh.triangles, mesh.vertexCount(), cacheSize,
+                                clusters), cacheSize);
+  }
+
+  void optimizeOverdraw(Mesh& mesh, size_t cacheSize, float threshold) {
+    std::vector<size_t> clusters;
+    const size_t vertexCount = mesh.vertexCount();
+    const float inputAcmr = analyzeVertexCache(mesh.triangles, vertexCount, cacheSize).acmr;
+    std::vector<Triangle> input = mesh.triangles;
+    applyOrder(mesh, tipsify(mesh.triangles, vertexCount, cacheSize, clusters));
+    const float tipsifyAcmr = analyzeVertexCache(mesh.triangles, vertexCount, cacheSize).acmr;
+    if (tipsifyAcmr > inputAcmr) mesh.triangles.swap(input);
+    if (clusters.size() < 2 || tipsifyAcmr > inputAcmr) return;
+    clusters.push_back(mesh.triangles.size());
+
+    const size_t vertexSize = mesh.vertexSize();
+    auto position = [&](size_t v) {
+      const float* p = mesh.vertices.data() + v*vertexSize;
+      return Vec3{p[0], p[1], p[2]};
+    };
+
+    // area weighted centroid and normal of every cluster and of the mesh
+    const size_t clusterCount = clusters.size()-1;
+    std::vector<Vec3> centroids(clusterCount);
+    std::vector<Vec3> normals(clusterCount);
+    Vec3 meshCentroid;
+    float meshArea = 0.0f;
+    for (size_t c = 0;c<clusterCount;++c) {
+      float area = 0.0f;
+      for (size_t i = clusters[c];i<clusters[c+1];++i) {
+        const Triangle& t = mesh.triangles[i];
+        const Vec3 a = position(t[0]), b = position(t[1]), d = position(t[2]);
+        const Vec3 n = Vec3::cross(b-a, d-a);
+        const float triangleArea = n.length();
+        centroids[c] = centroids[c] + (a+b+d) * (triangleArea/3.0f);
+        normals[c] = normals[c] + n;
+        area += triangleArea;
+      }
+      meshCentroid = meshCentroid + centroids[c];
+      meshArea += area;
+      if (area > 0.0f) centroids[c] = centroids[c] / area;
+    }
+    if (meshArea > 0.0f) meshCentroid = meshCentroid / meshArea;
+
+    // clusters facing away from the center are likely to occlude others
+    std::vector<float> occlusion(clusterCount);
+    for (size_t c = 0;c<clusterCount;++c) {
+      const float l = normals[c].length();
+      occlusion[c] = (l > 0.0f) ? Vec3::dot(centroids[c] - meshCentroid, normals[c] / l) : 0.0f;
+    }
+    std::vector<size_t> clusterOrder(clusterCount);
+    for (size_t c = 0;c<clusterCount;++c) clusterOrder[c] = c;
+    std::stable_sort(clusterOrder.begin(), clusterOrder.end(),
+                     [&](size_t a, size_t b) {return occlusion[a] > occlusion[b];});
+
+    std::vector<size_t> order;
+    order.reserve(mesh.triangles.size());
+    for (size_t c : clusterOrder) {
+      for (size_t i = clusters[c];i<clusters[c+1];++i) order.push_back(i);
+    }
+
+    std::vector<Triangle> sorted(order.size());
+    for (size_t i = 0;i<order.size();++i) sorted[i] = mesh.triangles[order[i]];
+    const float sortedAcmr = analyzeVertexCache(sorted, vertexCount, cacheSize).acmr;
+    if (sortedAcmr <= tipsifyAcmr * threshold) mesh.triangles.swap(sorted);
+  }
+
+  void optimizeVertexFetch(Mesh& mesh) {
+    std::vector<size_t> remap(mesh.vertexCount(), INVALID);
+    size_t next = 0;
+    for (const Triangle& t : mesh.triangles) {
+      for (size_t v : t) {
+        if (remap[v] == INVALID) remap[v] = next++;
+      }
+    }
+    remapVertices(mesh, remap, next);
+  }
+
+  void optimize(Mesh& mesh, size_t cacheSize) {
+    weld(mesh);
+    optimizeOverdraw(mesh, cacheSize);
+    optimizeVertexFetch(mesh);
+  }
+
+  // FIFO cache simulation, a vertex is cached if it was inserted less than
+  // cacheSize misses ago
+  CacheStatistics analyzeVertexCache(const std::vector<Triangle>& triangles,
+                                     size_t vertexCount, size_t cacheSize) {
+    std::vector<int64_t> insertedAt(vertexCount, std::numeric_limits<int64_t>::min()/2);
+    std::vector<bool> used(vertexCount, false);
+    int64_t misses = 0;
+    size_t usedCount = 0;
+    for (const Triangle& t : triangles) {
+      for (size_t v : t) {
+        if (misses - insertedAt[v] >= int64_t(cacheSize)) {
+          insertedAt[v] = misses++;
+        }
+        if (!used[v]) {
+          used[v] = true;
+          usedCount++;
+        }
+      }
+    }
+    CacheStatistics statistics;
+    statistics.acmr = triangles.empty() ? 0.0f : float(misses) / float(triangles.size());
+    statistics.atvr = (usedCount == 0) ? 0.0f : float(misses) / float(usedCount);
+    return statistics;
+  }
+
+  size_t IndexData::count() const {
+    return (type == GL_UNSIGNED_SHORT) ? indices16.size() : indices32.size();
+  }
+
+  void IndexData::upload(GLBuffer& buffer) const {
+    if (type == GL_UNSIGNED_SHORT)
+      buffer.setData(indices16);
+    else
+      buffer.setData(indices32);
+  }
+
+  IndexData narrowIndices(const Mesh& mesh) {
+    IndexData data;
+    if (mesh.vertexCount() <= std::numeric_limits<GLushort>::max()+size_t(1)) {
+      data.type = GL_UNSIGNED_SHORT;
+      data.indices16.reserve(mesh.triangles.size()*3);
+      for (const Triangle& t : mesh.triangles) {
+        for (size_t v : t) data.indices16.push_back(GLushort(v));
+      }
+    } else {
+      data.type = GL_UNSIGNED_INT;
+      data.indices32.reserve(mesh.triangles.size()*3);
+      for (const Triangle& t : mesh.triangles) {
+        for (size_t v : t) data.indices32.push_back(GLuint(v));
+      }
+    }
+    return data;
+  }
+
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <vector>
+
+#include "GLBuffer.h"
+#include "MeshProcessing.h"
+
+// Offline optimization of indexed triangle meshes for the GPU: vertex
+// welding, post-transform vertex cache and overdraw ordering (Tipsify,
+// Sander et al. 2007), vertex fetch ordering and index narrowing. The
+// stages operate on a single interleaved vertex stream that can be handed
+// to GLBuffer::setData as is.
+namespace MeshOptimizer {
+  typedef MeshProcessing::Triangle Triangle;
+
+  // one attribute array for interleave(), stride is given in floats and
+  // defaults to componentCount
+  struct Attribute {
+    const float* data;
+    size_t componentCount;
+    size_t stride{0};
+  };
+
+  struct Mesh {
+    std::vector<size_t> layout;   // component count of every attribute
+    std::vector<float> vertices;  // interleaved in layout order
+    std::vector<Triangle> triangles;
+
+    size_t vertexSize() const;    // floats per vertex
+    size_t vertexCount() const;
+    size_t attributeOffset(size_t attribute) const;  // in floats
+  };
+
+  Mesh interleave(const std::vector<Attribute>& attributes,
+                  size_t vertexCount, const std::vector<Triangle>& triangles);
+
+  // merges vertices whose attributes are bitwise identical
+  void weld(Mesh& mesh);
+  // orders triangles for a FIFO post-transform cache of cacheSize entries
+  void optimizeVertexCache(Mesh& mesh, size_t cacheSize=16);
+  // like optimizeVertexCache, additionally sorts the resulting triangle
+  // clusters front to back as seen from outside the mesh, as long as the
+  // cache miss ratio grows by no more than threshold, the first attribute
+  // must be the position
+  void optimizeOverdraw(Mesh& mesh, size_t cacheSize=16,
+                        float threshold=1.05f);
+  // orders vertices by first use and drops unreferenced ones
+  void optimizeVertexFetch(Mesh& mesh);
+  // weld, optimizeOverdraw and optimizeVertexFetch
+  void optimize(Mesh& mesh, size_t cacheSize=16);
+
+  struct CacheStatistics {
+    float acmr;  // average cache misses per triangle, 0.5 is optimal
+    float atvr;  // average transforms per vertex, 1.0 is optimal
+  };
+
+  CacheStatistics analyzeVertexCache(const std::vector<Triangle>& triangles,
+                                     size_t vertexCount, size_t cacheSize=16);
+
+  // index buffer using 16 bit indices whenever all vertices can be
+  // addressed with them
+  struct IndexData {
+    GLenum type;
+    std::vector<GLushort> indices16;
+    std::vector<GLuint> indices32;
+
+    size_t count() const;
+    void upload(GLBuffer& buffer) const;
+  };
+
+  IndexData narrowIndices(const Mesh& mesh);
+}
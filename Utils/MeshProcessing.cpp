@@ -0,0 +1,179 @@
+#include <cmath>
+
+#include "MeshProcessing.h"
+
+namespace MeshProcessing {
+
+  Adjacency buildAdjacency(size_t vertexCount,
+                           const std::vector<Triangle>& triangles) {
+    Adjacency adjacency;
+    adjacency.offsets.resize(vertexCount+1, 0);
+    for (const Triangle& t : triangles) {
+      for (size_t k = 0;k<3;++k) adjacency.offsets[t[k]+1]++;
+    }
+    for (size_t i = 0;i<vertexCount;++i) {
+      adjacency.offsets[i+1] += adjacency.offsets[i];
+    }
+    std::vector<size_t> cursor(adjacency.offsets.begin(),
+                               adjacency.offsets.end()-1);
+    adjacency.corners.resize(triangles.size()*3);
+    for (size_t f = 0;f<triangles.size();++f) {
+      for (size_t k = 0;k<3;++k) {
+        adjacency.corners[cursor[triangles[f][k]]++] = f*3+k;
+      }
+    }
+    return adjacency;
+  }
+
+  static Vec3 safeNormalize(const Vec3& v) {
+    const float l = v.length();
+    return (l > 0.0f) ? v / l : Vec3{};
+  }
+
+  // sums the per corner values of every vertex, each vertex is written by
+  // exactly one thread so no synchronization is needed
+  static std::vector<Vec3> gather(const Adjacency& adjacency,
+                                  const std::vector<Vec3>& cornerValues) {
+    const int64_t vertexCount = int64_t(adjacency.offsets.size()-1);
+    std::vector<Vec3> result(static_cast<size_t>(vertexCount));
+    #pragma omp parallel for schedule(static)
+    for (int64_t i = 0;i<vertexCount;++i) {
+      Vec3 sum;
+      for (size_t c = adjacency.offsets[size_t(i)];c<adjacency.offsets[size_t(i)+1];++c) {
+        sum = sum + cornerValues[adjacency.corners[c]];
+      }
+      result[size_t(i)] = sum;
+    }
+    return result;
+  }
+
+  std::vector<Vec3> vertexNormals(const std::vector<Vec3>& vertices,
+                                  const std::vector<Triangle>& triangles,
+                                  NormalWeighting weighting) {
+    const int64_t triangleCount = int64_t(triangles.size());
+    std::vector<Vec3> cornerNormals(triangles.size()*3);
+    #pragma omp parallel for schedule(static)
+    for (int64_t f = 0;f<triangleCount;++f) {
+      const Triangle& t = triangles[size_t(f)];
+      const Vec3& a = vertices[t[0]];
+      const Vec3& b = vertices[t[1]];
+      const Vec3& c = vertices[t[2]];
+      // the length of the cross product is twice the triangle area
+      const Vec3 normal = Vec3::cross(b-a, c-a);
+      Vec3* corner = cornerNormals.data() + f*3;
+      if (weighting == NormalWeighting::Area) {
+        corner[0] = corner[1] = corner[2] = normal;
+      } else {
+        const Vec3 unit = safeNormalize(normal);
+        const std::array<Vec3, 3> p{a, b, c};
+        for (size_t k = 0;k<3;++k) {
+          const Vec3 e1 = p[(k+1)%3] - p[k];
+          const Vec3 e2 = p[(k+2)%3] - p[k];
+          const float angle = atan2f(Vec3::cross(e1, e2).length(),
+                                     Vec3::dot(e1, e2));
+          corner[k] = unit * angle;
+        }
+      }
+    }
+
+    std::vector<Vec3> normals = gather(buildAdjacency(vertices.size(), triangles),
+                                       cornerNormals);
+    const int64_t vertexCount = int64_t(normals.size());
+    #pragma omp parallel for schedule(static)
+    for (int64_t i = 0;i<vertexCount;++i) {
+      normals[size_t(i)] = safeNormalize(normals[size_t(i)]);
+    }
+    return normals;
+  }
+
+  void tangentFrames(const std::vector<Vec3>& vertices,
+                     const std::vector<Vec3>& normals,
+                     const std::vector<Vec2>& texCoords,
+                     const std::vector<Triangle>& triangles,
+                     std::vector<Vec3>& tangents,
+                     std::vector<Vec3>& binormals) {
+    const int64_t triangleCount = int64_t(triangles.size());
+    std::vector<Vec3> cornerTangents(triangles.size()*3);
+    std::vector<Vec3> cornerBinormals(triangles.size()*3);
+    #pragma omp parallel for schedule(static)
+    for (int64_t f = 0;f<triangleCount;++f) {
+      const Triangle& t = triangles[size_t(f)];
+      const Vec3 e1 = vertices[t[1]] - vertices[t[0]];
+      const Vec3 e2 = vertices[t[2]] - vertices[t[0]];
+      const Vec2 d1 = texCoords[t[1]] - texCoords[t[0]];
+      const Vec2 d2 = texCoords[t[2]] - texCoords[t[0]];
+      const float det = d1.x * d2.y - d2.x * d1.y;
+      Vec3 tangent, binormal;
+      if (det != 0.0f) {
+        tangent = (e1 * d2.y - e2 * d1.y) / det;
+        binormal = (e2 * d1.x - e1 * d2.x) / det;
+      }
+      for (size_t k = 0;k<3;++k) {
+        cornerTangents[size_t(f)*3+k] = tangent;
+        cornerBinormals[size_t(f)*3+k] = binormal;
+      }
+    }
+
+    const Adjacency adjacency = buildAdjacency(vertices.size(), triangles);
+    tangents = gather(adjacency, cornerTangents);
+    binormals = gather(adjacency, cornerBinormals);
+
+    // Gram-Schmidt, the binormal keeps its direction relative to the
+    // tangent so mirrored texture coordinates are handled, vertices that
+    // only touch triangles with degenerate texture coordinates get an
+    // arbitrary tangent perpendicular to the normal
+    const int64_t vertexCount = int64_t(vertices.size());
+    #pragma omp parallel for schedule(static)
+    for (int64_t i = 0;i<vertexCount;++i) {
+      const Vec3& n = normals[size_t(i)];
+      Vec3 t = safeNormalize(tangents[size_t(i)] -
+                             n * Vec3::dot(n, tangents[size_t(i)]));
+      if (t.sqlength() == 0.0f) {
+        const Vec3 axis = (fabs(n.x) < 0.9f) ? Vec3{1,0,0} : Vec3{0,1,0};
+        t = safeNormalize(Vec3::cross(axis, n));
+      }
+      const Vec3 b = Vec3::cross(n, t);
+      const float handedness = Vec3::dot(b, binormals[size_t(i)]) < 0.0f ? -1.0f : 1.0f;
+      tangents[size_t(i)] = t;
+      binormals[size_t(i)] = b * handedness;
+    }
+  }
+
+  std::vector<Vec3> toVec3(const float data[], size_t valueCount,
+                           size_t stride) {
+    std::vector<Vec3> result(valueCount / stride);
+    for (size_t i = 0;i<result.size();++i) {
+      result[i] = Vec3{data[i*stride], data[i*stride+1], data[i*stride+2]};
+    }
+    return result;
+  }
+
+  std::vector<Vec2> toVec2(const float data[], size_t valueCount,
+                           size_t stride) {
+    std::vector<Vec2> result(valueCount / stride);
+    for (size_t i = 0;i<result.size();++i) {
+      result[i] = Vec2{data[i*stride], data[i*stride+1]};
+    }
+    return result;
+  }
+
+  std::vector<Triangle> toTriangles(const unsigned int indices[],
+                                    size_t indexCount) {
+    std::vector<Triangle> result(indexCount / 3);
+    for (size_t i = 0;i<result.size();++i) {
+      result[i] = {indices[i*3], indices[i*3+1], indices[i*3+2]};
+    }
+    return result;
+  }
+
+  std::vector<float> flatten(const std::vector<Vec3>& data) {
+    std::vector<float> result(data.size()*3);
+    for (size_t i = 0;i<data.size();++i) {
+      result[i*3+0] = data[i].x;
+      result[i*3+1] = data[i].y;
+      result[i*3+2] = data[i].z;
+    }
+    return result;
+  }
+
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <vector>
+#include <array>
+
+#include "Vec2.h"
+#include "Vec3.h"
+
+namespace MeshProcessing {
+  // same layout as OBJFile::IndexType
+  typedef std::array<size_t, 3> Triangle;
+
+  enum class NormalWeighting { Area, Angle };
+
+  // vertex to triangle corner adjacency in compressed sparse row form, the
+  // corners of vertex i are corners[offsets[i]] to corners[offsets[i+1]-1]
+  // and corner c belongs to triangle c/3
+  struct Adjacency {
+    std::vector<size_t> offsets;
+    std::vector<size_t> corners;
+  };
+
+  Adjacency buildAdjacency(size_t vertexCount,
+                           const std::vector<Triangle>& triangles);
+
+  // smooth vertex normals, every triangle contributes to its three vertices
+  // either weighted by its area or by the angle at the respective corner
+  std::vector<Vec3> vertexNormals(const std::vector<Vec3>& vertices,
+                                  const std::vector<Triangle>& triangles,
+                                  NormalWeighting weighting=NormalWeighting::Angle);
+
+  // per vertex tangents (direction of increasing u) and binormals (direction
+  // of increasing v), both orthogonalized against the normal
+  void tangentFrames(const std::vector<Vec3>& vertices,
+                     const std::vector<Vec3>& normals,
+                     const std::vector<Vec2>& texCoords,
+                     const std::vector<Triangle>& triangles,
+                     std::vector<Vec3>& tangents,
+                     std::vector<Vec3>& binormals);
+
+  // conversions from and to the flat arrays used for static meshes and
+  // GLBuffer::setData
+  std::vector<Vec3> toVec3(const float data[], size_t valueCount,
+                           size_t stride=3);
+  std::vector<Vec2> toVec2(const float data[], size_t valueCount,
+                           size_t stride=2);
+  std::vector<Triangle> toTriangles(const unsigned int indices[],
+                                    size_t indexCount);
+  std::vector<float> flatten(const std::vector<Vec3>& data);
+}
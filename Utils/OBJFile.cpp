@@ -1,101 +1,358 @@
 #include <fstream>
 #include <algorithm>
-#include <cctype> //std::isspace
+#include <charconv>
+#include <cstring>
+#include <limits>
+#include <filesystem>
+
+#include "MappedFile.h"
+#include "MeshProcessing.h"
 #include "OBJFile.h"
 
-OBJFile::OBJFile(const std::string& filename, bool normalize) {
-  Vec3 minVal{};
-  Vec3 maxVal{};
-  
-  std::ifstream f(filename);
-  std::string line;
-  while (std::getline(f, line)) {
-    trim(line);
-    if (line.size() < 2) continue;
-    
-    if (line[0] == 'f') {
-      std::vector<std::string> face = tokenize(line,1);
-      if (face.size() != 3) continue;
-      indices.push_back({fromStr<size_t>(face[0])-1,fromStr<size_t>(face[1])-1,fromStr<size_t>(face[2])-1});
-    } else {
-      if (line[0] == 'v') {
-        if (line[1] == 'n') {
-          std::vector<std::string> normal = tokenize(line,2);
-          if (normal.size() != 3) continue;
-          normals.push_back({fromStr<float>(normal[0]),fromStr<float>(normal[1]),fromStr<float>(normal[2])});
-        } else {
-          std::vector<std::string> vertex = tokenize(line,1);
-          if (vertex.size() != 3) continue;
-          Vec3 v{fromStr<float>(vertex[0]),fromStr<float>(vertex[1]),fromStr<float>(vertex[2])};
-          
-          if (vertices.empty()) {
-            minVal = v;
-            maxVal = v;
-          } else {
-            for (size_t i = 0;i<3;++i) {
-              minVal[i] = std::min(minVal[i], v[i]);
-              maxVal[i] = std::max(maxVal[i], v[i]);
-            }
-            
-          }
-          
-          vertices.push_back(v);
-        }
+static_assert(sizeof(Vec2) == 2*sizeof(float), "Vec2 must be tightly packed");
+static_assert(sizeof(Vec3) == 3*sizeof(float), "Vec3 must be tightly packed");
+
+// indices as parsed by a chunk: absolute indices are stored zero based,
+// relative (negative) indices are stored as chunk local index - RELATIVE
+// and shifted by the number of elements in the preceding chunks on merge
+static const int64_t RELATIVE = int64_t(1) << 62;
+static const int64_t MISSING = std::numeric_limits<int64_t>::min();
+
+typedef std::array<int64_t, 3> ChunkIndex;
+
+struct OBJChunk {
+  std::vector<Vec3> vertices;
+  std::vector<Vec2> texCoords;
+  std::vector<Vec3> normals;
+  std::vector<ChunkIndex> indices;
+  std::vector<ChunkIndex> texCoordIndices;
+  std::vector<ChunkIndex> normalIndices;
+  bool missingTexCoords{false};
+  bool missingNormals{false};
+};
+
+static const char* skipSpace(const char* p, const char* end) {
+  while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) ++p;
+  return p;
+}
+
+static bool parseFloat(const char*& p, const char* end, float& value) {
+  p = skipSpace(p, end);
+  if (p < end && *p == '+') ++p;
+  const std::from_chars_result r = std::from_chars(p, end, value);
+  if (r.ec != std::errc()) return false;
+  p = r.ptr;
+  return true;
+}
+
+static int64_t parseIndex(const char*& p, const char* end, size_t count) {
+  int64_t value;
+  const std::from_chars_result r = std::from_chars(p, end, value);
+  if (r.ec != std::errc() || value == 0) return MISSING;
+  p = r.ptr;
+  return (value > 0) ? value-1 : int64_t(count) + value - RELATIVE;
+}
+
+static void parseFace(const char* p, const char* end, OBJChunk& chunk,
+                      std::vector<ChunkIndex>& corners) {
+  corners.clear();
+  while (true) {
+    p = skipSpace(p, end);
+    if (p == end || *p == '\n' || *p == '#') break;
+
+    ChunkIndex corner{MISSING, MISSING, MISSING};
+    corner[0] = parseIndex(p, end, chunk.vertices.size());
+    if (corner[0] == MISSING) break;
+    if (p < end && *p == '/') {
+      ++p;
+      if (p < end && *p != '/')
+        corner[1] = parseIndex(p, end, chunk.texCoords.size());
+      if (p < end && *p == '/') {
+        ++p;
+        corner[2] = parseIndex(p, end, chunk.normals.size());
       }
     }
+    corners.push_back(corner);
   }
-  f.close();
-  
-  if (normalize) {
-    Vec3 center = (maxVal + minVal)/2.0f;
-    float maxSize = std::max(maxVal[0] - minVal[0], std::max(maxVal[1] - minVal[1], maxVal[2] - minVal[2]));
+  if (corners.size() < 3) return;
 
-    for (size_t i = 0;i<vertices.size();++i) {
-      vertices[i] = (vertices[i] - center) / maxSize;
+  for (size_t i = 1;i+1<corners.size();++i) {
+    const ChunkIndex& a = corners[0];
+    const ChunkIndex& b = corners[i];
+    const ChunkIndex& c = corners[i+1];
+    chunk.indices.push_back({a[0], b[0], c[0]});
+    chunk.texCoordIndices.push_back({a[1], b[1], c[1]});
+    chunk.normalIndices.push_back({a[2], b[2], c[2]});
+    chunk.missingTexCoords |= a[1] == MISSING || b[1] == MISSING || c[1] == MISSING;
+    chunk.missingNormals |= a[2] == MISSING || b[2] == MISSING || c[2] == MISSING;
+  }
+}
+
+static void parseChunk(const char* p, const char* end, OBJChunk& chunk) {
+  std::vector<ChunkIndex> corners;
+  while (p < end) {
+    const char* lineEnd = (const char*)std::memchr(p, '\n', size_t(end-p));
+    if (!lineEnd) lineEnd = end;
+
+    p = skipSpace(p, lineEnd);
+    if (lineEnd - p >= 2) {
+      const bool blank = p[1] == ' ' || p[1] == '\t';
+      if (p[0] == 'v' && blank) {
+        Vec3 v;
+        const char* q = p+1;
+        if (parseFloat(q, lineEnd, v.x) && parseFloat(q, lineEnd, v.y) &&
+            parseFloat(q, lineEnd, v.z))
+          chunk.vertices.push_back(v);
+      } else if (p[0] == 'v' && p[1] == 't') {
+        Vec2 t;
+        const char* q = p+2;
+        if (parseFloat(q, lineEnd, t.x)) {
+          if (!parseFloat(q, lineEnd, t.y)) t.y = 0.0f;
+          chunk.texCoords.push_back(t);
+        }
+      } else if (p[0] == 'v' && p[1] == 'n') {
+        Vec3 n;
+        const char* q = p+2;
+        if (parseFloat(q, lineEnd, n.x) && parseFloat(q, lineEnd, n.y) &&
+            parseFloat(q, lineEnd, n.z))
+          chunk.normals.push_back(n);
+      } else if (p[0] == 'f' && blank) {
+        parseFace(p+1, lineEnd, chunk, corners);
+      }
     }
+    p = lineEnd + 1;
   }
-  
-  normals.resize(vertices.size());
-  for (const OBJFile::IndexType& triangle : indices) {
-    std::array<Vec3, 3> v;
-    for (size_t i = 0;i<3;++i) {
-      v[0] = Vec3{vertices[triangle[0]][0],vertices[triangle[0]][1],vertices[triangle[0]][2]};
-      v[1] = Vec3{vertices[triangle[1]][0],vertices[triangle[1]][1],vertices[triangle[1]][2]};
-      v[2] = Vec3{vertices[triangle[2]][0],vertices[triangle[2]][1],vertices[triangle[2]][2]};
-      
-      Vec3 normal = Vec3::cross(v[1]-v[0], v[2]-v[0]);
-      
-      normals[triangle[0]] = normals[triangle[0]] + normal;
-      normals[triangle[1]] = normals[triangle[1]] + normal;
-      normals[triangle[2]] = normals[triangle[2]] + normal;
+}
+
+static void mergeIndices(const std::vector<ChunkIndex>& source,
+                         size_t offset, size_t count,
+                         std::vector<OBJFile::IndexType>& target,
+                         size_t targetOffset, bool& outOfRange) {
+  for (size_t i = 0;i<source.size();++i) {
+    for (size_t j = 0;j<3;++j) {
+      int64_t index = source[i][j];
+      if (index < 0) index += RELATIVE + int64_t(offset);
+      if (index < 0 || size_t(index) >= count) {
+        outOfRange = true;
+        index = 0;
+      }
+      target[targetOffset+i][j] = size_t(index);
     }
   }
-  for (size_t i = 0;i<normals.size();++i) {
-    normals[i] = Vec3::normalize(normals[i]);
+}
+
+void OBJFile::parse(const std::string& filename) {
+  MappedFile file(filename);
+  file.adviseSequential();
+  const char* begin = (const char*)file.data();
+  const char* end = begin + file.size();
+
+  // chunks of roughly 1MB, each ending after a line break
+  const size_t chunkCount = file.size() / (1 << 20) + 1;
+  std::vector<const char*> bounds(chunkCount+1, end);
+  bounds[0] = begin;
+  for (size_t i = 1;i<chunkCount;++i) {
+    const char* p = std::max(begin + i*(file.size()/chunkCount), bounds[i-1]);
+    const char* lineEnd = (const char*)std::memchr(p, '\n', size_t(end-p));
+    bounds[i] = lineEnd ? lineEnd+1 : end;
+  }
+
+  std::vector<OBJChunk> chunks(chunkCount);
+  const int64_t n = int64_t(chunkCount);
+  #pragma omp parallel for schedule(dynamic)
+  for (int64_t i = 0;i<n;++i) {
+    parseChunk(bounds[size_t(i)], bounds[size_t(i)+1], chunks[size_t(i)]);
   }
+
+  std::vector<size_t> vertexOffset(chunkCount+1, 0);
+  std::vector<size_t> texCoordOffset(chunkCount+1, 0);
+  std::vector<size_t> normalOffset(chunkCount+1, 0);
+  std::vector<size_t> triangleOffset(chunkCount+1, 0);
+  bool missingTexCoords = false;
+  bool missingNormals = false;
+  for (size_t i = 0;i<chunkCount;++i) {
+    vertexOffset[i+1] = vertexOffset[i] + chunks[i].vertices.size();
+    texCoordOffset[i+1] = texCoordOffset[i] + chunks[i].texCoords.size();
+    normalOffset[i+1] = normalOffset[i] + chunks[i].normals.size();
+    triangleOffset[i+1] = triangleOffset[i] + chunks[i].indices.size();
+    missingTexCoords |= chunks[i].missingTexCoords;
+    missingNormals |= chunks[i].missingNormals;
+  }
+
+  const size_t triangleCount = triangleOffset[chunkCount];
+  vertices.resize(vertexOffset[chunkCount]);
+  texCoords.resize(texCoordOffset[chunkCount]);
+  fileNormals.resize(normalOffset[chunkCount]);
+  indices.resize(triangleCount);
+  texCoordIndices.resize(missingTexCoords ? 0 : triangleCount);
+  normalIndices.resize(missingNormals ? 0 : triangleCount);
+
+  bool outOfRange = false;
+  #pragma omp parallel for schedule(dynamic) reduction(||:outOfRange)
+  for (int64_t k = 0;k<n;++k) {
+    const size_t i = size_t(k);
+    const OBJChunk& c = chunks[i];
+    std::copy(c.vertices.begin(), c.vertices.end(),
+              vertices.begin() + vertexOffset[i]);
+    std::copy(c.texCoords.begin(), c.texCoords.end(),
+              texCoords.begin() + texCoordOffset[i]);
+    std::copy(c.normals.begin(), c.normals.end(),
+              fileNormals.begin() + normalOffset[i]);
+    mergeIndices(c.indices, vertexOffset[i], vertices.size(),
+                 indices, triangleOffset[i], outOfRange);
+    if (!missingTexCoords)
+      mergeIndices(c.texCoordIndices, texCoordOffset[i], texCoords.size(),
+                   texCoordIndices, triangleOffset[i], outOfRange);
+    if (!missingNormals)
+      mergeIndices(c.normalIndices, normalOffset[i], fileNormals.size(),
+                   normalIndices, triangleOffset[i], outOfRange);
+  }
+
+  if (outOfRange) {
+    throw OBJFileException(std::string("Face index out of range in ") +
+                           filename);
+  }
+}
+
+// cache layout (native byte order): CacheHeader followed by the vertices,
+// texCoords, fileNormals, indices, texCoordIndices and normalIndices arrays
+struct CacheHeader {
+  char magic[4];
+  uint32_t version;
+  uint32_t indexSize;
+  uint32_t reserved;
+  uint64_t sourceSize;
+  int64_t sourceTime;
+  uint64_t vertexCount;
+  uint64_t texCoordCount;
+  uint64_t normalCount;
+  uint64_t triangleCount;
+  uint64_t texCoordIndexCount;
+  uint64_t normalIndexCount;
+};
+
+static const char CACHE_MAGIC[4] = {'O','B','J','B'};
+static const uint32_t CACHE_VERSION = 1;
+
+template <typename T>
+static bool readArray(const uint8_t*& p, const uint8_t* end,
+                      std::vector<T>& target, uint64_t count) {
+  if (uint64_t(end-p) / sizeof(T) < count) return false;
+  target.resize(size_t(count));
+  std::memcpy((void*)target.data(), p, size_t(count)*sizeof(T));
+  p += count*sizeof(T);
+  return true;
 }
 
-void OBJFile::ltrim(std::string &s) {
-    s.erase(s.begin(), std::find_if(s.begin(), s.end(), [](unsigned char ch) {
-        return !std::isspace(ch);
-    }));
+template <typename T>
+static void writeArray(std::ofstream& file, const std::vector<T>& source) {
+  file.write((const char*)source.data(), std::streamsize(source.size()*sizeof(T)));
 }
 
-void OBJFile::rtrim(std::string &s) {
-    s.erase(std::find_if(s.rbegin(), s.rend(), [](unsigned char ch) {
-        return !std::isspace(ch);
-    }).base(), s.end());
+bool OBJFile::loadCache(const std::string& cacheFilename, uint64_t sourceSize,
+                        int64_t sourceTime) {
+  std::error_code ec;
+  if (!std::filesystem::exists(cacheFilename, ec)) return false;
+  try {
+    MappedFile file(cacheFilename);
+    CacheHeader header;
+    if (file.size() < sizeof(header)) return false;
+    std::memcpy(&header, file.data(), sizeof(header));
+    if (std::memcmp(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0 ||
+        header.version != CACHE_VERSION ||
+        header.indexSize != sizeof(size_t) ||
+        header.sourceSize != sourceSize ||
+        header.sourceTime != sourceTime) return false;
+
+    const uint8_t* p = file.data() + sizeof(header);
+    const uint8_t* end = file.data() + file.size();
+    return readArray(p, end, vertices, header.vertexCount) &&
+           readArray(p, end, texCoords, header.texCoordCount) &&
+           readArray(p, end, fileNormals, header.normalCount) &&
+           readArray(p, end, indices, header.triangleCount) &&
+           readArray(p, end, texCoordIndices, header.texCoordIndexCount) &&
+           readArray(p, end, normalIndices, header.normalIndexCount);
+  } catch (const MappedFileException&) {
+    return false;
+  }
 }
 
-void OBJFile::trim(std::string &s) {
-    ltrim(s);
-    rtrim(s);
+// written to a temporary file first so concurrent loads never see a
+// partial cache, failures are ignored as the cache is only an optimization
+void OBJFile::saveCache(const std::string& cacheFilename, uint64_t sourceSize,
+                        int64_t sourceTime) const {
+  const std::string tempFilename = cacheFilename + ".tmp";
+  std::error_code ec;
+  {
+    std::ofstream file(tempFilename, std::ofstream::binary);
+    if (!file.is_open()) return;
+
+    CacheHeader header;
+    std::memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+    header.version = CACHE_VERSION;
+    header.indexSize = sizeof(size_t);
+    header.reserved = 0;
+    header.sourceSize = sourceSize;
+    header.sourceTime = sourceTime;
+    header.vertexCount = vertices.size();
+    header.texCoordCount = texCoords.size();
+    header.normalCount = fileNormals.size();
+    header.triangleCount = indices.size();
+    header.texCoordIndexCount = texCoordIndices.size();
+    header.normalIndexCount = normalIndices.size();
+    file.write((const char*)&header, sizeof(header));
+
+    writeArray(file, vertices);
+    writeArray(file, texCoords);
+    writeArray(file, fileNormals);
+    writeArray(file, indices);
+    writeArray(file, texCoordIndices);
+    writeArray(file, normalIndices);
+    if (!file) {
+      file.close();
+      std::filesystem::remove(tempFilename, ec);
+      return;
+    }
+  }
+  std::filesystem::rename(tempFilename, cacheFilename, ec);
+  if (ec) std::filesystem::remove(tempFilename, ec);
 }
 
-std::vector<std::string> OBJFile::tokenize(const std::string& str, size_t startpos) {
-  std::vector<std::string> strElements;
-  std::string buf;
-  std::stringstream ss(str.substr(startpos));
-  while (ss >> buf) strElements.push_back(buf);
-  return strElements;
+OBJFile::OBJFile(const std::string& filename, bool normalize, bool useCache) {
+  std::error_code sizeError, timeError;
+  const uint64_t sourceSize = std::filesystem::file_size(filename, sizeError);
+  const int64_t sourceTime = int64_t(std::filesystem::last_write_time(filename, timeError).time_since_epoch().count());
+  useCache = useCache && !sizeError && !timeError;
+
+  std::string cacheFilename = filename;
+  if (cacheFilename.size() > 4 &&
+      cacheFilename.compare(cacheFilename.size()-4, 4, ".obj") == 0)
+    cacheFilename.resize(cacheFilename.size()-4);
+  cacheFilename += ".objbin";
+
+  if (!useCache || !loadCache(cacheFilename, sourceSize, sourceTime)) {
+    parse(filename);
+    if (useCache) saveCache(cacheFilename, sourceSize, sourceTime);
+  }
+
+  if (normalize && !vertices.empty()) {
+    Vec3 minVal = vertices[0];
+    Vec3 maxVal = vertices[0];
+    for (const Vec3& v : vertices) {
+      for (size_t i = 0;i<3;++i) {
+        minVal[i] = std::min(minVal[i], v[i]);
+        maxVal[i] = std::max(maxVal[i], v[i]);
+      }
+    }
+
+    Vec3 center = (maxVal + minVal)/2.0f;
+    float maxSize = std::max(maxVal[0] - minVal[0], std::max(maxVal[1] - minVal[1], maxVal[2] - minVal[2]));
+
+    for (size_t i = 0;i<vertices.size();++i) {
+      vertices[i] = (vertices[i] - center) / maxSize;
+    }
+  }
+
+  normals = MeshProcessing::vertexNormals(vertices, indices,
+                                          MeshProcessing::NormalWeighting::Area);
 }
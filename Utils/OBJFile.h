@@ -3,33 +3,45 @@
 #include <vector>
 #include <array>
 #include <string>
-#include <sstream>
 
+#include "Vec2.h"
 #include "Vec3.h"
 
+class OBJFileException : public std::exception {
+public:
+  OBJFileException(const std::string& whatStr) : whatStr(whatStr) {}
+  virtual const char* what() const throw() {
+    return whatStr.c_str();
+  }
+private:
+  std::string whatStr;
+};
+
 class OBJFile {
 public:
-  OBJFile(const std::string& filename, bool normalize=false);
-  
+  // the parsed geometry is cached next to the file as <name>.objbin and
+  // reused as long as size and modification time of the OBJ file match
+  OBJFile(const std::string& filename, bool normalize=false,
+          bool useCache=true);
+
   typedef std::array<size_t, 3> IndexType;
 
+  // faces are triangulated as fans, indices refer to vertices, the optional
+  // texCoordIndices and normalIndices (empty if the file has no such
+  // references) have one entry per triangle as well
   std::vector<IndexType> indices;
   std::vector<Vec3> vertices;
   std::vector<Vec3> normals;
-  
-private:
-  void ltrim(std::string &s);
-  void rtrim(std::string &s);
-  void trim(std::string &s);
-  std::vector<std::string> tokenize(const std::string& str, size_t startpos);
-
-  template <typename T> T fromStr(const std::string& str) {
-    T t;
-    std::istringstream iss{str};
-    iss >> std::dec >> t;
-    return t;
-  }
 
+  std::vector<Vec2> texCoords;
+  std::vector<IndexType> texCoordIndices;
+  std::vector<Vec3> fileNormals;
+  std::vector<IndexType> normalIndices;
 
+private:
+  void parse(const std::string& filename);
+  bool loadCache(const std::string& cacheFilename, uint64_t sourceSize,
+                 int64_t sourceTime);
+  void saveCache(const std::string& cacheFilename, uint64_t sourceSize,
+                 int64_t sourceTime) const;
 };
-
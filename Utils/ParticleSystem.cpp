@@ -0,0 +1,181 @@
+#include <algorithm>
+#include <cmath>
+
+#include "ColorConversion.h"
+#include "Rand.h"
+#include "ParticleSystem.h"
+
+// particles handled by one task, large enough to amortize the scheduling
+// and small enough to balance the load over many cores
+static const int64_t blockSize = 16384;
+
+ParticleSystem::ParticleSystem(size_t capacity, float pointSize,
+                               float refDepth) :
+  AbstractParticleSystem(pointSize, refDepth),
+  capacity(capacity),
+  used(0),
+  posX(capacity), posY(capacity), posZ(capacity),
+  velX(capacity), velY(capacity), velZ(capacity),
+  colR(capacity), colG(capacity), colB(capacity), colA(capacity),
+  life(capacity), invLifetime(capacity),
+  alive(capacity, 0),
+  died(capacity),
+  diedCount(size_t((int64_t(capacity)+blockSize-1)/blockSize)),
+  color(RANDOM_COLOR),
+  acceleration{0.0f,0.0f,0.0f},
+  drag(0.0f),
+  lastTime(0.0f),
+  started(false)
+{
+  freeList.reserve(capacity);
+}
+
+Vec3 ParticleSystem::nextColor() const {
+  if (color == RAINBOW_COLOR)
+    return ColorConversion::hsvToRgb(Vec3{staticRand.rand01()*360.0f, 1.0f, 1.0f});
+  return computeColor(color);
+}
+
+bool ParticleSystem::spawn(const Vec3& position, const Vec3& velocity,
+                           float lifetime) {
+  size_t i;
+  if (!freeList.empty()) {
+    i = freeList.back();
+    freeList.pop_back();
+  } else if (used < capacity) {
+    i = used++;
+  } else {
+    return false;
+  }
+
+  const Vec3 c = nextColor();
+  posX[i] = position.x; posY[i] = position.y; posZ[i] = position.z;
+  velX[i] = velocity.x; velY[i] = velocity.y; velZ[i] = velocity.z;
+  colR[i] = c.r; colG[i] = c.g; colB[i] = c.b; colA[i] = 1.0f;
+  life[i] = lifetime;
+  invLifetime[i] = lifetime > 0.0f ? 1.0f/lifetime : 0.0f;
+  alive[i] = 1;
+  return true;
+}
+
+size_t ParticleSystem::emit(size_t count, const Vec3& position, float speed,
+                            float lifetime) {
+  for (size_t i = 0;i<count;++i) {
+    if (!spawn(position, Vec3::randomUnitVector()*speed, lifetime)) return i;
+  }
+  return count;
+}
+
+void ParticleSystem::clear() {
+  std::fill(alive.begin(), alive.begin()+int64_t(used), 0);
+  freeList.clear();
+  used = 0;
+}
+
+void ParticleSystem::sortSpatially(SpatialGrid& grid) {
+  grid.build(posX.data(), posY.data(), posZ.data(), used);
+  const std::vector<uint32_t>& order = grid.getOrder();
+  const int64_t count = int64_t(used);
+
+  reorderScratch.resize(capacity);
+  for (FloatArray* a : {&posX, &posY, &posZ, &velX, &velY, &velZ,
+                        &colR, &colG, &colB, &colA, &life, &invLifetime}) {
+    const float* source = a->data();
+    #pragma omp parallel for
+    for (int64_t i = 0;i<count;++i)
+      reorderScratch[size_t(i)] = source[order[size_t(i)]];
+    std::copy(reorderScratch.begin(), reorderScratch.begin()+count, a->begin());
+  }
+
+  std::vector<uint8_t> previous(alive.begin(), alive.begin()+count);
+  freeList.clear();
+  for (int64_t i = 0;i<count;++i) {
+    alive[size_t(i)] = previous[order[size_t(i)]];
+    if (!alive[size_t(i)]) freeList.push_back(uint32_t(i));
+  }
+}
+
+void ParticleSystem::update(float t) {
+  const float dt = started ? t-lastTime : 0.0f;
+  lastTime = t;
+  started = true;
+  if (used == 0 || dt <= 0.0f) return;
+
+  const float damping = std::pow(std::max(0.0f, 1.0f-drag), dt);
+  const float ax = acceleration.x*dt;
+  const float ay = acceleration.y*dt;
+  const float az = acceleration.z*dt;
+
+  float* px = posX.data(); float* py = posY.data(); float* pz = posZ.data();
+  float* vx = velX.data(); float* vy = velY.data(); float* vz = velZ.data();
+  float* ca = colA.data();
+  float* l = life.data();
+  const float* il = invLifetime.data();
+
+  const int64_t count = int64_t(used);
+  const int64_t blocks = (count+blockSize-1)/blockSize;
+  #pragma omp parallel for schedule(dynamic)
+  for (int64_t b = 0;b<blocks;++b) {
+    const int64_t begin = b*blockSize;
+    const int64_t end = std::min(count, begin+blockSize);
+
+    // dead particles are integrated as well, their alpha stays at zero
+    #pragma omp simd
+    for (int64_t i = begin;i<end;++i) {
+      vx[i] = vx[i]*damping + ax;
+      vy[i] = vy[i]*damping + ay;
+      vz[i] = vz[i]*damping + az;
+      px[i] += vx[i]*dt;
+      py[i] += vy[i]*dt;
+      pz[i] += vz[i]*dt;
+      l[i] -= dt;
+      ca[i] = std::max(0.0f, l[i]*il[i]);
+    }
+
+    // particles that died in this step are collected in the block's part
+    // of the scratch array, so no synchronization is needed
+    size_t n = 0;
+    for (int64_t i = begin;i<end;++i) {
+      if (alive[size_t(i)] && l[i] <= 0.0f) {
+        alive[size_t(i)] = 0;
+        died[size_t(begin)+n++] = uint32_t(i);
+      }
+    }
+    diedCount[size_t(b)] = n;
+  }
+
+  for (int64_t b = 0;b<blocks;++b) {
+    const auto first = died.begin()+b*blockSize;
+    freeList.insert(freeList.end(), first, first+int64_t(diedCount[size_t(b)]));
+  }
+
+  // once everything is dead nothing needs to be drawn
+  if (freeList.size() == used) clear();
+}
+
+void ParticleSystem::writeData(float* target) const {
+  const int64_t count = int64_t(used);
+  const int64_t blocks = (count+blockSize-1)/blockSize;
+  #pragma omp parallel for
+  for (int64_t b = 0;b<blocks;++b) {
+    const int64_t begin = b*blockSize;
+    const int64_t end = std::min(count, begin+blockSize);
+    #pragma omp simd
+    for (int64_t i = begin;i<end;++i) {
+      float* v = target+i*7;
+      v[0] = posX[size_t(i)];
+      v[1] = posY[size_t(i)];
+      v[2] = posZ[size_t(i)];
+      v[3] = colR[size_t(i)];
+      v[4] = colG[size_t(i)];
+      v[5] = colB[size_t(i)];
+      v[6] = colA[size_t(i)];
+    }
+  }
+}
+
+std::vector<float> ParticleSystem::getData() const {
+  std::vector<float> data(used*7);
+  writeData(data.data());
+  return data;
+}
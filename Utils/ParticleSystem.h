@@ -0,0 +1,97 @@
+#pragma once
+
+#include <vector>
+#include <new>
+
+#include "Vec3.h"
+#include "SpatialGrid.h"
+#include "AbstractParticleSystem.h"
+
+// allocator for cache line aligned arrays, so the SIMD kernels never split
+// a vector load across two lines
+template <typename T, size_t Alignment = 64>
+struct AlignedAllocator {
+  typedef T value_type;
+
+  AlignedAllocator() = default;
+  template <typename U> AlignedAllocator(const AlignedAllocator<U, Alignment>&) {}
+  template <typename U> struct rebind {typedef AlignedAllocator<U, Alignment> other;};
+
+  T* allocate(size_t n) {
+    return static_cast<T*>(::operator new(n*sizeof(T), std::align_val_t(Alignment)));
+  }
+  void deallocate(T* p, size_t) {
+    ::operator delete(p, std::align_val_t(Alignment));
+  }
+
+  bool operator==(const AlignedAllocator&) const {return true;}
+  bool operator!=(const AlignedAllocator&) const {return false;}
+};
+
+// Particle system for very large particle counts. Every attribute is kept
+// in its own aligned array (structure of arrays) so the update is a
+// vectorized kernel over blocks of particles, the blocks are distributed
+// over all cores. Dead particles are recycled through a free list and the
+// vertices are written straight into the mapped vertex buffer. Slots of dead
+// particles are drawn fully transparent until they are reused.
+class ParticleSystem : public AbstractParticleSystem {
+public:
+  ParticleSystem(size_t capacity, float pointSize, float refDepth=1.0f);
+  virtual ~ParticleSystem() {}
+
+  // t is the absolute time in seconds, the first call only sets the clock
+  virtual void update(float t) override;
+
+  // color of particles spawned from now on, RANDOM_COLOR and RAINBOW_COLOR
+  // pick a new color for every particle
+  virtual void setColor(const Vec3& color) override {this->color = color;}
+
+  // returns false if all slots are in use
+  bool spawn(const Vec3& position, const Vec3& velocity, float lifetime);
+  // spawns up to count particles at position moving in random directions,
+  // returns the number of particles spawned
+  size_t emit(size_t count, const Vec3& position, float speed, float lifetime);
+  void clear();
+
+  // rebuilds grid from the particles and stores them in its order, so that
+  // neighbours are close in memory, particle indices change
+  void sortSpatially(SpatialGrid& grid);
+
+  void setAcceleration(const Vec3& acceleration) {this->acceleration = acceleration;}
+  const Vec3& getAcceleration() const {return acceleration;}
+  // fraction of the velocity lost per second
+  void setDrag(float drag) {this->drag = drag;}
+  float getDrag() const {return drag;}
+
+  virtual std::vector<float> getData() const override;
+  // number of slots drawn, including dead ones waiting to be reused
+  virtual size_t getParticleCount() const override {return used;}
+  size_t getAliveCount() const {return used-freeList.size();}
+  size_t getCapacity() const {return capacity;}
+
+  virtual void writeData(float* target) const override;
+
+private:
+  typedef std::vector<float, AlignedAllocator<float>> FloatArray;
+
+  size_t capacity;
+  size_t used;
+  FloatArray posX, posY, posZ;
+  FloatArray velX, velY, velZ;
+  FloatArray colR, colG, colB, colA;
+  FloatArray life, invLifetime;
+  std::vector<uint8_t> alive;
+
+  std::vector<uint32_t> freeList;
+  std::vector<uint32_t> died;       // per block scratch for the update
+  std::vector<size_t> diedCount;
+  FloatArray reorderScratch;
+
+  Vec3 color;
+  Vec3 acceleration;
+  float drag;
+  float lastTime;
+  bool started;
+
+  Vec3 nextColor() const;
+};
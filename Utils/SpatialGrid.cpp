@@ -0,0 +1,139 @@
+#include <algorithm>
+
+#include "SpatialGrid.h"
+
+SpatialGrid::SpatialGrid(float cellSize) :
+  cellSize(cellSize),
+  invCellSize(1.0f/cellSize),
+  bitsX(0),
+  bitsY(0),
+  bitsZ(0),
+  boundsMin{0.0f,0.0f,0.0f},
+  boundsMax{0.0f,0.0f,0.0f}
+{
+}
+
+void SpatialGrid::build(const std::vector<Vec3>& positions) {
+  std::vector<float> x(positions.size());
+  std::vector<float> y(positions.size());
+  std::vector<float> z(positions.size());
+  for (size_t i = 0;i<positions.size();++i) {
+    x[i] = positions[i].x;
+    y[i] = positions[i].y;
+    z[i] = positions[i].z;
+  }
+  build(x.data(), y.data(), z.data(), positions.size());
+}
+
+void SpatialGrid::build(const float* x, const float* y, const float* z,
+                        size_t count) {
+  // about two buckets per point keeps collisions rare
+  uint32_t bits = 0;
+  while (bits < maxTableBits && (size_t(1) << bits) < 2*count) ++bits;
+  bitsX = (bits+2)/3;
+  bitsY = (bits+1)/3;
+  bitsZ = bits/3;
+  const uint32_t tableSize = 1u << bits;
+
+  bucketStart.assign(size_t(tableSize)+1, 0);
+  pointBucket.resize(count);
+  order.resize(count);
+  posX.resize(count);
+  posY.resize(count);
+  posZ.resize(count);
+
+  const int64_t n = int64_t(count);
+  float minX = std::numeric_limits<float>::max();
+  float minY = minX, minZ = minX;
+  float maxX = -minX, maxY = -minX, maxZ = -minX;
+  #pragma omp parallel for reduction(min:minX,minY,minZ) reduction(max:maxX,maxY,maxZ)
+  for (int64_t i = 0;i<n;++i) {
+    const uint32_t b = bucket(cellCoord(x[i]), cellCoord(y[i]), cellCoord(z[i]));
+    pointBucket[size_t(i)] = b;
+    #pragma omp atomic
+    ++bucketStart[b+1];
+    minX = std::min(minX, x[i]); maxX = std::max(maxX, x[i]);
+    minY = std::min(minY, y[i]); maxY = std::max(maxY, y[i]);
+    minZ = std::min(minZ, z[i]); maxZ = std::max(maxZ, z[i]);
+  }
+  boundsMin = Vec3{minX, minY, minZ};
+  boundsMax = Vec3{maxX, maxY, maxZ};
+
+  for (size_t b = 1;b<bucketStart.size();++b)
+    bucketStart[b] += bucketStart[b-1];
+
+  // scatter in parallel, afterwards the points of a bucket are sorted by
+  // index so the order does not depend on the thread scheduling
+  std::vector<uint32_t> fill(bucketStart.begin(), bucketStart.end()-1);
+  #pragma omp parallel for
+  for (int64_t i = 0;i<n;++i) {
+    uint32_t slot;
+    #pragma omp atomic capture
+    slot = fill[pointBucket[size_t(i)]]++;
+    order[slot] = uint32_t(i);
+  }
+
+  #pragma omp parallel for schedule(dynamic, 1024)
+  for (int64_t b = 0;b<int64_t(tableSize);++b) {
+    const uint32_t begin = bucketStart[size_t(b)];
+    const uint32_t end = bucketStart[size_t(b)+1];
+    if (end-begin > 1) std::sort(order.begin()+begin, order.begin()+end);
+    for (uint32_t i = begin;i<end;++i) {
+      posX[i] = x[order[i]];
+      posY[i] = y[order[i]];
+      posZ[i] = z[order[i]];
+    }
+  }
+}
+
+SpatialGrid::AxisRange SpatialGrid::axisRange(float low, float high,
+                                              uint32_t bits) const {
+  const int64_t first = cellCoord(low);
+  const int64_t last = cellCoord(high);
+  const uint32_t size = 1u << bits;
+  if (last < first) return {{0,0},{0,0}};
+  if (last-first+1 >= int64_t(size)) return {{0,0},{size,0}};
+
+  const uint32_t start = uint32_t(first) & (size-1);
+  const uint32_t count = uint32_t(last-first+1);
+  if (start+count <= size) return {{start,0},{count,0}};
+  return {{start,0},{size-start,count-(size-start)}};
+}
+
+void SpatialGrid::queryRadius(const Vec3& p, float radius,
+                              std::vector<uint32_t>& result) const {
+  result.clear();
+  forEachInRadius(p, radius, [&result](uint32_t i, float) {
+    result.push_back(i);
+  });
+}
+
+void SpatialGrid::queryNearest(const Vec3& p, size_t k,
+                               std::vector<uint32_t>& result,
+                               float maxRadius) const {
+  result.clear();
+  if (k == 0 || order.empty()) return;
+
+  // grow the radius until it holds k points, the k nearest points are then
+  // among them, the bounds diagonal covers every point
+  const Vec3 far{std::max(std::fabs(p.x-boundsMin.x), std::fabs(p.x-boundsMax.x)),
+                 std::max(std::fabs(p.y-boundsMin.y), std::fabs(p.y-boundsMax.y)),
+                 std::max(std::fabs(p.z-boundsMin.z), std::fabs(p.z-boundsMax.z))};
+  const float limit = std::min(maxRadius, far.length());
+
+  std::vector<std::pair<float, uint32_t>> candidates;
+  float radius = std::min(cellSize, limit);
+  while (true) {
+    candidates.clear();
+    forEachInRadius(p, radius, [&candidates](uint32_t i, float d2) {
+      candidates.emplace_back(d2, i);
+    });
+    if (candidates.size() >= k || radius >= limit) break;
+    radius = std::min(radius*2.0f, limit);
+  }
+
+  const size_t n = std::min(k, candidates.size());
+  std::partial_sort(candidates.begin(), candidates.begin()+int64_t(n),
+                    candidates.end());
+  for (size_t i = 0;i<n;++i) result.push_back(candidates[i].second);
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <vector>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+#include "Vec3.h"
+
+// Uniform grid for neighbour queries between points. The grid is unbounded,
+// cell coordinates wrap around a table of buckets whose size only depends
+// on the point count, so cells a whole table apart share a bucket. A
+// rebuild is a parallel counting sort of the points by bucket, the buckets
+// are laid out row by row so neighbouring cells are also neighbours in
+// memory and a query reads a few contiguous ranges. Queries return the
+// indices the points had when passed to build. Indices are 32 bit, so a
+// grid holds fewer than 2^32 points, and the table stops growing at 2^30
+// buckets, larger point sets just fill the buckets more.
+class SpatialGrid {
+public:
+  // cellSize should be about the typical query radius
+  SpatialGrid(float cellSize);
+
+  void build(const std::vector<Vec3>& positions);
+  void build(const float* x, const float* y, const float* z, size_t count);
+
+  // calls f(index, squaredDistance) for every point within radius of p
+  template <typename F>
+  void forEachInRadius(const Vec3& p, float radius, F f) const;
+
+  // indices of all points within radius of p, in no particular order
+  void queryRadius(const Vec3& p, float radius,
+                   std::vector<uint32_t>& result) const;
+  // indices of the k points nearest to p ordered by distance, fewer if
+  // there are not enough points within maxRadius
+  void queryNearest(const Vec3& p, size_t k, std::vector<uint32_t>& result,
+                    float maxRadius=std::numeric_limits<float>::max()) const;
+
+  // point indices in storage order, spatially close points are close in
+  // this order, see ParticleSystem::sortSpatially
+  const std::vector<uint32_t>& getOrder() const {return order;}
+
+  float getCellSize() const {return cellSize;}
+  size_t getPointCount() const {return order.size();}
+
+private:
+  static constexpr uint32_t maxTableBits = 30;
+
+  float cellSize;
+  float invCellSize;
+  uint32_t bitsX, bitsY, bitsZ;         // the table has 2^bits cells per axis
+  std::vector<uint32_t> bucketStart;   // table size + 1 entries
+  std::vector<uint32_t> order;
+  std::vector<float> posX, posY, posZ;  // in storage order
+  std::vector<uint32_t> pointBucket;
+  Vec3 boundsMin;
+  Vec3 boundsMax;
+
+  int32_t cellCoord(float v) const {
+    return int32_t(std::floor(v*invCellSize));
+  }
+
+  uint32_t bucket(int32_t x, int32_t y, int32_t z) const {
+    return (uint32_t(x) & ((1u << bitsX)-1)) |
+           ((uint32_t(y) & ((1u << bitsY)-1)) << bitsX) |
+           ((uint32_t(z) & ((1u << bitsZ)-1)) << (bitsX+bitsY));
+  }
+
+  // wrapped cell range along one axis covering [low, high], at most once
+  // around the table, split in two where it wraps
+  struct AxisRange {
+    uint32_t start[2];
+    uint32_t count[2];
+  };
+  AxisRange axisRange(float low, float high, uint32_t bits) const;
+
+  // calls f(begin, end) for the storage ranges of all buckets overlapping
+  // the box around p, every bucket once
+  template <typename F>
+  void forEachRange(const Vec3& p, float radius, F f) const;
+};
+
+template <typename F>
+void SpatialGrid::forEachRange(const Vec3& p, float radius, F f) const {
+  const AxisRange rx = axisRange(std::max(p.x-radius, boundsMin.x),
+                                 std::min(p.x+radius, boundsMax.x), bitsX);
+  const AxisRange ry = axisRange(std::max(p.y-radius, boundsMin.y),
+                                 std::min(p.y+radius, boundsMax.y), bitsY);
+  const AxisRange rz = axisRange(std::max(p.z-radius, boundsMin.z),
+                                 std::min(p.z+radius, boundsMax.z), bitsZ);
+  for (size_t iz = 0;iz<2;++iz) {
+    for (uint32_t z = rz.start[iz];z<rz.start[iz]+rz.count[iz];++z) {
+      for (size_t iy = 0;iy<2;++iy) {
+        for (uint32_t y = ry.start[iy];y<ry.start[iy]+ry.count[iy];++y) {
+          const uint32_t row = (y << bitsX) | (z << (bitsX+bitsY));
+          for (size_t ix = 0;ix<2;++ix) {
+            if (rx.count[ix] == 0) continue;
+            const uint32_t first = row | rx.start[ix];
+            f(bucketStart[first], bucketStart[first+rx.count[ix]]);
+          }
+        }
+      }
+    }
+  }
+}
+
+template <typename F>
+void SpatialGrid::forEachInRadius(const Vec3& p, float radius, F f) const {
+  if (order.empty()) return;
+
+  // cells sharing a bucket are sorted out by the distance test
+  const float r2 = radius*radius;
+  forEachRange(p, radius, [&](uint32_t begin, uint32_t end) {
+    for (uint32_t i = begin;i<end;++i) {
+      const float dx = posX[i]-p.x;
+      const float dy = posY[i]-p.y;
+      const float dz = posZ[i]-p.z;
+      const float d2 = dx*dx + dy*dy + dz*dz;
+      if (d2 <= r2) f(order[i], d2);
+    }
+  });
+}
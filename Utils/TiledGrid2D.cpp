@@ -0,0 +1,432 @@
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <cstring>
+#include <cmath>
+
+#include "TiledGrid2D.h"
+
+// file layout (native byte order):
+//   FileHeader
+//   LevelHeader[levelCount]
+//   uint64_t tileOffsets[tileCount]
+//   tiles, tileSize*tileSize floats each, starting at page aligned offsets,
+//   padded with zeros at the right and bottom border of a level
+struct FileHeader {
+  char magic[4];
+  uint32_t version;
+  uint32_t tileSize;
+  uint32_t levelCount;
+  uint64_t tileCount;
+};
+
+struct LevelHeader {
+  uint64_t width;
+  uint64_t height;
+  uint64_t tilesX;
+  uint64_t tilesY;
+  uint64_t firstTile;
+};
+
+static const char MAGIC[4] = {'T','G','2','D'};
+static const uint32_t VERSION = 1;
+static const uint64_t TILE_ALIGNMENT = 4096;
+
+static uint64_t alignUp(uint64_t value, uint64_t alignment) {
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+// receives the rows of level 0 in order, writes every band of tileSize
+// rows as soon as it is complete and feeds pairs of rows downsampled into
+// the next level, so memory use is independent of the grid height
+class TileWriter {
+public:
+  TileWriter(const std::string& filename, uint64_t width, uint64_t height,
+             uint32_t tileSize) :
+    file(filename, std::ofstream::binary),
+    tileSize(tileSize),
+    tileBuffer(size_t(tileSize)*tileSize)
+  {
+    if (width == 0 || height == 0)
+      throw TiledGridException("Can't store an empty grid");
+    if (tileSize == 0)
+      throw TiledGridException("Tile size must not be zero");
+    if (!file.is_open()) {
+      std::stringstream s;
+      s << "Can't open file " << filename << " for writing";
+      throw TiledGridException(s.str());
+    }
+
+    uint64_t tileCount = 0;
+    while (true) {
+      Level l;
+      l.width = width;
+      l.height = height;
+      l.tilesX = (width + tileSize - 1) / tileSize;
+      l.tilesY = (height + tileSize - 1) / tileSize;
+      l.firstTile = tileCount;
+      l.band.resize(size_t(width) * tileSize);
+      tileCount += l.tilesX * l.tilesY;
+      levels.push_back(std::move(l));
+      if (width <= tileSize && height <= tileSize) break;
+      width = (width+1)/2;
+      height = (height+1)/2;
+    }
+
+    const uint64_t indexStart = sizeof(FileHeader) +
+                                levels.size()*sizeof(LevelHeader);
+    tileStride = alignUp(tileBuffer.size()*sizeof(float), TILE_ALIGNMENT);
+    dataStart = alignUp(indexStart + tileCount*sizeof(uint64_t),
+                        TILE_ALIGNMENT);
+
+    FileHeader header;
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.tileSize = tileSize;
+    header.levelCount = uint32_t(levels.size());
+    header.tileCount = tileCount;
+    file.write((const char*)&header, sizeof(header));
+
+    for (const Level& l : levels) {
+      const LevelHeader lh{l.width, l.height, l.tilesX, l.tilesY, l.firstTile};
+      file.write((const char*)&lh, sizeof(lh));
+    }
+
+    std::vector<uint64_t> offsets(tileCount);
+    for (uint64_t i = 0;i<tileCount;++i) offsets[i] = dataStart + i*tileStride;
+    file.write((const char*)offsets.data(), offsets.size()*sizeof(uint64_t));
+  }
+
+  void pushRow(const float* row) {
+    pushRow(0, row);
+  }
+
+  void finish() {
+    for (const Level& l : levels) {
+      if (l.rows != l.height)
+        throw TiledGridException("Incomplete grid data");
+    }
+    file.close();
+    if (file.fail()) throw TiledGridException("Failed to write tiled grid");
+  }
+
+private:
+  struct Level {
+    uint64_t width;
+    uint64_t height;
+    uint64_t tilesX;
+    uint64_t tilesY;
+    uint64_t firstTile;
+    uint64_t rows{0};
+    std::vector<float> band;
+    std::vector<float> pending;
+    std::vector<float> down;
+    bool hasPending{false};
+  };
+
+  std::ofstream file;
+  uint32_t tileSize;
+  uint64_t tileStride;
+  uint64_t dataStart;
+  std::vector<Level> levels;
+  std::vector<float> tileBuffer;
+
+  void pushRow(size_t level, const float* row) {
+    Level& l = levels[level];
+    std::copy(row, row + l.width,
+              l.band.begin() + (l.rows % tileSize) * l.width);
+    l.rows++;
+    if (l.rows % tileSize == 0 || l.rows == l.height) flushBand(level);
+
+    if (level+1 == levels.size()) return;
+    if (!l.hasPending) {
+      l.pending.assign(row, row + l.width);
+      l.hasPending = true;
+      // odd height, the last row is paired with itself
+      if (l.rows == l.height) downsample(level, l.pending.data());
+    } else {
+      downsample(level, row);
+    }
+  }
+
+  void downsample(size_t level, const float* row) {
+    Level& l = levels[level];
+    const float* upper = l.pending.data();
+    const uint64_t w = levels[level+1].width;
+    l.down.resize(w);
+    for (uint64_t x = 0;x<w;++x) {
+      const uint64_t x0 = 2*x;
+      const uint64_t x1 = std::min(2*x+1, l.width-1);
+      l.down[x] = (upper[x0] + upper[x1] + row[x0] + row[x1]) * 0.25f;
+    }
+    l.hasPending = false;
+    pushRow(level+1, l.down.data());
+  }
+
+  void flushBand(size_t level) {
+    const Level& l = levels[level];
+    const uint64_t ty = (l.rows-1) / tileSize;
+    const uint64_t bandRows = l.rows - ty*tileSize;
+    for (uint64_t tx = 0;tx<l.tilesX;++tx) {
+      const uint64_t x0 = tx*tileSize;
+      const uint64_t columns = std::min<uint64_t>(tileSize, l.width - x0);
+      std::fill(tileBuffer.begin(), tileBuffer.end(), 0.0f);
+      for (uint64_t y = 0;y<bandRows;++y) {
+        const float* source = l.band.data() + y*l.width + x0;
+        std::copy(source, source + columns, tileBuffer.begin() + y*tileSize);
+      }
+      const uint64_t tile = l.firstTile + ty*l.tilesX + tx;
+      file.seekp(std::streamoff(dataStart + tile*tileStride));
+      file.write((const char*)tileBuffer.data(),
+                 tileBuffer.size()*sizeof(float));
+    }
+  }
+};
+
+void TiledGrid2D::save(const std::string& filename, const Grid2D& grid,
+                       uint32_t tileSize) {
+  TileWriter writer(filename, grid.getWidth(), grid.getHeight(), tileSize);
+  const float* data = grid.getData().data();
+  for (size_t y = 0;y<grid.getHeight();++y) {
+    writer.pushRow(data + y*grid.getWidth());
+  }
+  writer.finish();
+}
+
+void TiledGrid2D::convert(std::istream& is, const std::string& filename,
+                          uint32_t tileSize) {
+  size_t width, height;
+  is.read((char*)&width, sizeof (width));
+  is.read((char*)&height, sizeof (height));
+  if (!is) throw TiledGridException("Can't read grid header");
+
+  TileWriter writer(filename, width, height, tileSize);
+  std::vector<float> row(width);
+  for (size_t y = 0;y<height;++y) {
+    is.read((char*)row.data(), sizeof(float) * width);
+    if (!is) throw TiledGridException("Unexpected end of grid data");
+    writer.pushRow(row.data());
+  }
+  writer.finish();
+}
+
+TiledGrid2D::TiledGrid2D(const std::string& filename, size_t cacheBudget) :
+  file(filename),
+  cacheBudget(cacheBudget)
+{
+  // tiles are fetched explicitly, read-ahead would only pull in neighbours
+  file.adviseRandom();
+
+  FileHeader header;
+  if (file.size() < sizeof(header))
+    throw TiledGridException("File too small for a tiled grid");
+  std::memcpy(&header, file.data(), sizeof(header));
+  if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0)
+    throw TiledGridException("Not a tiled grid file");
+  if (header.version == 0 || header.version > VERSION) {
+    std::stringstream error;
+    error << "Unsupported tiled grid version " << header.version;
+    throw TiledGridException(error.str());
+  }
+
+  const uint64_t indexStart = sizeof(FileHeader) +
+                              uint64_t(header.levelCount)*sizeof(LevelHeader);
+  // the counts are untrusted, they are compared with the space left in the
+  // file instead of being multiplied out
+  if (header.tileSize == 0 || header.levelCount == 0 || file.size() < indexStart ||
+      header.tileCount > (file.size()-indexStart)/sizeof(uint64_t) ||
+      uint64_t(header.tileSize)*header.tileSize > file.size()/sizeof(float))
+    throw TiledGridException("Corrupt tiled grid header");
+
+  tileSize = header.tileSize;
+  tileBytes = size_t(tileSize)*tileSize*sizeof(float);
+  tileCount = header.tileCount;
+  levels.resize(header.levelCount);
+  for (size_t i = 0;i<levels.size();++i) {
+    LevelHeader lh;
+    std::memcpy(&lh, file.data() + sizeof(FileHeader) + i*sizeof(LevelHeader),
+                sizeof(lh));
+    // every tile of the level has to be in the index
+    if (lh.width == 0 || lh.height == 0 ||
+        lh.tilesX != lh.width/tileSize + (lh.width % tileSize != 0) ||
+        lh.tilesY != lh.height/tileSize + (lh.height % tileSize != 0) ||
+        lh.firstTile > tileCount || lh.tilesX > (tileCount-lh.firstTile)/lh.tilesY)
+      throw TiledGridException("Corrupt tiled grid level header");
+    levels[i] = Level{lh.width, lh.height, lh.tilesX, lh.tilesY, lh.firstTile};
+  }
+  tileOffsets = (const uint64_t*)(file.data() + indexStart);
+}
+
+const TiledGrid2D::Level& TiledGrid2D::getLevel(size_t level) const {
+  if (level >= levels.size()) {
+    std::stringstream error;
+    error << "Tiled grid has no level " << level;
+    throw TiledGridException(error.str());
+  }
+  return levels[level];
+}
+
+size_t TiledGrid2D::getWidth(size_t level) const {
+  return size_t(getLevel(level).width);
+}
+
+size_t TiledGrid2D::getHeight(size_t level) const {
+  return size_t(getLevel(level).height);
+}
+
+size_t TiledGrid2D::getLevelCount() const {
+  return levels.size();
+}
+
+uint32_t TiledGrid2D::getTileSize() const {
+  return tileSize;
+}
+
+const float* TiledGrid2D::tileData(uint64_t tile) const {
+  if (tile >= tileCount || tileOffsets[tile] > file.size() - tileBytes)
+    throw TiledGridException("Tile outside of the file");
+  return (const float*)(file.data() + tileOffsets[tile]);
+}
+
+// tiles live in a read-only file mapping, so dropping their pages while
+// another thread still reads from them is harmless, the pages are simply
+// faulted in again from the file
+void TiledGrid2D::evict(uint64_t tile) const {
+  auto it = resident.find(tile);
+  lru.erase(it->second);
+  resident.erase(it);
+
+  file.release(file.data() + tileOffsets[tile], tileBytes);
+}
+
+void TiledGrid2D::trimCache() const {
+  while (resident.size() > 1 && resident.size()*tileBytes > cacheBudget) {
+    evict(lru.back());
+  }
+}
+
+const float* TiledGrid2D::getTile(size_t level, size_t tx, size_t ty) const {
+  const Level& l = getLevel(level);
+  const uint64_t tile = l.firstTile + ty*l.tilesX + tx;
+
+  std::lock_guard<std::mutex> lock(cacheMutex);
+  auto it = resident.find(tile);
+  if (it != resident.end()) {
+    lru.splice(lru.begin(), lru, it->second);
+    return tileData(tile);
+  }
+
+  const float* data = tileData(tile);
+  file.willNeed(data, tileBytes);
+  lru.push_front(tile);
+  resident[tile] = lru.begin();
+  trimCache();
+  return data;
+}
+
+float TiledGrid2D::getValue(size_t x, size_t y, size_t level) const {
+  const Level& l = getLevel(level);
+  x = std::min<size_t>(x, l.width-1);
+  y = std::min<size_t>(y, l.height-1);
+  const float* tile = getTile(level, x / tileSize, y / tileSize);
+  return tile[(y % tileSize) * tileSize + x % tileSize];
+}
+
+// the four texels of a bilinear lookup usually share a tile, in that case
+// the cache is consulted only once
+void TiledGrid2D::fetchQuad(size_t level, size_t x0, size_t y0,
+                            size_t x1, size_t y1,
+                            float& va, float& vb, float& vc, float& vd) const {
+  if (x0 / tileSize == x1 / tileSize && y0 / tileSize == y1 / tileSize) {
+    const float* tile = getTile(level, x0 / tileSize, y0 / tileSize);
+    const size_t r0 = (y0 % tileSize) * tileSize;
+    const size_t r1 = (y1 % tileSize) * tileSize;
+    va = tile[r0 + x0 % tileSize];
+    vb = tile[r0 + x1 % tileSize];
+    vc = tile[r1 + x0 % tileSize];
+    vd = tile[r1 + x1 % tileSize];
+  } else {
+    va = getValue(x0, y0, level);
+    vb = getValue(x1, y0, level);
+    vc = getValue(x0, y1, level);
+    vd = getValue(x1, y1, level);
+  }
+}
+
+float TiledGrid2D::sample(const Vec2& pos, size_t level) const {
+  return sample(pos.x, pos.y, level);
+}
+
+float TiledGrid2D::sample(float x, float y, size_t level) const {
+  x = std::max(std::min(x,1.0f), 0.0f);
+  y = std::max(std::min(y,1.0f), 0.0f);
+
+  const Level& l = getLevel(level);
+  float sx = x*(l.width-1);
+  float sy = y*(l.height-1);
+
+  float alpha = sx - floorf(sx);
+  float beta  = sy - floorf(sy);
+
+  float va, vb, vc, vd;
+  fetchQuad(level, size_t(floorf(sx)), size_t(floorf(sy)),
+            size_t(ceilf(sx)), size_t(ceilf(sy)), va, vb, vc, vd);
+
+  return (va * (1.0f-alpha) + vb * alpha) * (1.0f-beta) + (vc * (1.0f-alpha) + vd * alpha) * beta;
+}
+
+Vec3 TiledGrid2D::normal(const Vec2& pos, size_t level) const {
+  return normal(pos.x, pos.y, level);
+}
+
+Vec3 TiledGrid2D::normal(float x, float y, size_t level) const {
+  x = std::max(std::min(x, 1.0f), 0.0f);
+  y = std::max(std::min(y, 1.0f), 0.0f);
+
+  const float width = float(getLevel(level).width);
+  const float height = float(getLevel(level).height);
+
+  float sx = x * (width - 1);
+  float sy = y * (height - 1);
+
+  float va, vb, vc, vd;
+  fetchQuad(level, size_t(floorf(sx)), size_t(floorf(sy)),
+            size_t(ceilf(sx)), size_t(ceilf(sy)), va, vb, vc, vd);
+
+  return Grid2D::cellNormal(va, vb, vc, vd, width, height);
+}
+
+Grid2D TiledGrid2D::toGrid2D(size_t level) const {
+  const Level& l = getLevel(level);
+  std::vector<float> data(size_t(l.width*l.height));
+  for (uint64_t ty = 0;ty<l.tilesY;++ty) {
+    for (uint64_t tx = 0;tx<l.tilesX;++tx) {
+      const float* tile = getTile(level, tx, ty);
+      const uint64_t x0 = tx*tileSize;
+      const uint64_t y0 = ty*tileSize;
+      const uint64_t columns = std::min<uint64_t>(tileSize, l.width - x0);
+      const uint64_t rows = std::min<uint64_t>(tileSize, l.height - y0);
+      for (uint64_t y = 0;y<rows;++y) {
+        std::copy(tile + y*tileSize, tile + y*tileSize + columns,
+                  data.begin() + (y0+y)*l.width + x0);
+      }
+    }
+  }
+  return Grid2D(size_t(l.width), size_t(l.height), data);
+}
+
+void TiledGrid2D::setCacheBudget(size_t bytes) {
+  std::lock_guard<std::mutex> lock(cacheMutex);
+  cacheBudget = bytes;
+  trimCache();
+}
+
+size_t TiledGrid2D::getCacheBudget() const {
+  std::lock_guard<std::mutex> lock(cacheMutex);
+  return cacheBudget;
+}
+
+size_t TiledGrid2D::getResidentTileCount() const {
+  std::lock_guard<std::mutex> lock(cacheMutex);
+  return resident.size();
+}
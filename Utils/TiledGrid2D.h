@@ -0,0 +1,98 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <list>
+#include <unordered_map>
+#include <mutex>
+#include <cstdint>
+
+#include "Vec2.h"
+#include "Vec3.h"
+#include "Grid2D.h"
+#include "MappedFile.h"
+
+class TiledGridException : public std::exception {
+public:
+  TiledGridException(const std::string& whatStr) : whatStr(whatStr) {}
+  virtual const char* what() const throw() {
+    return whatStr.c_str();
+  }
+private:
+  std::string whatStr;
+};
+
+// Out-of-core counterpart to Grid2D: the grid is stored on disk as square
+// tiles together with a chain of 2x2 box filtered mip levels. Opening a file
+// only maps it and reads the header, tiles are paged in on first access and
+// tracked in an LRU cache, tiles falling out of the cache budget are handed
+// back to the OS.
+class TiledGrid2D {
+public:
+  TiledGrid2D(const std::string& filename,
+              size_t cacheBudget = size_t(256) << 20);
+
+  TiledGrid2D(const TiledGrid2D&) = delete;
+  TiledGrid2D& operator=(const TiledGrid2D&) = delete;
+
+  // writes grid in the tiled format, mip levels are generated until a level
+  // fits into a single tile
+  static void save(const std::string& filename, const Grid2D& grid,
+                   uint32_t tileSize = 256);
+
+  // converts a stream written by Grid2D::save without holding more than a
+  // band of tileSize rows per level in memory
+  static void convert(std::istream& is, const std::string& filename,
+                      uint32_t tileSize = 256);
+
+  size_t getWidth(size_t level = 0) const;
+  size_t getHeight(size_t level = 0) const;
+  size_t getLevelCount() const;
+  uint32_t getTileSize() const;
+
+  float getValue(size_t x, size_t y, size_t level = 0) const;
+  float sample(float x, float y, size_t level = 0) const;
+  float sample(const Vec2& pos, size_t level = 0) const;
+
+  Vec3 normal(float x, float y, size_t level = 0) const;
+  Vec3 normal(const Vec2& pos, size_t level = 0) const;
+
+  // loads a whole level into memory, meant for the coarse levels
+  Grid2D toGrid2D(size_t level) const;
+
+  void setCacheBudget(size_t bytes);
+  size_t getCacheBudget() const;
+  size_t getResidentTileCount() const;
+
+private:
+  struct Level {
+    uint64_t width;
+    uint64_t height;
+    uint64_t tilesX;
+    uint64_t tilesY;
+    uint64_t firstTile;
+  };
+
+  MappedFile file;
+
+  uint32_t tileSize{0};
+  size_t tileBytes{0};
+  std::vector<Level> levels;
+  const uint64_t* tileOffsets{nullptr};
+  uint64_t tileCount{0};
+
+  size_t cacheBudget;
+  mutable std::mutex cacheMutex;
+  mutable std::list<uint64_t> lru;
+  mutable std::unordered_map<uint64_t, std::list<uint64_t>::iterator> resident;
+
+  // throws for levels the file does not have
+  const Level& getLevel(size_t level) const;
+  const float* getTile(size_t level, size_t tx, size_t ty) const;
+  const float* tileData(uint64_t tile) const;
+  void evict(uint64_t tile) const;
+  void trimCache() const;
+  void fetchQuad(size_t level, size_t x0, size_t y0, size_t x1, size_t y1,
+                 float& va, float& vb, float& vc, float& vd) const;
+};
@@ -23,9 +23,8 @@ public:
     e{x,y}
   {}
       
-  Vec2t(const Vec2t& other) :
-    e{other.x, other.y}
-  {}
+  Vec2t(const Vec2t& other) = default;
+  Vec2t& operator=(const Vec2t& other) = default;
 
   template <typename U>
   explicit Vec2t(const Vec2t<U>& other) :
@@ -26,9 +26,8 @@ public:
     e{x,y,z}
   {}
 
-  Vec3t(const Vec3t& other) :
-    e{other.x, other.y, other.z}
-  {}
+  Vec3t(const Vec3t& other) = default;
+  Vec3t& operator=(const Vec3t& other) = default;
   
   Vec3t(const Vec2t<T>& other, T z) :
     e{other.x, other.y, z}
@@ -7,8 +7,9 @@
 #include "Vec2.h"
 #include "Vec3.h"
 
+// 16 byte aligned so a vector can be loaded into one SIMD register
 template <typename T>
-union Vec4t {
+union alignas(16) Vec4t {
 public:
   std::array<T, 4> e;
   struct { T x; T y; T z; T w;};
@@ -24,9 +25,8 @@ public:
     e{x,y,z,w}
   {}
   
-  Vec4t(const Vec4t& other) :
-    e{other.x, other.y, other.z, other.w}
-  {}
+  Vec4t(const Vec4t& other) = default;
+  Vec4t& operator=(const Vec4t& other) = default;
   
   Vec4t(const Vec3t<T>& other, T w):
     e{other.x, other.y, other.z, w}
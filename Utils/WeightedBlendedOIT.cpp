@@ -0,0 +1,182 @@
+#include "WeightedBlendedOIT.h"
+#include "GLDebug.h"
+#include "GLState.h"
+
+const char* const WeightedBlendedOIT::weightFunction{
+"float oitWeight(vec4 color) {\n"
+"    float a = min(1.0, color.a*10.0) + 0.01;\n"
+"    float d = 1.0 - gl_FragCoord.z*0.9;\n"
+"    return clamp(a*a*a*1e8*d*d*d, 1e-2, 3e3);\n"
+"}\n"};
+
+static std::string compositeVsString{
+"#version 410\n"
+"void main() {\n"
+"    vec2 p = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);\n"
+"    gl_Position = vec4(p*2.0-1.0, 0.0, 1.0);\n"
+"}\n"};
+
+static std::string compositeFsString{
+"#version 410\n"
+"uniform sampler2D accumulation;\n"
+"uniform sampler2D revealage;\n"
+"uniform ivec2 offset;\n"
+"out vec4 FragColor;\n"
+"void main() {\n"
+"    ivec2 p = ivec2(gl_FragCoord.xy) - offset;\n"
+"    float r = texelFetch(revealage, p, 0).r;\n"
+"    if (r >= 1.0) discard;\n"
+"    vec4 a = texelFetch(accumulation, p, 0);\n"
+"    FragColor = vec4(a.rgb/clamp(a.a, 1e-4, 5e4), r);\n"
+"}\n"};
+
+WeightedBlendedOIT::WeightedBlendedOIT() :
+  compositeProg{GLProgram::createFromString(compositeVsString, compositeFsString)},
+  compositeArray{},
+  accumulation{GL_NEAREST, GL_NEAREST, GL_CLAMP_TO_EDGE, GL_CLAMP_TO_EDGE},
+  revealage{GL_NEAREST, GL_NEAREST, GL_CLAMP_TO_EDGE, GL_CLAMP_TO_EDGE},
+  framebuffer(0),
+  depthBuffer(0),
+  depthFormat(GL_NONE),
+  width(0),
+  height(0),
+  target(0),
+  readTarget(0),
+  viewport{0,0,0,0},
+  depthTest(GL_FALSE)
+{
+  GL(glGenFramebuffers(1, &framebuffer));
+  GL(glGenRenderbuffers(1, &depthBuffer));
+}
+
+WeightedBlendedOIT::~WeightedBlendedOIT() {
+  GL(glDeleteRenderbuffers(1, &depthBuffer));
+  GL(glDeleteFramebuffers(1, &framebuffer));
+}
+
+// depth can only be blitted between identical formats, so the offscreen
+// depth buffer mirrors the one of the target framebuffer
+GLenum WeightedBlendedOIT::targetDepthFormat() const {
+  const GLenum depth = target == 0 ? GL_DEPTH : GL_DEPTH_ATTACHMENT;
+  const GLenum stencil = target == 0 ? GL_STENCIL : GL_STENCIL_ATTACHMENT;
+  GLint type = GL_NONE;
+  GL(glGetFramebufferAttachmentParameteriv(GL_DRAW_FRAMEBUFFER, depth,
+                                           GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE,
+                                           &type));
+  if (type == GL_NONE) return GL_NONE;
+
+  GLint depthBits = 0;
+  GLint stencilBits = 0;
+  GLint componentType = GL_NONE;
+  GL(glGetFramebufferAttachmentParameteriv(GL_DRAW_FRAMEBUFFER, depth,
+                                           GL_FRAMEBUFFER_ATTACHMENT_DEPTH_SIZE,
+                                           &depthBits));
+  GL(glGetFramebufferAttachmentParameteriv(GL_DRAW_FRAMEBUFFER, depth,
+                                           GL_FRAMEBUFFER_ATTACHMENT_COMPONENT_TYPE,
+                                           &componentType));
+  // sizes of an empty attachment are an error to query
+  GLint stencilType = GL_NONE;
+  GL(glGetFramebufferAttachmentParameteriv(GL_DRAW_FRAMEBUFFER, stencil,
+                                           GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE,
+                                           &stencilType));
+  if (stencilType != GL_NONE)
+    GL(glGetFramebufferAttachmentParameteriv(GL_DRAW_FRAMEBUFFER, stencil,
+                                             GL_FRAMEBUFFER_ATTACHMENT_STENCIL_SIZE,
+                                             &stencilBits));
+  if (depthBits == 0) return GL_NONE;
+
+  const bool floatDepth = componentType == GL_FLOAT;
+  if (stencilBits > 0) return floatDepth ? GL_DEPTH32F_STENCIL8 : GL_DEPTH24_STENCIL8;
+  if (floatDepth) return GL_DEPTH_COMPONENT32F;
+  switch (depthBits) {
+    case 16 : return GL_DEPTH_COMPONENT16;
+    case 24 : return GL_DEPTH_COMPONENT24;
+    default : return GL_DEPTH_COMPONENT32;
+  }
+}
+
+void WeightedBlendedOIT::resize(uint32_t width, uint32_t height,
+                                GLenum depthFormat) {
+  if (width != this->width || height != this->height) {
+    accumulation.setEmpty(width, height, 4, GLDataType::HALF);
+    revealage.setEmpty(width, height, 1, GLDataType::HALF);
+  }
+  if (width != this->width || height != this->height ||
+      depthFormat != this->depthFormat) {
+    GL(glBindFramebuffer(GL_DRAW_FRAMEBUFFER, framebuffer));
+    if (depthFormat != GL_NONE) {
+      GL(glBindRenderbuffer(GL_RENDERBUFFER, depthBuffer));
+      GL(glRenderbufferStorage(GL_RENDERBUFFER, depthFormat, GLsizei(width),
+                               GLsizei(height)));
+    }
+    const bool hasStencil = depthFormat == GL_DEPTH24_STENCIL8 ||
+                            depthFormat == GL_DEPTH32F_STENCIL8;
+    GL(glFramebufferRenderbuffer(GL_DRAW_FRAMEBUFFER,
+                                 hasStencil ? GL_DEPTH_STENCIL_ATTACHMENT
+                                            : GL_DEPTH_ATTACHMENT,
+                                 GL_RENDERBUFFER,
+                                 depthFormat != GL_NONE ? depthBuffer : 0));
+    GL(glFramebufferTexture(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                            accumulation.getId(), 0));
+    GL(glFramebufferTexture(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT1,
+                            revealage.getId(), 0));
+    const GLenum drawBuffers[2] = {GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1};
+    GL(glDrawBuffers(2, drawBuffers));
+    if (glCheckFramebufferStatus(GL_DRAW_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+      throw GLException{"Incomplete transparency framebuffer"};
+  }
+  this->width = width;
+  this->height = height;
+  this->depthFormat = depthFormat;
+}
+
+void WeightedBlendedOIT::begin() {
+  GL(glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &target));
+  GL(glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &readTarget));
+  GL(glGetIntegerv(GL_VIEWPORT, viewport));
+  const uint32_t w = uint32_t(std::max(1, viewport[2]));
+  const uint32_t h = uint32_t(std::max(1, viewport[3]));
+  const GLenum format = targetDepthFormat();
+  resize(w, h, format);
+
+  GL(glBindFramebuffer(GL_DRAW_FRAMEBUFFER, framebuffer));
+  if (format != GL_NONE) {
+    GL(glBindFramebuffer(GL_READ_FRAMEBUFFER, GLuint(target)));
+    GL(glBlitFramebuffer(viewport[0], viewport[1], viewport[0]+viewport[2],
+                         viewport[1]+viewport[3], 0, 0, GLint(w), GLint(h),
+                         GL_DEPTH_BUFFER_BIT, GL_NEAREST));
+  }
+  GLState& state = GLState::current();
+  state.viewport(0, 0, GLsizei(w), GLsizei(h));
+
+  const GLfloat zero[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+  const GLfloat one[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+  GL(glClearBufferfv(GL_COLOR, 0, zero));
+  GL(glClearBufferfv(GL_COLOR, 1, one));
+
+  state.enable(GL_BLEND);
+  state.blendEquation(GL_FUNC_ADD);
+  state.blendFunc(0, GL_ONE, GL_ONE);
+  state.blendFunc(1, GL_ZERO, GL_ONE_MINUS_SRC_COLOR);
+}
+
+void WeightedBlendedOIT::end() {
+  GL(glBindFramebuffer(GL_DRAW_FRAMEBUFFER, GLuint(target)));
+  GL(glBindFramebuffer(GL_READ_FRAMEBUFFER, GLuint(readTarget)));
+  GLState& state = GLState::current();
+  state.viewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+
+  depthTest = state.isEnabled(GL_DEPTH_TEST);
+  state.disable(GL_DEPTH_TEST);
+  state.enable(GL_BLEND);
+  state.blendFunc(GL_ONE_MINUS_SRC_ALPHA, GL_SRC_ALPHA);
+
+  compositeProg.enable();
+  compositeProg.setTexture("accumulation", accumulation, 0);
+  compositeProg.setTexture("revealage", revealage, 1);
+  compositeProg.setUniform("offset", Vec2i(viewport[0], viewport[1]));
+  compositeArray.bind();
+  GL(glDrawArrays(GL_TRIANGLES, 0, 3));
+
+  if (depthTest) state.enable(GL_DEPTH_TEST);
+}
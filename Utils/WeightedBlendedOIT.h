@@ -0,0 +1,46 @@
+#pragma once
+
+#include "GLProgram.h"
+#include "GLArray.h"
+#include "GLTexture2D.h"
+
+// Weighted blended order independent transparency (McGuire and Bavoil 2013).
+// Transparent geometry drawn between begin and end is accumulated into an
+// offscreen buffer and composited over the framebuffer that was bound at
+// begin, depth tested against that framebuffer's depth. Fragment shaders
+// have to write the weighted premultiplied color (see weightFunction) to
+// output 0 and the alpha to output 1, no sorting is needed.
+class WeightedBlendedOIT {
+public:
+  WeightedBlendedOIT();
+  ~WeightedBlendedOIT();
+
+  WeightedBlendedOIT(const WeightedBlendedOIT&) = delete;
+  WeightedBlendedOIT& operator=(const WeightedBlendedOIT&) = delete;
+
+  void begin();
+  void end();
+
+  // GLSL float oitWeight(vec4 premultipliedColor) for the fragment shaders,
+  // a plain string so it is usable during static initialization
+  static const char* const weightFunction;
+
+private:
+  GLProgram compositeProg;
+  GLArray compositeArray;
+  GLTexture2D accumulation;
+  GLTexture2D revealage;
+  GLuint framebuffer;
+  GLuint depthBuffer;
+  GLenum depthFormat;
+  uint32_t width;
+  uint32_t height;
+
+  GLint target;
+  GLint readTarget;   // the read framebuffer, rebound for the depth blit
+  GLint viewport[4];
+  GLboolean depthTest;
+
+  void resize(uint32_t width, uint32_t height, GLenum depthFormat);
+  GLenum targetDepthFormat() const;
+};